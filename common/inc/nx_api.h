@@ -319,6 +319,20 @@ extern   "C" {
 #define NX_TRACE_IP_INTERFACE_INFO_GET                  446             /* I1 = ip_ptr, I2 = ip_address, I3 = physical address msw, I4 = physical address lsw */
 #define NX_TRACE_PACKET_DATA_EXTRACT_OFFSET             447             /* I1 = packet_ptr, I2 = buffer_length, I3 = bytes_copied,                  */
 #define NX_TRACE_TCP_SOCKET_BYTES_AVAILABLE             448             /* I1 = ip ptr, I2 = socket ptr, I3 = bytes available                       */
+#define NX_TRACE_TCP_SOCKET_EXTENDED_INFO_GET           449             /* I1 = ip ptr, I2 = socket ptr, I3 = congestion window, I4 = smoothed rtt  */
+#define NX_TRACE_TCP_SERVER_SOCKET_POOL_LISTEN          450             /* I1 = ip ptr, I2 = port, I3 = socket count, I4 = listen queue size        */
+#define NX_TRACE_TCP_SERVER_SOCKET_POOL_ACCEPT          451             /* I1 = ip ptr, I2 = port, I3 = array size, I4 = wait option                */
+#define NX_TRACE_TCP_SERVER_SOCKET_POOL_RELEASE         452             /* I1 = ip ptr, I2 = socket ptr, I3 = socket state                          */
+#define NX_TRACE_IP_RECEIVE_QUEUES_CREATE               453             /* I1 = ip ptr, I2 = queue count, I3 = stack size, I4 = priority            */
+#define NX_TRACE_IP_PACKET_FILTER_RULES_SET             454             /* I1 = ip ptr, I2 = rule array, I3 = rule count, I4 = default action       */
+#define NX_TRACE_UDP_SOCKET_CONNECT                     455             /* I1 = ip ptr, I2 = socket ptr, I3 = ip address, I4 = port                 */
+#define NX_TRACE_UDP_SOCKET_PORT_SHARE_ENABLE           456             /* I1 = ip ptr, I2 = socket ptr                                             */
+#define NX_TRACE_UDP_SOCKET_SEND_BATCH                  457             /* I1 = socket ptr, I2 = entry array, I3 = entry count                      */
+#define NX_TRACE_UDP_SOCKET_RECEIVE_BATCH               458             /* I1 = ip ptr, I2 = socket ptr, I3 = array size, I4 = received count       */
+#define NX_TRACE_UDP_SOCKET_SEGMENT_SEND                459             /* I1 = socket ptr, I2 = packet ptr, I3 = packet size, I4 = segment size    */
+#define NX_TRACE_UDP_SOCKET_RECEIVE_BUFFER_SET          460             /* I1 = ip ptr, I2 = socket ptr, I3 = maximum bytes                         */
+#define NX_TRACE_UDP_SOCKET_DROP_INFO_GET               461             /* I1 = ip ptr, I2 = socket ptr, I3 = queue full, I4 = no buffer            */
+#define NX_TRACE_UDP_SOCKET_DROP_NOTIFY                 462             /* I1 = ip ptr, I2 = socket ptr, I3 = threshold, I4 = period                */
 
 #endif
 
@@ -391,6 +405,13 @@ VOID _nx_trace_event_update(TX_TRACE_BUFFER_ENTRY *event, ULONG timestamp, ULONG
 #define NX_SEARCH_PORT_START      0xC000                    /* Free port search start UDP/TCP */
 #endif /* NX_SEARCH_PORT_START */
 
+#ifdef NX_ENABLE_EPHEMERAL_PORT_BITMAP
+#define NX_PORT_BITMAP_RANGE      ((ULONG)((NX_MAX_PORT + 1) - NX_SEARCH_PORT_START))
+#define NX_PORT_BITMAP_WORDS      ((NX_PORT_BITMAP_RANGE + 31) >> 5)
+#define NX_PORT_BITMAP_GROUPS     ((NX_PORT_BITMAP_WORDS + 31) >> 5)
+#define NX_PORT_BITMAP_LAST_MASK  ((NX_PORT_BITMAP_RANGE & 31) ? ((((ULONG)1) << (NX_PORT_BITMAP_RANGE & 31)) - 1) : ((ULONG)0xFFFFFFFF))
+#endif /* NX_ENABLE_EPHEMERAL_PORT_BITMAP */
+
 #ifndef NX_PHYSICAL_HEADER
 #define NX_PHYSICAL_HEADER        16                        /* Maximum physical header        */
 #endif
@@ -445,6 +466,138 @@ VOID _nx_trace_event_update(TX_TRACE_BUFFER_ENTRY *event, ULONG timestamp, ULONG
 #define NX_IP_ROUTING_TABLE_SIZE  8
 #endif /* NX_IP_ROUTING_TABLE_SIZE */
 
+/* Define the static routing trie.  Each node consumes 4 bits of the destination address, so a
+   lookup visits at most 8 nodes.  By default there are enough nodes for a full table of host
+   routes; tables of mostly shorter prefixes need far fewer.  */
+#ifdef NX_ENABLE_IP_STATIC_ROUTE_TRIE
+#define NX_IP_ROUTING_TRIE_STRIDE 4
+#define NX_IP_ROUTING_TRIE_FANOUT (1 << NX_IP_ROUTING_TRIE_STRIDE)
+#ifndef NX_IP_ROUTING_TRIE_NODES
+#define NX_IP_ROUTING_TRIE_NODES  ((NX_IP_ROUTING_TABLE_SIZE * 7) + 1)
+#endif /* NX_IP_ROUTING_TRIE_NODES */
+#endif /* NX_ENABLE_IP_STATIC_ROUTE_TRIE */
+
+
+/* Define the size of the TCP transmit queue index.  By default it holds as many
+   entries as the default TCP transmit queue depth.  */
+#ifdef NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX
+#ifndef NX_TCP_TRANSMIT_QUEUE_INDEX_SIZE
+#ifdef NX_TCP_MAXIMUM_TX_QUEUE
+#define NX_TCP_TRANSMIT_QUEUE_INDEX_SIZE NX_TCP_MAXIMUM_TX_QUEUE
+#else
+#define NX_TCP_TRANSMIT_QUEUE_INDEX_SIZE 20
+#endif /* NX_TCP_MAXIMUM_TX_QUEUE */
+#endif /* NX_TCP_TRANSMIT_QUEUE_INDEX_SIZE */
+#endif /* NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX */
+
+
+/* Define the limits of hashed IP fragment re-assembly.  The hash size must be a power
+   of two.  The timeout is expressed in IP periodic events, which occur every second.  */
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH
+#ifndef NX_IP_FRAGMENT_HASH_SIZE
+#define NX_IP_FRAGMENT_HASH_SIZE      16
+#endif /* NX_IP_FRAGMENT_HASH_SIZE */
+
+#ifndef NX_IP_FRAGMENT_MAX_DATAGRAMS
+#define NX_IP_FRAGMENT_MAX_DATAGRAMS  8
+#endif /* NX_IP_FRAGMENT_MAX_DATAGRAMS */
+
+#ifndef NX_IP_FRAGMENT_MAX_FRAGMENTS
+#define NX_IP_FRAGMENT_MAX_FRAGMENTS  64
+#endif /* NX_IP_FRAGMENT_MAX_FRAGMENTS */
+
+#ifndef NX_IP_FRAGMENT_TIMEOUT
+#define NX_IP_FRAGMENT_TIMEOUT        2
+#endif /* NX_IP_FRAGMENT_TIMEOUT */
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH */
+
+
+#ifdef NX_ENABLE_IP_RECEIVE_QUEUES
+#ifndef NX_IP_RECEIVE_QUEUES
+#define NX_IP_RECEIVE_QUEUES                4
+#endif /* NX_IP_RECEIVE_QUEUES */
+#endif /* NX_ENABLE_IP_RECEIVE_QUEUES */
+
+
+#ifdef NX_ENABLE_IP_EVENT_BUDGET
+#ifndef NX_IP_EVENT_QUANTUM
+#define NX_IP_EVENT_QUANTUM                 32
+#endif /* NX_IP_EVENT_QUANTUM */
+
+#ifndef NX_IP_RECEIVE_BUDGET
+#define NX_IP_RECEIVE_BUDGET                NX_IP_EVENT_QUANTUM
+#endif /* NX_IP_RECEIVE_BUDGET */
+
+#ifndef NX_IP_DRIVER_PACKET_BUDGET
+#define NX_IP_DRIVER_PACKET_BUDGET          NX_IP_EVENT_QUANTUM
+#endif /* NX_IP_DRIVER_PACKET_BUDGET */
+
+#ifndef NX_IP_TCP_BUDGET
+#define NX_IP_TCP_BUDGET                    NX_IP_EVENT_QUANTUM
+#endif /* NX_IP_TCP_BUDGET */
+#endif /* NX_ENABLE_IP_EVENT_BUDGET */
+
+
+#ifdef NX_ENABLE_IP_PATH_MTU_DISCOVERY
+#ifndef NX_IP_PATH_MTU_CACHE_SIZE
+#define NX_IP_PATH_MTU_CACHE_SIZE           8
+#endif /* NX_IP_PATH_MTU_CACHE_SIZE */
+
+#ifndef NX_IP_PATH_MTU_TIMEOUT
+#define NX_IP_PATH_MTU_TIMEOUT              600
+#endif /* NX_IP_PATH_MTU_TIMEOUT */
+
+#ifndef NX_IP_PATH_MTU_MINIMUM
+#define NX_IP_PATH_MTU_MINIMUM              576
+#endif /* NX_IP_PATH_MTU_MINIMUM */
+#endif /* NX_ENABLE_IP_PATH_MTU_DISCOVERY */
+
+
+#ifdef NX_ENABLE_IP_PACKET_FILTER
+#ifndef NX_IP_PACKET_FILTER_MAX_RULES
+#define NX_IP_PACKET_FILTER_MAX_RULES       32
+#endif /* NX_IP_PACKET_FILTER_MAX_RULES */
+
+/* Define the number of protocol classes in the packet filter decision table: ICMP, TCP, UDP
+   and all other protocols.  */
+#define NX_IP_PACKET_FILTER_CLASSES         4
+#endif /* NX_ENABLE_IP_PACKET_FILTER */
+
+
+#ifdef NX_ENABLE_UDP_RECEIVE_BUDGET
+#ifndef NX_UDP_RECEIVE_BUFFER_DEFAULT
+#define NX_UDP_RECEIVE_BUFFER_DEFAULT       0
+#endif /* NX_UDP_RECEIVE_BUFFER_DEFAULT */
+#endif /* NX_ENABLE_UDP_RECEIVE_BUDGET */
+
+
+#ifdef NX_ENABLE_UDP_FLOW_DEMUX
+#ifndef NX_UDP_CONNECTED_TABLE_SIZE
+#define NX_UDP_CONNECTED_TABLE_SIZE         32
+#endif /* NX_UDP_CONNECTED_TABLE_SIZE */
+#define NX_UDP_CONNECTED_TABLE_MASK         (NX_UDP_CONNECTED_TABLE_SIZE - 1)
+#endif /* NX_ENABLE_UDP_FLOW_DEMUX */
+
+
+#ifdef NX_ENABLE_IGMP_GROUP_TABLE
+#ifndef NX_IGMP_TIMER_WHEEL_SIZE
+#define NX_IGMP_TIMER_WHEEL_SIZE            32
+#endif /* NX_IGMP_TIMER_WHEEL_SIZE */
+#endif /* NX_ENABLE_IGMP_GROUP_TABLE */
+
+
+#ifdef NX_ENABLE_ARP_QUEUE_BUDGET
+#ifndef NX_ARP_QUEUE_BUDGET
+#define NX_ARP_QUEUE_BUDGET                 16384
+#endif /* NX_ARP_QUEUE_BUDGET */
+#endif /* NX_ENABLE_ARP_QUEUE_BUDGET */
+
+
+#ifdef NX_ENABLE_ARP_TIMER_WHEEL
+#ifndef NX_ARP_TIMER_WHEEL_SIZE
+#define NX_ARP_TIMER_WHEEL_SIZE             64
+#endif /* NX_ARP_TIMER_WHEEL_SIZE */
+#endif /* NX_ENABLE_ARP_TIMER_WHEEL */
 
 #ifdef NX_ENABLE_EXTENDED_NOTIFY_SUPPORT
 #ifdef NX_DISABLE_EXTENDED_NOTIFY_SUPPORT
@@ -575,6 +728,15 @@ VOID _nx_trace_event_update(TX_TRACE_BUFFER_ENTRY *event, ULONG timestamp, ULONG
 #define NX_ROUTE_TABLE_MASK          (NX_ROUTE_TABLE_SIZE - 1)
 
 
+/* Define the number of buckets in the ARP hash table.  The value must be a power of
+   two no larger than 65536.  By default it is the size of the routing hash table.  */
+
+#ifndef NX_ARP_TABLE_SIZE
+#define NX_ARP_TABLE_SIZE            NX_ROUTE_TABLE_SIZE
+#endif /* NX_ARP_TABLE_SIZE */
+#define NX_ARP_TABLE_MASK            (NX_ARP_TABLE_SIZE - 1)
+
+
 /* By default use 0xFF when sending raw packet.  */
 #ifndef NX_IP_RAW
 #define NX_IP_RAW                    0x00FF0000
@@ -727,6 +889,7 @@ VOID _nx_trace_event_update(TX_TRACE_BUFFER_ENTRY *event, ULONG timestamp, ULONG
 #define NX_LINK_UNINITIALIZE         17
 #define NX_LINK_DEFERRED_PROCESSING  18
 #define NX_LINK_INTERFACE_ATTACH     19
+#define NX_LINK_PACKET_FLUSH         20
 #define NX_LINK_USER_COMMAND         50     /* Values after this value are reserved for application.  */
 
 
@@ -738,6 +901,11 @@ VOID _nx_trace_event_update(TX_TRACE_BUFFER_ENTRY *event, ULONG timestamp, ULONG
 #define NX_IP_PACKET_IN              0
 #define NX_IP_PACKET_OUT             1
 
+/* Define the actions of IP packet filter rules.  */
+#define NX_IP_PACKET_FILTER_ACCEPT      0
+#define NX_IP_PACKET_FILTER_DROP        1
+#define NX_IP_PACKET_FILTER_RATE_LIMIT  2
+
 /* Define the control block definitions for all system objects.  */
 
 
@@ -796,6 +964,28 @@ typedef  struct NX_PACKET_STRUCT
     /* Define the pointer to the byte after the last character written in the buffer.  */
     UCHAR *nx_packet_append_ptr;
 
+#ifdef NX_ENABLE_TCP_RACK_TLP
+    /* Define the time this packet was last transmitted on a TCP socket.  */
+    ULONG nx_packet_tcp_transmit_time;
+#endif /* NX_ENABLE_TCP_RACK_TLP */
+
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+    /* Define the destination cache of the socket sending this packet.  It is only valid
+       until the packet is passed to IP.  */
+    struct NX_IP_DESTINATION_CACHE_STRUCT
+         *nx_packet_destination_cache;
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
+
+#ifdef NX_ENABLE_IP_FRAGMENT_ZERO_COPY
+    /* Define the original packet whose payload is referenced by this IP fragment.  The
+       references are packet headers placed in the fragment's own buffer.  On the
+       original packet, the reference count holds the number of fragments that still
+       reference its payload.  */
+    struct NX_PACKET_STRUCT
+         *nx_packet_fragment_source;
+    ULONG nx_packet_fragment_references;
+#endif /* NX_ENABLE_IP_FRAGMENT_ZERO_COPY */
+
 #ifdef NX_PACKET_HEADER_PAD
 
     /* Define a pad word for 16-byte alignment, if necessary.  */
@@ -872,7 +1062,8 @@ typedef struct NX_ARP_STRUCT
     UINT nx_arp_retries;
 
     /* Define the links for the IP ARP dynamic structures in the system.  This list
-       is maintained in a most recently used fashion.  */
+       is maintained in a most recently used fashion, and entries are reused from
+       the end of the list.  */
     struct NX_ARP_STRUCT
         *nx_arp_pool_next,
         *nx_arp_pool_previous;
@@ -900,9 +1091,115 @@ typedef struct NX_ARP_STRUCT
        the oldest packet is discarded in favor of keeping the newer packet.  */
     struct NX_PACKET_STRUCT
         *nx_arp_packets_waiting;
+
+#ifdef NX_ENABLE_ARP_QUEUE_BUDGET
+    /* Define the last packet queued and the number of bytes queued while address
+       resolution is pending, and the links of the list of entries with queued packets.  */
+    struct NX_PACKET_STRUCT
+         *nx_arp_packets_waiting_tail;
+    ULONG nx_arp_packets_waiting_bytes;
+    struct NX_ARP_STRUCT
+         *nx_arp_queue_next,
+         *nx_arp_queue_previous;
+#endif /* NX_ENABLE_ARP_QUEUE_BUDGET */
+
+#ifdef NX_ENABLE_ARP_TIMER_WHEEL
+    /* Define the links of the timer wheel slot this entry is on while its next update
+       is pending, and the ARP tick at which the update is due.  */
+    struct NX_ARP_STRUCT
+        *nx_arp_timer_next,
+        *nx_arp_timer_previous;
+    ULONG nx_arp_timer_expiry;
+
+    /* Define a flag that indicates the entry was used to send a packet since its
+       physical address was last confirmed.  */
+    UINT nx_arp_timer_used;
+#endif /* NX_ENABLE_ARP_TIMER_WHEEL */
 } NX_ARP;
 
 
+#ifdef NX_ENABLE_IGMP_GROUP_TABLE
+/* Define the IGMP group entry.  Joined groups are kept in a hash table that is set up in
+   memory supplied by the application, and groups with a pending membership report are
+   kept on a timer wheel.  */
+
+typedef struct NX_IGMP_GROUP_STRUCT
+{
+
+    /* Define the group address and the interface the group was joined on.  */
+    ULONG nx_igmp_group_address;
+    struct NX_INTERFACE_STRUCT
+         *nx_igmp_group_interface;
+
+    /* Define the registration count.  */
+    ULONG nx_igmp_group_join_count;
+
+    /* Define the loopback flag.  This flag is set based on the global loopback enable
+       at the time the group was joined.  */
+    UINT  nx_igmp_group_loopback_enable;
+
+    /* Define the link to the next group in the same hash bucket, or to the next free
+       entry.  */
+    struct NX_IGMP_GROUP_STRUCT
+         *nx_igmp_group_hash_next;
+
+    /* Define the links of the list of all joined groups.  */
+    struct NX_IGMP_GROUP_STRUCT
+         *nx_igmp_group_next,
+         *nx_igmp_group_previous;
+
+    /* Define the links of the timer wheel slot this group is on while its report is
+       pending, and the IGMP tick at which the report is due.  */
+    struct NX_IGMP_GROUP_STRUCT
+         *nx_igmp_group_timer_next,
+         *nx_igmp_group_timer_previous;
+    ULONG nx_igmp_group_timer_expiry;
+    UINT  nx_igmp_group_timer_active;
+} NX_IGMP_GROUP;
+#endif /* NX_ENABLE_IGMP_GROUP_TABLE */
+
+
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+/* Define the destination cache.  A socket keeps the route to its last destination and the
+   ARP entry of the next hop, so repeated transmissions skip the route and ARP lookups.  The
+   route is valid while the generation matches that of the IP instance, and the ARP entry
+   while it is active and still maps the next hop.  */
+
+typedef struct NX_IP_DESTINATION_CACHE_STRUCT
+{
+
+    /* Define the destination and the route to it.  A NULL interface indicates that no
+       route is cached.  */
+    ULONG       nx_ip_destination_cache_address;
+    struct NX_INTERFACE_STRUCT
+               *nx_ip_destination_cache_interface;
+    ULONG       nx_ip_destination_cache_next_hop;
+    ULONG       nx_ip_destination_cache_generation;
+
+    /* Define the ARP entry that resolved the next hop.  */
+    struct NX_ARP_STRUCT
+               *nx_ip_destination_cache_arp;
+} NX_IP_DESTINATION_CACHE;
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
+
+
+#ifdef NX_ENABLE_IP_PATH_MTU_DISCOVERY
+/* Define the path MTU cache entry.  An entry holds the path MTU learned for a destination
+   from an ICMP fragmentation needed message, and is valid while its timeout is non-zero.  */
+
+typedef struct NX_IP_PATH_MTU_STRUCT
+{
+
+    ULONG       nx_ip_path_mtu_address;
+    ULONG       nx_ip_path_mtu_size;
+
+    /* Define the number of seconds until the entry expires and the path MTU to the
+       destination is probed again from the interface MTU.  */
+    ULONG       nx_ip_path_mtu_timeout;
+} NX_IP_PATH_MTU;
+#endif /* NX_ENABLE_IP_PATH_MTU_DISCOVERY */
+
+
 /* Define the basic UDP socket structure.  This structure is used to manage all information
    necessary to manage UDP transmission and reception.  */
 
@@ -990,9 +1287,62 @@ typedef struct NX_UDP_SOCKET_STRUCT
     void                       *nx_udp_socket_reserved_ptr;
 
     struct NX_INTERFACE_STRUCT *nx_udp_socket_ip_interface;
+
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+    /* Define the destination cache for packets sent by this socket.  */
+    NX_IP_DESTINATION_CACHE     nx_udp_socket_destination_cache;
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
+
+#ifdef NX_ENABLE_UDP_FLOW_DEMUX
+    /* Define the peer of a connected socket.  A connected socket only receives packets
+       from its peer.  A zero address indicates the socket is not connected.  */
+    ULONG                       nx_udp_socket_peer_address;
+    UINT                        nx_udp_socket_peer_port;
+
+    /* Define the link to the next socket in the same bucket of the connected socket
+       table.  A connected socket is in the table while it is bound.  */
+    struct NX_UDP_SOCKET_STRUCT
+                               *nx_udp_socket_connected_next;
+
+    /* Define the port sharing flag.  Sockets that all have port sharing enabled can be
+       bound to the same port, and the flows received on the port are spread over them.  */
+    UINT                        nx_udp_socket_port_share;
+#endif /* NX_ENABLE_UDP_FLOW_DEMUX */
+
+#ifdef NX_ENABLE_UDP_RECEIVE_BUDGET
+    /* Define the number of bytes queued on the receive queue, UDP headers included, and
+       the maximum.  A maximum of zero means the queue is only limited in packets.  */
+    ULONG                       nx_udp_socket_receive_bytes;
+    ULONG                       nx_udp_socket_receive_bytes_maximum;
+
+    /* Define the receive drop counters of this socket, split by cause.  */
+    ULONG                       nx_udp_socket_drops_queue_full;
+    ULONG                       nx_udp_socket_drops_no_buffer;
+    ULONG                       nx_udp_socket_drops_checksum;
+
+    /* Define the drop notify function, called once in a period of ticks when the drops in
+       that period reach the threshold, and the drops counted in the current period.  */
+    VOID                        (*nx_udp_socket_drop_notify)(struct NX_UDP_SOCKET_STRUCT *socket_ptr, ULONG drops);
+    ULONG                       nx_udp_socket_drop_threshold;
+    ULONG                       nx_udp_socket_drop_period;
+    ULONG                       nx_udp_socket_drop_period_start;
+    ULONG                       nx_udp_socket_drop_period_count;
+#endif /* NX_ENABLE_UDP_RECEIVE_BUDGET */
 } NX_UDP_SOCKET;
 
 
+/* Define the UDP send batch entry.  Each entry holds a packet and the IP address and port it is
+   sent to.  */
+
+typedef struct NX_UDP_SEND_ENTRY_STRUCT
+{
+
+    NX_PACKET  *nx_udp_send_entry_packet;
+    ULONG       nx_udp_send_entry_ip_address;
+    UINT        nx_udp_send_entry_port;
+} NX_UDP_SEND_ENTRY;
+
+
 /* Define the basic TCP socket structure.  This structure is used to manage all information
    necessary to manage TCP transmission and reception.  */
 
@@ -1025,6 +1375,19 @@ typedef struct NX_TCP_SOCKET_STRUCT
          *nx_tcp_socket_connect_interface;
     ULONG nx_tcp_socket_next_hop_address;
 
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+    /* Define the destination cache, which pins the ARP entry of the next hop.  */
+    NX_IP_DESTINATION_CACHE
+          nx_tcp_socket_destination_cache;
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
+
+#ifdef NX_ENABLE_IP_PATH_MTU_DISCOVERY
+    /* Define the path MTU to the peer, and the generation of the path MTU cache that the
+       path MTU and connect MSS were computed from.  */
+    ULONG nx_tcp_socket_path_mtu;
+    ULONG nx_tcp_socket_path_mtu_generation;
+#endif /* NX_ENABLE_IP_PATH_MTU_DISCOVERY */
+
     /* mss2 is the holding place for the smss * smss value.
        It is computed and stored here once for later use. */
     ULONG nx_tcp_socket_connect_mss2;
@@ -1077,6 +1440,35 @@ typedef struct NX_TCP_SOCKET_STRUCT
     ULONG nx_tcp_socket_bytes_received;
     ULONG nx_tcp_socket_retransmit_packets;
     ULONG nx_tcp_socket_checksum_errors;
+    ULONG nx_tcp_socket_retransmit_timeouts;
+    ULONG nx_tcp_socket_fast_retransmits;
+    ULONG nx_tcp_socket_duplicated_acks;
+    ULONG nx_tcp_socket_zero_window_probes;
+    ULONG nx_tcp_socket_zero_window_received;
+    ULONG nx_tcp_socket_rack_retransmits;
+    ULONG nx_tcp_socket_tail_loss_probes;
+
+    /* Define the round trip time measurement.  One segment is timed at a time and
+       segments that have been retransmitted are never sampled (Karn's algorithm).
+       The smoothed RTT is kept scaled by 8 and the RTT variance scaled by 4, both
+       in timer ticks, as in RFC 6298.  A smoothed RTT of zero means no sample
+       has been taken yet.  */
+    ULONG nx_tcp_socket_rtt_sequence;
+    ULONG nx_tcp_socket_rtt_start_time;
+    ULONG nx_tcp_socket_rtt_smoothed;
+    ULONG nx_tcp_socket_rtt_variance;
+    UINT  nx_tcp_socket_rtt_timing;
+
+#ifdef NX_ENABLE_TCP_RACK_TLP
+    /* Define the RACK-TLP loss detection state.  The reordering timeout and the
+       probe timeout are in timer ticks and count down in the fast periodic
+       processing.  The minimum RTT sizes the reordering window.  */
+    ULONG nx_tcp_socket_rtt_minimum;
+    ULONG nx_tcp_socket_rack_timeout;
+    ULONG nx_tcp_socket_tlp_timeout;
+    ULONG nx_tcp_socket_tlp_end_sequence;
+    UINT  nx_tcp_socket_tlp_in_progress;
+#endif /* NX_ENABLE_TCP_RACK_TLP */
 
     /* Define the entry that this TCP socket belongs to.  */
     struct NX_IP_STRUCT
@@ -1106,6 +1498,17 @@ typedef struct NX_TCP_SOCKET_STRUCT
     NX_PACKET *nx_tcp_socket_transmit_sent_head,
               *nx_tcp_socket_transmit_sent_tail;
 
+#ifdef NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX
+    /* Define the transmit queue index.  This ring mirrors the packet sent queue: the
+       entry at the index head holds the ending sequence of the packet at the head of
+       the queue, followed by one entry per queued packet in order.  The starting
+       sequence of the head packet is kept separately, so the sequence range of any
+       queued packet is known without touching the packet itself.  */
+    ULONG      nx_tcp_socket_transmit_index_start;
+    ULONG      nx_tcp_socket_transmit_index_head;
+    ULONG      nx_tcp_socket_transmit_index_end[NX_TCP_TRANSMIT_QUEUE_INDEX_SIZE];
+#endif /* NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX */
+
     /* Define the TCP transmit timeout parameters.  If the socket timeout is non-zero,
        there is an active timeout on the TCP socket.  Subsequent timeouts are derived
        from the timeout rate, which is adjusted higher as timeouts occur.  */
@@ -1137,6 +1540,17 @@ typedef struct NX_TCP_SOCKET_STRUCT
         *nx_tcp_socket_bound_next,
         *nx_tcp_socket_bound_previous;
 
+#ifdef NX_ENABLE_TCP_ACCEPT_POOL
+    /* Define the accept pool membership of this socket.  The pool listen pointer is
+       non-NULL when the socket was registered with nx_tcp_server_socket_pool_listen.
+       The pool next pointer links the socket on the pool's free or ready list.  */
+    struct NX_TCP_LISTEN_STRUCT
+        *nx_tcp_socket_pool_listen;
+    struct NX_TCP_SOCKET_STRUCT
+        *nx_tcp_socket_pool_next;
+    UINT nx_tcp_socket_pool_state;
+#endif /* NX_ENABLE_TCP_ACCEPT_POOL */
+
     /* Define the TCP socket bind suspension thread pointer.  This pointer points
        to the thread that that is suspended attempting to bind to a port that is
        already bound to another socket.  */
@@ -1244,12 +1658,88 @@ typedef struct NX_TCP_LISTEN_STRUCT
     NX_PACKET *nx_tcp_listen_queue_head,
               *nx_tcp_listen_queue_tail;
 
+#ifdef NX_ENABLE_TCP_ACCEPT_POOL
+    /* Define the accept pool for this listen request.  Free pool sockets are placed in
+       the listen socket slot one at a time with an accept already issued, so an incoming
+       SYN is answered immediately.  Sockets that complete the handshake are queued on the
+       ready list until the application accepts them.  The socket array is supplied by
+       the application and must remain valid until the port is unlistened.  Threads
+       waiting in nx_tcp_server_socket_pool_accept are suspended on the accept
+       suspension list and resumed when a connection is placed on the ready list.  */
+    NX_TCP_SOCKET
+        **nx_tcp_listen_pool_sockets;
+    UINT           nx_tcp_listen_pool_count;
+    NX_TCP_SOCKET *nx_tcp_listen_pool_free_head;
+    NX_TCP_SOCKET *nx_tcp_listen_pool_ready_head,
+                  *nx_tcp_listen_pool_ready_tail;
+    ULONG          nx_tcp_listen_pool_ready_count;
+    TX_THREAD     *nx_tcp_listen_pool_suspension_list;
+#endif /* NX_ENABLE_TCP_ACCEPT_POOL */
+
     /* Define the link between other TCP listen structures created by the application.  */
     struct NX_TCP_LISTEN_STRUCT
         *nx_tcp_listen_next,
         *nx_tcp_listen_previous;
 } NX_TCP_LISTEN;
 
+
+/* Define the TCP socket extended information structure.  This structure is filled
+   in by nx_tcp_socket_extended_info_get with a consistent snapshot of the socket's
+   connection, congestion control and queue state.  All times are in timer ticks.  */
+
+typedef struct NX_TCP_SOCKET_INFO_STRUCT
+{
+
+    /* Connection state and segment sizes.  */
+    ULONG nx_tcp_socket_info_state;
+    ULONG nx_tcp_socket_info_mss;
+    ULONG nx_tcp_socket_info_peer_mss;
+
+    /* Congestion control and window state.  */
+    ULONG nx_tcp_socket_info_congestion_window;
+    ULONG nx_tcp_socket_info_slow_start_threshold;
+    ULONG nx_tcp_socket_info_transmit_window;
+    ULONG nx_tcp_socket_info_receive_window;
+    ULONG nx_tcp_socket_info_fast_recovery;
+
+    /* Round trip time estimate and current retransmit timeout.  */
+    ULONG nx_tcp_socket_info_smoothed_rtt;
+    ULONG nx_tcp_socket_info_rtt_variance;
+    ULONG nx_tcp_socket_info_retransmit_timeout;
+
+    /* Traffic counters.  */
+    ULONG nx_tcp_socket_info_packets_sent;
+    ULONG nx_tcp_socket_info_bytes_sent;
+    ULONG nx_tcp_socket_info_packets_received;
+    ULONG nx_tcp_socket_info_bytes_received;
+    ULONG nx_tcp_socket_info_checksum_errors;
+
+    /* Retransmissions, broken down by cause.  */
+    ULONG nx_tcp_socket_info_retransmit_packets;
+    ULONG nx_tcp_socket_info_retransmit_timeouts;
+    ULONG nx_tcp_socket_info_fast_retransmits;
+    ULONG nx_tcp_socket_info_rack_retransmits;
+    ULONG nx_tcp_socket_info_tail_loss_probes;
+
+    /* Duplicate ACKs, currently outstanding and total.  */
+    ULONG nx_tcp_socket_info_duplicated_acks_current;
+    ULONG nx_tcp_socket_info_duplicated_acks;
+
+    /* Zero window events.  */
+    ULONG nx_tcp_socket_info_zero_window_probes;
+    ULONG nx_tcp_socket_info_zero_window_received;
+
+    /* Transmit (sent but unacknowledged) queue.  */
+    ULONG nx_tcp_socket_info_transmit_queue_packets;
+    ULONG nx_tcp_socket_info_transmit_queue_bytes;
+
+    /* Receive queue, split into in-order and out-of-order data.  */
+    ULONG nx_tcp_socket_info_receive_queue_packets;
+    ULONG nx_tcp_socket_info_receive_queue_bytes;
+    ULONG nx_tcp_socket_info_out_of_order_packets;
+    ULONG nx_tcp_socket_info_out_of_order_bytes;
+} NX_TCP_SOCKET_INFO;
+
 struct NX_IP_DRIVER_STRUCT;
 
 /* There should be at least one physical interface. */
@@ -1329,6 +1819,12 @@ typedef struct NX_INTERFACE_STRUCT
        pointer results in NetX calling it when an IP address is found in an incoming
        ARP packet that matches that of nx_interface_ip_probe_address.  */
     VOID        (*nx_interface_ip_conflict_notify_handler)(struct NX_IP_STRUCT *, UINT, ULONG, ULONG, ULONG);
+
+#ifdef NX_ENABLE_DRIVER_TRANSMIT_MORE
+    /* Define the flag that indicates the last packet given to the link driver was
+       sent with the transmit more hint, so the driver may be holding it.  */
+    UINT nx_interface_transmit_pending;
+#endif /* NX_ENABLE_DRIVER_TRANSMIT_MORE */
 } NX_INTERFACE;
 
 #ifdef NX_ENABLE_IP_STATIC_ROUTING
@@ -1347,12 +1843,152 @@ typedef struct NX_IP_ROUTING_ENTRY_STRUCT
     struct NX_INTERFACE_STRUCT
         *nx_ip_routing_entry_ip_interface;
 } NX_IP_ROUTING_ENTRY;
+
+#ifdef NX_ENABLE_IP_STATIC_ROUTE_TRIE
+/* Define the static routing trie node structure.  Prefixes that end inside a node are
+   expanded to every slot they cover, with longer prefixes taking precedence.  */
+typedef struct NX_IP_ROUTING_TRIE_NODE_STRUCT
+{
+    /* Index of the child node for each slot, zero if none.  The root is node zero.  */
+    USHORT nx_ip_routing_trie_node_child[NX_IP_ROUTING_TRIE_FANOUT];
+
+    /* Index plus one of the routing table entry for each slot, zero if none.  */
+    USHORT nx_ip_routing_trie_node_route[NX_IP_ROUTING_TRIE_FANOUT];
+} NX_IP_ROUTING_TRIE_NODE;
+#endif /* NX_ENABLE_IP_STATIC_ROUTE_TRIE */
 #endif /*  NX_ENABLE_IP_STATIC_ROUTING */
 
 
+#ifdef NX_ENABLE_IP_RECEIVE_QUEUES
+/* Define the IP receive queue.  Deferred IP packets are steered onto one of the receive
+   queues by a hash of their flow, and each queue is drained by its own receive thread,
+   so packets of the same flow are always processed in order.  */
+
+typedef struct NX_IP_RECEIVE_QUEUE_STRUCT
+{
+
+    /* Define the IP instance this queue belongs to.  */
+    struct NX_IP_STRUCT
+              *nx_ip_receive_queue_ip;
+
+    /* Define the list of packets waiting to be processed.  */
+    NX_PACKET *nx_ip_receive_queue_head,
+              *nx_ip_receive_queue_tail;
+
+    /* Define the number of packets processed by this queue.  */
+    ULONG      nx_ip_receive_queue_packets;
+
+    /* Define the semaphore used to wakeup the receive thread, and the thread itself.  */
+    TX_SEMAPHORE
+               nx_ip_receive_queue_semaphore;
+    TX_THREAD  nx_ip_receive_queue_thread;
+} NX_IP_RECEIVE_QUEUE;
+#endif /* NX_ENABLE_IP_RECEIVE_QUEUES */
+
+
 /* Define the Internet Protocol (IP) structure.  Any number of IP instances
    may be used by the application.  */
 
+#ifdef NX_ENABLE_EPHEMERAL_PORT_BITMAP
+/* Define the ephemeral port bitmap.  There is one bit per port from NX_SEARCH_PORT_START
+   through NX_MAX_PORT, set while at least one socket is bound to the port.  The full
+   array has one bit per word of the used array, set when every port of that word is in
+   use, so a free port is found without visiting each bound socket.  */
+
+typedef struct NX_PORT_BITMAP_STRUCT
+{
+
+    ULONG nx_port_bitmap_used[NX_PORT_BITMAP_WORDS];
+    ULONG nx_port_bitmap_full[NX_PORT_BITMAP_GROUPS];
+} NX_PORT_BITMAP;
+#endif /* NX_ENABLE_EPHEMERAL_PORT_BITMAP */
+
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH
+/* Define the IP fragment re-assembly context.  One context holds the fragments of a
+   datagram, ordered by offset and never overlapping, so the datagram is complete once
+   the last fragment has been seen and the received length equals the total length.  */
+
+typedef struct NX_IP_FRAGMENT_CONTEXT_STRUCT
+{
+
+    /* Define the fields that identify the datagram.  The ID is in the upper 16 bits of the
+       ID/protocol field and the protocol is in the lower bits.  */
+    ULONG       nx_ip_fragment_context_source_ip;
+    ULONG       nx_ip_fragment_context_destination_ip;
+    ULONG       nx_ip_fragment_context_id_protocol;
+
+    /* Define the ordered list of fragments, linked through nx_packet_fragment_next.  A NULL
+       head indicates the context is free.  */
+    NX_PACKET  *nx_ip_fragment_context_head;
+    NX_PACKET  *nx_ip_fragment_context_tail;
+
+    /* Define the length of the datagram data, which is zero until the last fragment has
+       been received, and the length of the data received so far.  */
+    ULONG       nx_ip_fragment_context_total_length;
+    ULONG       nx_ip_fragment_context_received_length;
+
+    /* Define the number of fragments held and the remaining lifetime of the context.  */
+    UINT        nx_ip_fragment_context_count;
+    UINT        nx_ip_fragment_context_timeout;
+
+    /* Define the next context in the same hash bucket.  */
+    struct NX_IP_FRAGMENT_CONTEXT_STRUCT
+               *nx_ip_fragment_context_next;
+} NX_IP_FRAGMENT_CONTEXT;
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH */
+
+
+/* Define the IP packet filter rule.  A received packet matches a rule when all of its fields
+   match, where a zero mask, protocol, port range, TCP flags mask or interface matches anything.
+   Rules are evaluated in order and the action of the first matching rule is taken.  A rate
+   limited rule accepts matching packets up to the specified rate and drops the rest.
+   nx_ip_packet_filter_rules_set normalizes the rule array in place and the receive path keeps
+   using it, so the array must remain valid and must not be modified by the application until
+   other rules are installed.  Only the match counts may be read in the meantime.  */
+
+typedef struct NX_IP_PACKET_FILTER_RULE_STRUCT
+{
+
+    /* Define the address fields, compared under their masks.  */
+    ULONG       nx_ip_packet_filter_rule_source_ip;
+    ULONG       nx_ip_packet_filter_rule_source_mask;
+    ULONG       nx_ip_packet_filter_rule_destination_ip;
+    ULONG       nx_ip_packet_filter_rule_destination_mask;
+
+    /* Define the protocol, in the form of NX_IP_TCP, NX_IP_UDP or NX_IP_ICMP.  */
+    ULONG       nx_ip_packet_filter_rule_protocol;
+
+    /* Define the inclusive TCP or UDP port ranges.  A high port of zero means no limit.  */
+    USHORT      nx_ip_packet_filter_rule_source_port_low;
+    USHORT      nx_ip_packet_filter_rule_source_port_high;
+    USHORT      nx_ip_packet_filter_rule_destination_port_low;
+    USHORT      nx_ip_packet_filter_rule_destination_port_high;
+
+    /* Define the TCP flags, matched when (flags & mask) equals the value.  */
+    UCHAR       nx_ip_packet_filter_rule_tcp_flags_mask;
+    UCHAR       nx_ip_packet_filter_rule_tcp_flags_value;
+
+    /* Define whether the rule needs the TCP or UDP header, set when the rules are installed.  */
+    UCHAR       nx_ip_packet_filter_rule_transport;
+    UCHAR       nx_ip_packet_filter_rule_reserved;
+
+    /* Define the interface the packet must be received on.  */
+    struct NX_INTERFACE_STRUCT
+               *nx_ip_packet_filter_rule_interface;
+
+    /* Define the action, and for rate limited rules the packets per second and the burst.  */
+    UINT        nx_ip_packet_filter_rule_action;
+    ULONG       nx_ip_packet_filter_rule_rate;
+    ULONG       nx_ip_packet_filter_rule_burst;
+
+    /* Define the token bucket of a rate limited rule, in units of 1/NX_IP_PERIODIC_RATE
+       packets, the time it was last filled, and the number of packets that matched.  */
+    ULONG       nx_ip_packet_filter_rule_tokens;
+    ULONG       nx_ip_packet_filter_rule_time;
+    ULONG       nx_ip_packet_filter_rule_matches;
+} NX_IP_PACKET_FILTER_RULE;
+
+
 typedef struct NX_IP_STRUCT
 {
 
@@ -1465,6 +2101,26 @@ typedef struct NX_IP_STRUCT
     /* Define the packet ID.  */
     ULONG nx_ip_packet_id;
 
+#ifdef NX_ENABLE_DRIVER_TRANSMIT_MORE
+    /* Define the transmit burst nesting count.  While non-zero, packets are handed to the
+       link driver with the transmit more hint set.  */
+    UINT  nx_ip_transmit_burst;
+#endif /* NX_ENABLE_DRIVER_TRANSMIT_MORE */
+
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+    /* Define the generation of routes held in destination caches.  It changes whenever
+       the routing table, gateway or interface addresses change.  */
+    ULONG nx_ip_destination_cache_generation;
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
+
+#ifdef NX_ENABLE_IP_PATH_MTU_DISCOVERY
+    /* Define the path MTU cache and its generation, which changes whenever an entry is
+       added, lowered or expires.  */
+    NX_IP_PATH_MTU
+          nx_ip_path_mtu_cache[NX_IP_PATH_MTU_CACHE_SIZE];
+    ULONG nx_ip_path_mtu_generation;
+#endif /* NX_ENABLE_IP_PATH_MTU_DISCOVERY */
+
     /* Define the default packet pool.  */
     struct NX_PACKET_POOL_STRUCT
         *nx_ip_default_packet_pool;
@@ -1489,6 +2145,14 @@ typedef struct NX_IP_STRUCT
     NX_PACKET *nx_ip_deferred_received_packet_head,
               *nx_ip_deferred_received_packet_tail;
 
+#ifdef NX_ENABLE_IP_RECEIVE_QUEUES
+    /* Define the receive queues.  While the active count is zero, deferred packets are
+       processed by the IP helper thread.  */
+    NX_IP_RECEIVE_QUEUE
+               nx_ip_receive_queues[NX_IP_RECEIVE_QUEUES];
+    UINT       nx_ip_receive_queues_active;
+#endif /* NX_ENABLE_IP_RECEIVE_QUEUES */
+
     /* Define the raw IP function pointer that also indicates whether or
        not raw IP packet sending and receiving is enabled.  */
     VOID (*nx_ip_raw_ip_processing)(struct NX_IP_STRUCT *, NX_PACKET *);
@@ -1542,10 +2206,36 @@ typedef struct NX_IP_STRUCT
     NX_PACKET *nx_ip_fragment_assembly_head,
               *nx_ip_fragment_assembly_tail;
 
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH
+    /* Define the fragment re-assembly contexts and the hash table used to find the context
+       of a received fragment.  */
+    NX_IP_FRAGMENT_CONTEXT
+               nx_ip_fragment_contexts[NX_IP_FRAGMENT_MAX_DATAGRAMS];
+    NX_IP_FRAGMENT_CONTEXT
+              *nx_ip_fragment_hash_table[NX_IP_FRAGMENT_HASH_SIZE];
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH */
+
     /* Define the IP address change notification callback routine pointer.  */
     VOID  (*nx_ip_address_change_notify)(struct NX_IP_STRUCT *, VOID *);
     VOID *nx_ip_address_change_notify_additional_info;
 
+#ifdef NX_ENABLE_IGMP_GROUP_TABLE
+    /* Define the IGMP group hash table and its mask, the list of free group entries
+       and the list of joined groups.  */
+    NX_IGMP_GROUP
+        **nx_ip_igmp_group_table;
+    ULONG nx_ip_igmp_group_table_mask;
+    NX_IGMP_GROUP
+         *nx_ip_igmp_group_free_list;
+    NX_IGMP_GROUP
+         *nx_ip_igmp_group_list;
+
+    /* Define the IGMP report timer wheel.  Each slot lists the groups whose report is
+       due on a tick that maps to the slot.  The tick advances once a second.  */
+    NX_IGMP_GROUP
+         *nx_ip_igmp_timer_wheel[NX_IGMP_TIMER_WHEEL_SIZE];
+    ULONG nx_ip_igmp_timer_tick;
+#else
     /* Define the IGMP registered group list.  */
     ULONG nx_ip_igmp_join_list[NX_MAX_MULTICAST_GROUPS];
 
@@ -1561,6 +2251,7 @@ typedef struct NX_IP_STRUCT
     /* Define the IGMP loopback flag list. This flag is set based on the global
        loopback enable at the time the group was joined. */
     UINT nx_ip_igmp_group_loopback_enable[NX_MAX_MULTICAST_GROUPS];
+#endif /* NX_ENABLE_IGMP_GROUP_TABLE */
 
     /* Define global IGMP loopback enable/disable flag. By default, IGMP loopback is
        disabled.  */
@@ -1606,6 +2297,14 @@ typedef struct NX_IP_STRUCT
     struct NX_UDP_SOCKET_STRUCT
         *nx_ip_udp_port_table[NX_UDP_PORT_TABLE_SIZE];
 
+#ifdef NX_ENABLE_UDP_FLOW_DEMUX
+    /* Define the table of bound connected UDP sockets, hashed on the local port and the
+       peer address and port, and the number of sockets in it.  */
+    struct NX_UDP_SOCKET_STRUCT
+        *nx_ip_udp_connected_table[NX_UDP_CONNECTED_TABLE_SIZE];
+    ULONG nx_ip_udp_connected_count;
+#endif /* NX_ENABLE_UDP_FLOW_DEMUX */
+
     /* Define the head pointer of the created UDP socket list.  */
     struct NX_UDP_SOCKET_STRUCT
         *nx_ip_udp_created_sockets_ptr;
@@ -1613,6 +2312,11 @@ typedef struct NX_IP_STRUCT
     /* Define the number of created UDP socket instances.  */
     ULONG nx_ip_udp_created_sockets_count;
 
+#ifdef NX_ENABLE_EPHEMERAL_PORT_BITMAP
+    /* Define the bitmap of UDP ports in use in the ephemeral range.  */
+    NX_PORT_BITMAP nx_ip_udp_port_bitmap;
+#endif /* NX_ENABLE_EPHEMERAL_PORT_BITMAP */
+
     /* Define the UDP packet receive routine.  This also doubles as a
        mechanism to make sure UDP is enabled.  If this function is NULL, UDP
        is not enabled.  */
@@ -1629,6 +2333,11 @@ typedef struct NX_IP_STRUCT
     /* Define the number of created TCP socket instances.  */
     ULONG nx_ip_tcp_created_sockets_count;
 
+#ifdef NX_ENABLE_EPHEMERAL_PORT_BITMAP
+    /* Define the bitmap of TCP ports in use in the ephemeral range.  */
+    NX_PORT_BITMAP nx_ip_tcp_port_bitmap;
+#endif /* NX_ENABLE_EPHEMERAL_PORT_BITMAP */
+
     /* Define the TCP packet receive routine.  This also doubles as a
        mechanism to make sure TCP is enabled.  If this function is NULL, TCP
        is not enabled.  */
@@ -1672,7 +2381,7 @@ typedef struct NX_IP_STRUCT
     /* Define the destination routing information associated with this IP
        instance.  */
     struct NX_ARP_STRUCT
-        *nx_ip_arp_table[NX_ROUTE_TABLE_SIZE];
+        *nx_ip_arp_table[NX_ARP_TABLE_SIZE];
 
     /* Define the head pointer of the static ARP list.  */
     struct NX_ARP_STRUCT
@@ -1685,6 +2394,23 @@ typedef struct NX_IP_STRUCT
     /* Define the number of dynamic entries that are active.  */
     ULONG nx_ip_arp_dynamic_active_count;
 
+#ifdef NX_ENABLE_ARP_QUEUE_BUDGET
+    /* Define the number of bytes queued on all ARP entries waiting for address resolution,
+       and the list and number of ARP entries that have packets queued.  */
+    ULONG nx_ip_arp_queue_bytes;
+    struct NX_ARP_STRUCT
+         *nx_ip_arp_queue_list;
+    ULONG nx_ip_arp_queue_entries;
+#endif /* NX_ENABLE_ARP_QUEUE_BUDGET */
+
+#ifdef NX_ENABLE_ARP_TIMER_WHEEL
+    /* Define the ARP timer wheel.  Each slot lists the ARP entries whose next update
+       is due on a tick that maps to the slot.  The tick advances once a second.  */
+    struct NX_ARP_STRUCT
+        *nx_ip_arp_timer_wheel[NX_ARP_TIMER_WHEEL_SIZE];
+    ULONG nx_ip_arp_timer_tick;
+#endif /* NX_ENABLE_ARP_TIMER_WHEEL */
+
     /* Define the ARP deferred packet processing queue.  This is used to
        process ARP packets not initially processed in the receive ISR.  */
     NX_PACKET *nx_ip_arp_deferred_received_packet_head,
@@ -1760,6 +2486,14 @@ typedef struct NX_IP_STRUCT
 
     ULONG               nx_ip_routing_table_entry_count;
 
+#ifdef NX_ENABLE_IP_STATIC_ROUTE_TRIE
+    /* Define the longest prefix match trie built over the routing table.  */
+    NX_IP_ROUTING_TRIE_NODE
+                        nx_ip_routing_trie[NX_IP_ROUTING_TRIE_NODES];
+
+    ULONG               nx_ip_routing_trie_node_count;
+#endif /* NX_ENABLE_IP_STATIC_ROUTE_TRIE */
+
 #endif /*  NX_ENABLE_IP_STATIC_ROUTING */
 
     /* Define the link status change notify routine. */
@@ -1768,6 +2502,16 @@ typedef struct NX_IP_STRUCT
 #ifdef NX_ENABLE_IP_PACKET_FILTER
     /* Define the IP packet filter routine.  */
     UINT        (*nx_ip_packet_filter)(VOID *, UINT);
+
+    /* Define the installed packet filter rules, compiled into a table per protocol class that
+       lists, in order, the rules able to match packets of that class.  The rules are checked
+       while enabled, which is also the case with no rules and a default action of drop.  */
+    NX_IP_PACKET_FILTER_RULE
+                *nx_ip_packet_filter_rules;
+    UINT         nx_ip_packet_filter_rules_enabled;
+    UINT         nx_ip_packet_filter_default_action;
+    UCHAR        nx_ip_packet_filter_class_count[NX_IP_PACKET_FILTER_CLASSES];
+    UCHAR        nx_ip_packet_filter_class_table[NX_IP_PACKET_FILTER_CLASSES][NX_IP_PACKET_FILTER_MAX_RULES];
 #endif /* NX_ENABLE_IP_PACKET_FILTER */
 } NX_IP;
 
@@ -1798,6 +2542,14 @@ typedef struct NX_IP_DRIVER_STRUCT
                  *nx_ip_driver_ptr;
 
     NX_INTERFACE *nx_ip_driver_interface;
+
+#ifdef NX_ENABLE_DRIVER_TRANSMIT_MORE
+    /* Define the transmit more hint of NX_LINK_PACKET_SEND and NX_LINK_PACKET_BROADCAST
+       requests.  When set, more packets follow immediately and the driver may defer
+       starting the transmission until a request with the hint cleared, any other send
+       request, or an NX_LINK_PACKET_FLUSH request.  */
+    UINT          nx_ip_driver_transmit_more;
+#endif /* NX_ENABLE_DRIVER_TRANSMIT_MORE */
 } NX_IP_DRIVER;
 
 
@@ -1834,6 +2586,7 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_icmp_ping                                    _nx_icmp_ping
 
 #define nx_igmp_enable                                  _nx_igmp_enable
+#define nx_igmp_group_table_enable                      _nx_igmp_group_table_enable
 #define nx_igmp_info_get                                _nx_igmp_info_get
 #define nx_igmp_loopback_disable                        _nx_igmp_loopback_disable
 #define nx_igmp_loopback_enable                         _nx_igmp_loopback_enable
@@ -1864,6 +2617,8 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_ip_raw_packet_receive                        _nx_ip_raw_packet_receive
 #define nx_ip_raw_packet_send                           _nx_ip_raw_packet_send
 #define nx_ip_raw_packet_interface_send                 _nx_ip_raw_packet_interface_send
+#define nx_ip_packet_filter_rules_set                   _nx_ip_packet_filter_rules_set
+#define nx_ip_receive_queues_create                     _nx_ip_receive_queues_create
 #define nx_ip_static_route_add                          _nx_ip_static_route_add
 #define nx_ip_static_route_delete                       _nx_ip_static_route_delete
 #define nx_ip_status_check                              _nx_ip_status_check
@@ -1896,6 +2651,9 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_tcp_info_get                                 _nx_tcp_info_get
 #define nx_tcp_server_socket_accept                     _nx_tcp_server_socket_accept
 #define nx_tcp_server_socket_listen                     _nx_tcp_server_socket_listen
+#define nx_tcp_server_socket_pool_accept                _nx_tcp_server_socket_pool_accept
+#define nx_tcp_server_socket_pool_listen                _nx_tcp_server_socket_pool_listen
+#define nx_tcp_server_socket_pool_release               _nx_tcp_server_socket_pool_release
 #define nx_tcp_server_socket_relisten                   _nx_tcp_server_socket_relisten
 #define nx_tcp_server_socket_unaccept                   _nx_tcp_server_socket_unaccept
 #define nx_tcp_server_socket_unlisten                   _nx_tcp_server_socket_unlisten
@@ -1909,6 +2667,7 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_tcp_socket_timed_wait_callback               _nx_tcp_socket_timed_wait_callback
 #endif
 #define nx_tcp_socket_info_get                          _nx_tcp_socket_info_get
+#define nx_tcp_socket_extended_info_get                 _nx_tcp_socket_extended_info_get
 #define nx_tcp_socket_mss_get                           _nx_tcp_socket_mss_get
 #define nx_tcp_socket_mss_peer_get                      _nx_tcp_socket_mss_peer_get
 #define nx_tcp_socket_mss_set                           _nx_tcp_socket_mss_set
@@ -1928,14 +2687,22 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_udp_socket_bytes_available                   _nx_udp_socket_bytes_available
 #define nx_udp_socket_checksum_disable                  _nx_udp_socket_checksum_disable
 #define nx_udp_socket_checksum_enable                   _nx_udp_socket_checksum_enable
+#define nx_udp_socket_connect                           _nx_udp_socket_connect
 #define nx_udp_socket_create                            _nx_udp_socket_create
 #define nx_udp_socket_delete                            _nx_udp_socket_delete
+#define nx_udp_socket_drop_info_get                     _nx_udp_socket_drop_info_get
+#define nx_udp_socket_drop_notify                       _nx_udp_socket_drop_notify
 #define nx_udp_socket_info_get                          _nx_udp_socket_info_get
 #define nx_udp_socket_interface_send                    _nx_udp_socket_interface_send
 #define nx_udp_socket_port_get                          _nx_udp_socket_port_get
+#define nx_udp_socket_port_share_enable                 _nx_udp_socket_port_share_enable
 #define nx_udp_socket_receive                           _nx_udp_socket_receive
+#define nx_udp_socket_receive_batch                     _nx_udp_socket_receive_batch
+#define nx_udp_socket_receive_buffer_set                _nx_udp_socket_receive_buffer_set
 #define nx_udp_socket_receive_notify                    _nx_udp_socket_receive_notify
+#define nx_udp_socket_segment_send                      _nx_udp_socket_segment_send
 #define nx_udp_socket_send                              _nx_udp_socket_send
+#define nx_udp_socket_send_batch                        _nx_udp_socket_send_batch
 #define nx_udp_socket_unbind                            _nx_udp_socket_unbind
 #define nx_udp_source_extract                           _nx_udp_source_extract
 
@@ -1959,6 +2726,7 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_icmp_ping                                    _nxe_icmp_ping
 
 #define nx_igmp_enable                                  _nxe_igmp_enable
+#define nx_igmp_group_table_enable                      _nxe_igmp_group_table_enable
 #define nx_igmp_info_get                                _nxe_igmp_info_get
 #define nx_igmp_loopback_disable                        _nxe_igmp_loopback_disable
 #define nx_igmp_loopback_enable                         _nxe_igmp_loopback_enable
@@ -1989,6 +2757,8 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_ip_raw_packet_receive                        _nxe_ip_raw_packet_receive
 #define nx_ip_raw_packet_send(i, p, d, t)               _nxe_ip_raw_packet_send(i, &p, d, t)
 #define nx_ip_raw_packet_interface_send(i, p, d, f, t)  _nxe_ip_raw_packet_interface_send(i, &p, d, f, t)
+#define nx_ip_packet_filter_rules_set                   _nxe_ip_packet_filter_rules_set
+#define nx_ip_receive_queues_create                     _nxe_ip_receive_queues_create
 #define nx_ip_static_route_add                          _nxe_ip_static_route_add
 #define nx_ip_static_route_delete                       _nxe_ip_static_route_delete
 
@@ -2022,6 +2792,9 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_tcp_info_get                                 _nxe_tcp_info_get
 #define nx_tcp_server_socket_accept                     _nxe_tcp_server_socket_accept
 #define nx_tcp_server_socket_listen                     _nxe_tcp_server_socket_listen
+#define nx_tcp_server_socket_pool_accept                _nxe_tcp_server_socket_pool_accept
+#define nx_tcp_server_socket_pool_listen                _nxe_tcp_server_socket_pool_listen
+#define nx_tcp_server_socket_pool_release               _nxe_tcp_server_socket_pool_release
 #define nx_tcp_server_socket_relisten                   _nxe_tcp_server_socket_relisten
 #define nx_tcp_server_socket_unaccept                   _nxe_tcp_server_socket_unaccept
 #define nx_tcp_server_socket_unlisten                   _nxe_tcp_server_socket_unlisten
@@ -2035,6 +2808,7 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_tcp_socket_timed_wait_callback               _nxe_tcp_socket_timed_wait_callback
 #endif
 #define nx_tcp_socket_info_get                          _nxe_tcp_socket_info_get
+#define nx_tcp_socket_extended_info_get                 _nxe_tcp_socket_extended_info_get
 #define nx_tcp_socket_mss_get                           _nxe_tcp_socket_mss_get
 #define nx_tcp_socket_mss_peer_get                      _nxe_tcp_socket_mss_peer_get
 #define nx_tcp_socket_mss_set                           _nxe_tcp_socket_mss_set
@@ -2054,14 +2828,22 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_udp_socket_bytes_available                   _nxe_udp_socket_bytes_available
 #define nx_udp_socket_checksum_disable                  _nxe_udp_socket_checksum_disable
 #define nx_udp_socket_checksum_enable                   _nxe_udp_socket_checksum_enable
+#define nx_udp_socket_connect                           _nxe_udp_socket_connect
 #define nx_udp_socket_create(i, s, n, t, f, l, q)       _nxe_udp_socket_create(i, s, n, t, f, l, q, sizeof(NX_UDP_SOCKET))
 #define nx_udp_socket_delete                            _nxe_udp_socket_delete
+#define nx_udp_socket_drop_info_get                     _nxe_udp_socket_drop_info_get
+#define nx_udp_socket_drop_notify                       _nxe_udp_socket_drop_notify
 #define nx_udp_socket_info_get                          _nxe_udp_socket_info_get
 #define nx_udp_socket_interface_send(s, p, i, t, a)     _nxe_udp_socket_interface_send(s, &p, i, t, a)
 #define nx_udp_socket_port_get                          _nxe_udp_socket_port_get
+#define nx_udp_socket_port_share_enable                 _nxe_udp_socket_port_share_enable
 #define nx_udp_socket_receive                           _nxe_udp_socket_receive
+#define nx_udp_socket_receive_batch                     _nxe_udp_socket_receive_batch
+#define nx_udp_socket_receive_buffer_set                _nxe_udp_socket_receive_buffer_set
 #define nx_udp_socket_receive_notify                    _nxe_udp_socket_receive_notify
+#define nx_udp_socket_segment_send(s, p, i, t, z, w)    _nxe_udp_socket_segment_send(s, &p, i, t, z, w)
 #define nx_udp_socket_send(s, p, i, t)                  _nxe_udp_socket_send(s, &p, i, t)
+#define nx_udp_socket_send_batch                        _nxe_udp_socket_send_batch
 #define nx_udp_socket_unbind                            _nxe_udp_socket_unbind
 #define nx_udp_source_extract                           _nxe_udp_source_extract
 
@@ -2098,6 +2880,7 @@ UINT nx_icmp_ping(NX_IP *ip_ptr, ULONG ip_address, CHAR *data, ULONG data_size,
                   NX_PACKET **response_ptr, ULONG wait_option);
 
 UINT nx_igmp_enable(NX_IP *ip_ptr);
+UINT nx_igmp_group_table_enable(NX_IP *ip_ptr, VOID *table_memory, ULONG table_size);
 UINT nx_igmp_info_get(NX_IP *ip_ptr, ULONG *igmp_reports_sent, ULONG *igmp_queries_received,
                       ULONG *igmp_checksum_errors, ULONG *current_groups_joined);
 UINT nx_igmp_loopback_disable(NX_IP *ip_ptr);
@@ -2156,6 +2939,8 @@ UINT _nx_ip_raw_packet_send(NX_IP *ip_ptr, NX_PACKET *packet_ptr,
 UINT _nx_ip_raw_packet_interface_send(NX_IP *ip_ptr, NX_PACKET *packet_ptr,
                                       ULONG destination_ip, UINT interface_index, ULONG type_of_service);
 #endif
+UINT nx_ip_packet_filter_rules_set(NX_IP *ip_ptr, NX_IP_PACKET_FILTER_RULE *rule_array, UINT rule_count, UINT default_action);
+UINT nx_ip_receive_queues_create(NX_IP *ip_ptr, VOID *stack_ptr, ULONG stack_size, UINT priority);
 UINT nx_ip_static_route_add(NX_IP *ip_ptr, ULONG network_address, ULONG net_mask, ULONG next_hop);
 UINT nx_ip_static_route_delete(NX_IP *ip_ptr, ULONG network_address, ULONG net_mask);
 UINT nx_ip_status_check(NX_IP *ip_ptr, ULONG needed_status, ULONG *actual_status,
@@ -2214,6 +2999,11 @@ UINT nx_tcp_info_get(NX_IP *ip_ptr, ULONG *tcp_packets_sent, ULONG *tcp_bytes_se
 UINT nx_tcp_server_socket_accept(NX_TCP_SOCKET *socket_ptr, ULONG wait_option);
 UINT nx_tcp_server_socket_listen(NX_IP *ip_ptr, UINT port, NX_TCP_SOCKET *socket_ptr, UINT listen_queue_size,
                                  VOID (*tcp_listen_callback)(NX_TCP_SOCKET *socket_ptr, UINT port));
+UINT nx_tcp_server_socket_pool_accept(NX_IP *ip_ptr, UINT port, NX_TCP_SOCKET **socket_array, UINT array_size,
+                                      UINT *accepted_count, ULONG wait_option);
+UINT nx_tcp_server_socket_pool_listen(NX_IP *ip_ptr, UINT port, NX_TCP_SOCKET **socket_array, UINT socket_count,
+                                      UINT listen_queue_size, VOID (*tcp_listen_callback)(NX_TCP_SOCKET *socket_ptr, UINT port));
+UINT nx_tcp_server_socket_pool_release(NX_TCP_SOCKET *socket_ptr);
 UINT nx_tcp_server_socket_relisten(NX_IP *ip_ptr, UINT port, NX_TCP_SOCKET *socket_ptr);
 UINT nx_tcp_server_socket_unaccept(NX_TCP_SOCKET *socket_ptr);
 UINT nx_tcp_server_socket_unlisten(NX_IP *ip_ptr, UINT port);
@@ -2244,6 +3034,7 @@ UINT nx_tcp_socket_info_get(NX_TCP_SOCKET *socket_ptr, ULONG *tcp_packets_sent,
                             ULONG *tcp_checksum_errors, ULONG *tcp_socket_state,
                             ULONG *tcp_transmit_queue_depth, ULONG *tcp_transmit_window,
                             ULONG *tcp_receive_window);
+UINT nx_tcp_socket_extended_info_get(NX_TCP_SOCKET *socket_ptr, NX_TCP_SOCKET_INFO *info_ptr);
 UINT nx_tcp_socket_mss_get(NX_TCP_SOCKET *socket_ptr, ULONG *mss);
 UINT nx_tcp_socket_mss_peer_get(NX_TCP_SOCKET *socket_ptr, ULONG *peer_mss);
 UINT nx_tcp_socket_mss_set(NX_TCP_SOCKET *socket_ptr, ULONG mss);
@@ -2272,6 +3063,7 @@ UINT nx_udp_socket_bind(NX_UDP_SOCKET *socket_ptr, UINT  port, ULONG wait_option
 UINT nx_udp_socket_bytes_available(NX_UDP_SOCKET *socket_ptr, ULONG *bytes_available);
 UINT nx_udp_socket_checksum_disable(NX_UDP_SOCKET *socket_ptr);
 UINT nx_udp_socket_checksum_enable(NX_UDP_SOCKET *socket_ptr);
+UINT nx_udp_socket_connect(NX_UDP_SOCKET *socket_ptr, ULONG ip_address, UINT port);
 #ifndef NX_DISABLE_ERROR_CHECKING
 UINT _nxe_udp_socket_create(NX_IP *ip_ptr, NX_UDP_SOCKET *socket_ptr, CHAR *name,
                             ULONG type_of_service, ULONG fragment, UINT time_to_live, ULONG queue_maximum, UINT udp_socket_size);
@@ -2284,21 +3076,38 @@ UINT _nx_udp_socket_interface_send(NX_UDP_SOCKET *socket_ptr, NX_PACKET *packet_
 
 #endif
 UINT nx_udp_socket_delete(NX_UDP_SOCKET *socket_ptr);
+UINT nx_udp_socket_drop_info_get(NX_UDP_SOCKET *socket_ptr, ULONG *queue_full_drops, ULONG *no_buffer_drops,
+                                 ULONG *checksum_drops);
+UINT nx_udp_socket_drop_notify(NX_UDP_SOCKET *socket_ptr, ULONG threshold, ULONG period,
+                               VOID (*drop_notify)(NX_UDP_SOCKET *socket_ptr, ULONG drops));
 UINT nx_udp_socket_info_get(NX_UDP_SOCKET *socket_ptr, ULONG *udp_packets_sent, ULONG *udp_bytes_sent,
                             ULONG *udp_packets_received, ULONG *udp_bytes_received, ULONG *udp_packets_queued,
                             ULONG *udp_receive_packets_dropped, ULONG *udp_checksum_errors);
 UINT nx_udp_socket_port_get(NX_UDP_SOCKET *socket_ptr, UINT *port_ptr);
+UINT nx_udp_socket_port_share_enable(NX_UDP_SOCKET *socket_ptr);
 UINT nx_udp_socket_receive(NX_UDP_SOCKET *socket_ptr, NX_PACKET **packet_ptr,
                            ULONG wait_option);
+UINT nx_udp_socket_receive_batch(NX_UDP_SOCKET *socket_ptr, NX_PACKET **packet_array, UINT array_size,
+                                 UINT *received_count, ULONG wait_option);
+UINT nx_udp_socket_receive_buffer_set(NX_UDP_SOCKET *socket_ptr, ULONG maximum_bytes);
 UINT nx_udp_socket_receive_notify(NX_UDP_SOCKET *socket_ptr,
                                   VOID (*udp_receive_notify)(NX_UDP_SOCKET *socket_ptr));
 #ifndef NX_DISABLE_ERROR_CHECKING
+UINT _nxe_udp_socket_segment_send(NX_UDP_SOCKET *socket_ptr, NX_PACKET **packet_ptr_ptr,
+                                  ULONG ip_address, UINT port, ULONG segment_size, ULONG wait_option);
+#else
+UINT _nx_udp_socket_segment_send(NX_UDP_SOCKET *socket_ptr, NX_PACKET *packet_ptr,
+                                 ULONG ip_address, UINT port, ULONG segment_size, ULONG wait_option);
+#endif
+#ifndef NX_DISABLE_ERROR_CHECKING
 UINT _nxe_udp_socket_send(NX_UDP_SOCKET *socket_ptr, NX_PACKET **packet_ptr_ptr,
                           ULONG ip_address, UINT port);
 #else
 UINT _nx_udp_socket_send(NX_UDP_SOCKET *socket_ptr, NX_PACKET *packet_ptr,
                          ULONG ip_address, UINT port);
 #endif
+UINT nx_udp_socket_send_batch(NX_UDP_SOCKET *socket_ptr, NX_UDP_SEND_ENTRY *entry_array, UINT entry_count,
+                              UINT *sent_count);
 UINT nx_udp_socket_unbind(NX_UDP_SOCKET *socket_ptr);
 UINT nx_udp_source_extract(NX_PACKET *packet_ptr, ULONG *ip_address, UINT *port);
 
@@ -2337,13 +3146,29 @@ VOID _nx_ip_driver_deferred_processing(NX_IP *ip_ptr);
 /* Define the deferred NetX receive processing routines.  These routines depend on the
    NetX I/O drive to perform enough processing in the ISR to strip the link protocol
    header and dispatch to the appropriate NetX receive processing.  These routines
-   can also be called from the previously mentioned driver deferred processing.  */
+   can also be called from the previously mentioned driver deferred processing.
+   A driver that collects several IP packets per interrupt can hand them over with
+   _nx_ip_packet_deferred_chain_receive, linked through nx_packet_queue_next, so the
+   whole chain is queued with a single interrupt lockout and IP thread wakeup.  */
 
 VOID _nx_ip_packet_deferred_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
+VOID _nx_ip_packet_deferred_chain_receive(NX_IP *ip_ptr, NX_PACKET *packet_head, NX_PACKET *packet_tail);
 VOID _nx_arp_packet_deferred_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
 VOID _nx_rarp_packet_deferred_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
 
 
+/* Define the flow steered IP receive processing.  Once nx_ip_receive_queues_create has
+   been called, deferred IP packets are spread over several receive threads.  A driver
+   whose hardware computes a flow hash (RSS) can supply it through _nx_ip_packet_flow_receive,
+   otherwise _nx_ip_packet_deferred_receive computes it with _nx_ip_packet_flow_hash.  All
+   packets of a flow must be given the same hash.  */
+
+#ifdef NX_ENABLE_IP_RECEIVE_QUEUES
+ULONG _nx_ip_packet_flow_hash(NX_PACKET *packet_ptr);
+VOID  _nx_ip_packet_flow_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr, ULONG flow_hash);
+#endif /* NX_ENABLE_IP_RECEIVE_QUEUES */
+
+
 /* Define the direct IP packet receive processing.  This is the lowest overhead way
    to notify NetX of a received IP packet, however, it results in the most amount of
    processing in the driver's receive ISR.  If the driver deferred packet processing
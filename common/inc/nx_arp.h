@@ -76,6 +76,43 @@
 #define NX_ARP_MESSAGE_SIZE    28
 
 
+/* Define the hash of an IP address into the ARP table.  The address is multiplied by
+   the 32-bit golden ratio constant and the bucket is taken from the upper half of the
+   product, so addresses that differ only in their low-order bytes spread over the
+   whole table.  */
+
+#define NX_ARP_HASH(a)         ((UINT)((((a) * (ULONG)0x9E3779B1) >> 16) & NX_ARP_TABLE_MASK))
+
+#if ((NX_ARP_TABLE_SIZE) & ((NX_ARP_TABLE_SIZE) - 1)) || (NX_ARP_TABLE_SIZE < 1) || (NX_ARP_TABLE_SIZE > 65536)
+#error "NX_ARP_TABLE_SIZE must be a power of two no larger than 65536"
+#endif
+
+
+/* Define the macro that sets the number of seconds until the next update of an ARP
+   entry.  Zero means no update is pending.  With the timer wheel, the entry is also
+   moved to the wheel slot of its new update time.  */
+
+#ifdef NX_ENABLE_ARP_TIMER_WHEEL
+#if ((NX_ARP_TIMER_WHEEL_SIZE) & ((NX_ARP_TIMER_WHEEL_SIZE) - 1)) || (NX_ARP_TIMER_WHEEL_SIZE < 1)
+#error "NX_ARP_TIMER_WHEEL_SIZE must be a power of two"
+#endif
+
+#define NX_ARP_ENTRY_NEXT_UPDATE_SET(i, a, t)   _nx_arp_entry_timer_set((i), (a), (UINT)(t))
+#else
+#define NX_ARP_ENTRY_NEXT_UPDATE_SET(i, a, t)   ((a) -> nx_arp_entry_next_update = (UINT)(t))
+#endif /* NX_ENABLE_ARP_TIMER_WHEEL */
+
+
+/* Define the macro that accounts for the packets taken off the queue of an ARP entry.  It
+   is invoked with interrupts disabled after the packets waiting pointer is cleared.  */
+
+#ifdef NX_ENABLE_ARP_QUEUE_BUDGET
+#define NX_ARP_ENTRY_PACKETS_CLEARED(i, a)      _nx_arp_entry_queue_remove((i), (a))
+#else
+#define NX_ARP_ENTRY_PACKETS_CLEARED(i, a)
+#endif /* NX_ENABLE_ARP_QUEUE_BUDGET */
+
+
 /* Define the ARP defend interval. The default value is 10 seconds. */
 #ifndef NX_ARP_DEFEND_INTERVAL
 #define NX_ARP_DEFEND_INTERVAL 10
@@ -105,6 +142,11 @@ UINT _nx_arp_static_entry_create(NX_IP *ip_ptr, ULONG ip_address,
 UINT _nx_arp_static_entry_delete(NX_IP *ip_ptr, ULONG ip_address,
                                  ULONG physical_msw, ULONG physical_lsw);
 UINT _nx_arp_entry_allocate(NX_IP *ip_ptr, NX_ARP **arp_ptr);
+VOID _nx_arp_entry_touch(NX_IP *ip_ptr, NX_ARP *arp_entry);
+VOID _nx_arp_entry_expire(NX_IP *ip_ptr, NX_ARP *arp_entry);
+VOID _nx_arp_entry_timer_set(NX_IP *ip_ptr, NX_ARP *arp_entry, UINT next_update);
+VOID _nx_arp_entry_packet_queue(NX_IP *ip_ptr, NX_ARP *arp_entry, NX_PACKET *packet_ptr);
+VOID _nx_arp_entry_queue_remove(NX_IP *ip_ptr, NX_ARP *arp_entry);
 VOID _nx_arp_packet_send(NX_IP *ip_ptr, ULONG destination_ip, NX_INTERFACE *nx_interface);
 VOID _nx_arp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
 VOID _nx_arp_packet_deferred_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
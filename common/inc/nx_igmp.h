@@ -163,9 +163,21 @@ typedef  struct NX_IGMP_HEADER_STRUCT
 #define NX_IGMP_HEADER_SIZE sizeof(NX_IGMP_HEADER)
 
 
+/* Define the hash of a group address into the IGMP group table.  */
+
+#ifdef NX_ENABLE_IGMP_GROUP_TABLE
+#define NX_IGMP_GROUP_HASH(i, a)   ((UINT)((((a) * (ULONG)0x9E3779B1) >> 16) & (i) -> nx_ip_igmp_group_table_mask))
+
+#if ((NX_IGMP_TIMER_WHEEL_SIZE) & ((NX_IGMP_TIMER_WHEEL_SIZE) - 1)) || (NX_IGMP_TIMER_WHEEL_SIZE < 1)
+#error "NX_IGMP_TIMER_WHEEL_SIZE must be a power of two"
+#endif
+#endif /* NX_ENABLE_IGMP_GROUP_TABLE */
+
+
 /* Define IGMP function prototypes.  */
 
 UINT _nx_igmp_enable(NX_IP *ip_ptr);
+UINT _nx_igmp_group_table_enable(NX_IP *ip_ptr, VOID *table_memory, ULONG table_size);
 UINT _nx_igmp_info_get(NX_IP *ip_ptr, ULONG *igmp_reports_sent, ULONG *igmp_queries_received,
                        ULONG *igmp_checksum_errors, ULONG *current_groups_joined);
 UINT _nx_igmp_loopback_disable(NX_IP *ip_ptr);
@@ -180,12 +192,17 @@ VOID _nx_igmp_packet_process(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
 VOID _nx_igmp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
 VOID _nx_igmp_queue_process(NX_IP *ip_ptr);
 UINT _nx_igmp_multicast_check(NX_IP *ip_ptr, ULONG group_address, NX_INTERFACE *nx_interface);
+#ifdef NX_ENABLE_IGMP_GROUP_TABLE
+NX_IGMP_GROUP *_nx_igmp_group_find(NX_IP *ip_ptr, ULONG group_address);
+VOID _nx_igmp_group_timer_set(NX_IP *ip_ptr, NX_IGMP_GROUP *group_ptr, ULONG report_time);
+#endif /* NX_ENABLE_IGMP_GROUP_TABLE */
 
 
 /* Define error checking shells for API services.  These are only referenced by the
    application.  */
 
 UINT _nxe_igmp_enable(NX_IP *ip_ptr);
+UINT _nxe_igmp_group_table_enable(NX_IP *ip_ptr, VOID *table_memory, ULONG table_size);
 UINT _nxe_igmp_info_get(NX_IP *ip_ptr, ULONG *igmp_reports_sent, ULONG *igmp_queries_received,
                         ULONG *igmp_checksum_errors, ULONG *current_groups_joined);
 UINT _nxe_igmp_loopback_disable(NX_IP *ip_ptr);
@@ -73,6 +73,84 @@
 #define NX_IP_OFFSET_MASK            ((ULONG)0x00001FFF)    /* Mask for fragment offset */
 #define NX_IP_ALIGN_FRAGS            8                      /* Fragment alignment       */
 
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH
+#if (NX_IP_FRAGMENT_HASH_SIZE & (NX_IP_FRAGMENT_HASH_SIZE - 1))
+#error "NX_IP_FRAGMENT_HASH_SIZE must be a power of two."
+#endif
+
+/* Define the hash of the fields that identify a fragmented datagram.  */
+
+#define NX_IP_FRAGMENT_HASH_FOLD(h)  ((h) ^ ((h) >> 16) ^ ((h) >> 8))
+#define NX_IP_FRAGMENT_HASH(s, d, k) ((UINT)(NX_IP_FRAGMENT_HASH_FOLD((ULONG)((s) ^ (d) ^ (k))) & (NX_IP_FRAGMENT_HASH_SIZE - 1)))
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH */
+
+
+#ifdef NX_ENABLE_IP_RECEIVE_QUEUES
+#if ((NX_IP_RECEIVE_QUEUES) & ((NX_IP_RECEIVE_QUEUES) - 1)) || (NX_IP_RECEIVE_QUEUES < 1)
+#error "NX_IP_RECEIVE_QUEUES must be a power of two"
+#endif
+#endif /* NX_ENABLE_IP_RECEIVE_QUEUES */
+
+
+/* Define the macros that manage the transmit more hint given to link drivers.  A burst of
+   transmissions is bracketed by the start and end macros, and the end of the outermost
+   burst flushes the packets the drivers are holding.  */
+
+#ifdef NX_ENABLE_DRIVER_TRANSMIT_MORE
+#define NX_IP_TRANSMIT_BURST_START(i)           ((i) -> nx_ip_transmit_burst++)
+#define NX_IP_TRANSMIT_BURST_END(i)             _nx_ip_transmit_burst_end(i)
+#define NX_IP_TRANSMIT_MORE(i)                  ((i) -> nx_ip_transmit_burst != 0)
+#define NX_IP_DRIVER_TRANSMIT_MORE_SET(d, m)    ((d).nx_ip_driver_transmit_more = (UINT)(m), \
+                                                 ((d).nx_ip_driver_interface) -> nx_interface_transmit_pending = (UINT)(m))
+#else
+#define NX_IP_TRANSMIT_BURST_START(i)
+#define NX_IP_TRANSMIT_BURST_END(i)
+#define NX_IP_DRIVER_TRANSMIT_MORE_SET(d, m)
+#endif /* NX_ENABLE_DRIVER_TRANSMIT_MORE */
+
+
+#ifdef NX_ENABLE_IP_PACKET_FILTER
+/* Define the protocol classes of the packet filter decision table.  */
+#define NX_IP_PACKET_FILTER_CLASS_ICMP  0
+#define NX_IP_PACKET_FILTER_CLASS_TCP   1
+#define NX_IP_PACKET_FILTER_CLASS_UDP   2
+#define NX_IP_PACKET_FILTER_CLASS_OTHER 3
+
+#if NX_IP_PACKET_FILTER_MAX_RULES > 255
+#error "NX_IP_PACKET_FILTER_MAX_RULES must not exceed 255."
+#endif
+#endif /* NX_ENABLE_IP_PACKET_FILTER */
+
+
+/* Define the macro that releases the original packet of a fragmented transmission.  When
+   fragments reference the payload of the original packet, it is only released after the
+   last of those fragments has been released.  */
+
+#ifdef NX_ENABLE_IP_FRAGMENT_ZERO_COPY
+#define NX_IP_FRAGMENT_SOURCE_RELEASE(p)        _nx_packet_fragment_source_release(p)
+#else
+#define NX_IP_FRAGMENT_SOURCE_RELEASE(p)        _nx_packet_transmit_release(p)
+#endif /* NX_ENABLE_IP_FRAGMENT_ZERO_COPY */
+
+
+/* Define the macro that invalidates the routes held in destination caches.  */
+
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+#define NX_IP_DESTINATION_CACHE_INVALIDATE(i) ((i) -> nx_ip_destination_cache_generation++)
+#else
+#define NX_IP_DESTINATION_CACHE_INVALIDATE(i)
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
+
+
+#ifdef NX_ENABLE_IP_STATIC_ROUTE_TRIE
+#ifndef NX_ENABLE_IP_STATIC_ROUTING
+#error "NX_ENABLE_IP_STATIC_ROUTE_TRIE requires NX_ENABLE_IP_STATIC_ROUTING."
+#endif
+#if (NX_IP_ROUTING_TABLE_SIZE > 0xFFFE) || (NX_IP_ROUTING_TRIE_NODES > 0xFFFF)
+#error "The static routing table and trie must be indexed by a USHORT."
+#endif
+#endif /* NX_ENABLE_IP_STATIC_ROUTE_TRIE */
+
 
 /* Define IP event flags.  These events are processed by the IP thread. */
 
@@ -212,6 +290,17 @@ VOID  _nx_ip_periodic_timer_entry(ULONG ip_address);
 VOID  _nx_ip_packet_send(NX_IP *ip_ptr, NX_PACKET *packet_ptr, ULONG destination_ip, ULONG type_of_service, ULONG time_to_live, ULONG protocol, ULONG fragment);
 VOID  _nx_ip_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
 VOID  _nx_ip_packet_deferred_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
+VOID  _nx_ip_packet_deferred_chain_receive(NX_IP *ip_ptr, NX_PACKET *packet_head, NX_PACKET *packet_tail);
+UINT  _nx_ip_receive_queues_create(NX_IP *ip_ptr, VOID *stack_ptr, ULONG stack_size, UINT priority);
+UINT  _nx_ip_packet_filter_rules_set(NX_IP *ip_ptr, NX_IP_PACKET_FILTER_RULE *rule_array, UINT rule_count, UINT default_action);
+#ifdef NX_ENABLE_IP_PACKET_FILTER
+UINT  _nx_ip_packet_filter_rules_check(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
+#endif /* NX_ENABLE_IP_PACKET_FILTER */
+#ifdef NX_ENABLE_IP_RECEIVE_QUEUES
+ULONG _nx_ip_packet_flow_hash(NX_PACKET *packet_ptr);
+VOID  _nx_ip_packet_flow_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr, ULONG flow_hash);
+VOID  _nx_ip_receive_queue_thread_entry(ULONG queue_ptr_value);
+#endif /* NX_ENABLE_IP_RECEIVE_QUEUES */
 UINT  _nx_ip_status_check(NX_IP *ip_ptr, ULONG needed_status, ULONG *actual_status,
                           ULONG wait_option);
 UINT  _nx_ip_link_status_change_notify_set(NX_IP *ip_ptr,  VOID (*link_status_change_notify)(NX_IP *ip_ptr, UINT interface_index, UINT link_up));
@@ -220,6 +309,29 @@ VOID  _nx_ip_raw_packet_cleanup(TX_THREAD *thread_ptr NX_CLEANUP_PARAMETER);
 VOID  _nx_ip_raw_packet_processing(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
 VOID  _nx_ip_fragment_packet(struct NX_IP_DRIVER_STRUCT *driver_req_ptr);
 VOID  _nx_ip_fragment_assembly(NX_IP *ip_ptr);
+#ifdef NX_ENABLE_IP_STATIC_ROUTE_TRIE
+UINT  _nx_ip_route_trie_build(NX_IP *ip_ptr);
+#endif /* NX_ENABLE_IP_STATIC_ROUTE_TRIE */
+#ifdef NX_ENABLE_DRIVER_TRANSMIT_MORE
+VOID  _nx_ip_transmit_burst_end(NX_IP *ip_ptr);
+#endif /* NX_ENABLE_DRIVER_TRANSMIT_MORE */
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+ULONG _nx_ip_destination_cache_route(NX_IP *ip_ptr, NX_IP_DESTINATION_CACHE *cache_ptr, ULONG destination_address, NX_PACKET *packet_ptr);
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
+#ifdef NX_ENABLE_IP_PATH_MTU_DISCOVERY
+ULONG _nx_ip_path_mtu_get(NX_IP *ip_ptr, ULONG destination_address, ULONG mtu);
+VOID  _nx_ip_path_mtu_update(NX_IP *ip_ptr, ULONG destination_address, ULONG path_mtu, ULONG packet_length);
+VOID  _nx_ip_path_mtu_periodic_update(NX_IP *ip_ptr);
+#endif /* NX_ENABLE_IP_PATH_MTU_DISCOVERY */
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH
+NX_PACKET *_nx_ip_fragment_context_add(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
+VOID  _nx_ip_fragment_context_release(NX_IP *ip_ptr, NX_IP_FRAGMENT_CONTEXT *context_ptr, UINT release_packets);
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH */
+#ifdef NX_ENABLE_EPHEMERAL_PORT_BITMAP
+UINT  _nx_ip_port_bitmap_find(NX_PORT_BITMAP *bitmap_ptr, UINT port, UINT *free_port_ptr);
+VOID  _nx_ip_port_bitmap_set(NX_PORT_BITMAP *bitmap_ptr, UINT port);
+VOID  _nx_ip_port_bitmap_clear(NX_PORT_BITMAP *bitmap_ptr, UINT port);
+#endif /* NX_ENABLE_EPHEMERAL_PORT_BITMAP */
 
 UINT  _nx_ip_static_route_add(NX_IP *ip_ptr, ULONG network_address, ULONG net_mask, ULONG next_hop);
 UINT  _nx_ip_static_route_delete(NX_IP *ip_ptr, ULONG network_address, ULONG net_mask);
@@ -263,6 +375,8 @@ UINT _nxe_ip_raw_packet_send(NX_IP *ip_ptr, NX_PACKET **packet_ptr_ptr,
                              ULONG destination_ip, ULONG type_of_service);
 UINT _nxe_ip_raw_packet_interface_send(NX_IP *ip_ptr, NX_PACKET **packet_ptr_ptr,
                                        ULONG destination_ip, UINT interface_index, ULONG type_of_service);
+UINT _nxe_ip_receive_queues_create(NX_IP *ip_ptr, VOID *stack_ptr, ULONG stack_size, UINT priority);
+UINT _nxe_ip_packet_filter_rules_set(NX_IP *ip_ptr, NX_IP_PACKET_FILTER_RULE *rule_array, UINT rule_count, UINT default_action);
 UINT _nxe_ip_status_check(NX_IP *ip_ptr, ULONG needed_status, ULONG *actual_status,
                           ULONG wait_option);
 UINT _nxe_ip_link_status_change_notify_set(NX_IP *ip_ptr,  VOID (*link_status_change_notify)(NX_IP *ip_ptr, UINT interface_index, UINT link_up));
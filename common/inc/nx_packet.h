@@ -93,6 +93,7 @@ UINT _nx_packet_release(NX_PACKET *packet_ptr);
 UINT _nx_packet_transmit_release(NX_PACKET *packet_ptr);
 VOID _nx_packet_pool_cleanup(TX_THREAD *thread_ptr NX_CLEANUP_PARAMETER);
 VOID _nx_packet_pool_initialize(VOID);
+VOID _nx_packet_fragment_source_release(NX_PACKET *packet_ptr);
 
 
 /* Define error checking shells for API services.  These are only referenced by the
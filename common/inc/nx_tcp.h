@@ -105,6 +105,23 @@
 #define NX_TCP_MAXIMUM_TX_QUEUE  20                 /* Maximum number of transmit    */
 #endif                                              /*   packets queued              */
 
+#ifdef NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX
+#if (NX_TCP_TRANSMIT_QUEUE_INDEX_SIZE < NX_TCP_MAXIMUM_TX_QUEUE)
+#error "NX_TCP_TRANSMIT_QUEUE_INDEX_SIZE must not be less than NX_TCP_MAXIMUM_TX_QUEUE."
+#endif
+#endif /* NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX */
+
+/* Define the macro that picks the fragment setting for a data segment.  With path MTU discovery,
+   a segment built before the path MTU was lowered, or sent on a path at the minimum MTU, is
+   allowed to be fragmented so it is not dropped again.  */
+#ifdef NX_ENABLE_IP_PATH_MTU_DISCOVERY
+#define NX_TCP_SOCKET_FRAGMENT(s, p) ((((p) -> nx_packet_length + sizeof(NX_IP_HEADER) > (s) -> nx_tcp_socket_path_mtu) || \
+                                       ((s) -> nx_tcp_socket_path_mtu <= NX_IP_PATH_MTU_MINIMUM)) ?                      \
+                                      NX_FRAGMENT_OKAY : (s) -> nx_tcp_socket_fragment_enable)
+#else
+#define NX_TCP_SOCKET_FRAGMENT(s, p) ((s) -> nx_tcp_socket_fragment_enable)
+#endif /* NX_ENABLE_IP_PATH_MTU_DISCOVERY */
+
 #ifndef NX_TCP_MAXIMUM_RETRIES
 #define NX_TCP_MAXIMUM_RETRIES   10                 /* Maximum number of transmit    */
 #endif                                              /*   retries allowed             */
@@ -117,6 +134,11 @@
                                                     /*   of 1 causes each successive */
                                                     /*   be multiplied by two, etc.  */
 
+/* Define the need_fast_retransmit value of _nx_tcp_socket_retransmit for a retransmission
+   triggered by RACK-TLP loss detection.  It enters fast recovery like a duplicated ACK
+   retransmission, but is counted as a RACK retransmission instead of a fast retransmit.  */
+#define NX_TCP_RACK_RETRANSMIT   2
+
 
 
 /* Define the rate for the TCP fast periodic timer.  This timer is used to process
@@ -148,6 +170,14 @@
 #endif
 
 
+/* Define the states of a socket in a TCP accept pool.  */
+
+#define NX_TCP_POOL_SOCKET_FREE     1                   /* On the free list of the pool  */
+#define NX_TCP_POOL_SOCKET_PENDING  2                   /* Listening or in handshake     */
+#define NX_TCP_POOL_SOCKET_READY    3                   /* Established, not yet accepted */
+#define NX_TCP_POOL_SOCKET_ACCEPTED 4                   /* Owned by the application      */
+
+
 /* Define Basic TCP packet header data type.  This will be used to
    build new TCP packets and to examine incoming packets into NetX.  */
 
@@ -279,6 +309,11 @@ UINT _nx_tcp_info_get(NX_IP *ip_ptr, ULONG *tcp_packets_sent, ULONG *tcp_bytes_s
 UINT _nx_tcp_server_socket_accept(NX_TCP_SOCKET *socket_ptr, ULONG wait_option);
 UINT _nx_tcp_server_socket_listen(NX_IP *ip_ptr, UINT port, NX_TCP_SOCKET *socket_ptr, UINT listen_queue_size,
                                   VOID (*tcp_listen_callback)(NX_TCP_SOCKET *socket_ptr, UINT port));
+UINT _nx_tcp_server_socket_pool_accept(NX_IP *ip_ptr, UINT port, NX_TCP_SOCKET **socket_array, UINT array_size,
+                                      UINT *accepted_count, ULONG wait_option);
+UINT _nx_tcp_server_socket_pool_listen(NX_IP *ip_ptr, UINT port, NX_TCP_SOCKET **socket_array, UINT socket_count,
+                                      UINT listen_queue_size, VOID (*tcp_listen_callback)(NX_TCP_SOCKET *socket_ptr, UINT port));
+UINT _nx_tcp_server_socket_pool_release(NX_TCP_SOCKET *socket_ptr);
 UINT _nx_tcp_server_socket_relisten(NX_IP *ip_ptr, UINT port, NX_TCP_SOCKET *socket_ptr);
 UINT _nx_tcp_server_socket_unaccept(NX_TCP_SOCKET *socket_ptr);
 UINT _nx_tcp_server_socket_unlisten(NX_IP *ip_ptr, UINT port);
@@ -294,6 +329,7 @@ UINT _nx_tcp_socket_info_get(NX_TCP_SOCKET *socket_ptr, ULONG *tcp_packets_sent,
                              ULONG *tcp_checksum_errors, ULONG *tcp_socket_state,
                              ULONG *tcp_transmit_queue_depth, ULONG *tcp_transmit_window,
                              ULONG *tcp_receive_window);
+UINT _nx_tcp_socket_extended_info_get(NX_TCP_SOCKET *socket_ptr, NX_TCP_SOCKET_INFO *info_ptr);
 UINT _nx_tcp_socket_peer_info_get(NX_TCP_SOCKET *socket_ptr, ULONG *peer_ip_address,
                                   ULONG *peer_port);
 
@@ -327,6 +363,27 @@ VOID  _nx_tcp_deferred_cleanup_check(NX_IP *ip_ptr);
 VOID  _nx_tcp_fast_periodic_processing(NX_IP *ip_ptr);
 VOID  _nx_tcp_fast_periodic_timer_entry(ULONG ip_address);
 VOID  _nx_tcp_socket_retransmit(NX_IP *ip_ptr, NX_TCP_SOCKET *socket_ptr, UINT need_fast_retransmit);
+VOID  _nx_tcp_socket_rtt_update(NX_TCP_SOCKET *socket_ptr, ULONG rtt);
+#ifdef NX_ENABLE_EPHEMERAL_PORT_BITMAP
+VOID  _nx_tcp_port_bitmap_release(NX_IP *ip_ptr, UINT port);
+#endif /* NX_ENABLE_EPHEMERAL_PORT_BITMAP */
+#ifdef NX_ENABLE_TCP_ACCEPT_POOL
+VOID  _nx_tcp_server_socket_pool_arm(NX_IP *ip_ptr, struct NX_TCP_LISTEN_STRUCT *listen_ptr);
+VOID  _nx_tcp_server_socket_pool_cleanup(TX_THREAD *thread_ptr NX_CLEANUP_PARAMETER);
+VOID  _nx_tcp_server_socket_pool_reclaim(NX_TCP_SOCKET *socket_ptr);
+#endif /* NX_ENABLE_TCP_ACCEPT_POOL */
+#ifdef NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX
+VOID  _nx_tcp_socket_transmit_index_append(NX_TCP_SOCKET *socket_ptr, ULONG data_length);
+ULONG _nx_tcp_socket_transmit_index_search(NX_TCP_SOCKET *socket_ptr, ULONG ack_number);
+#endif /* NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX */
+#ifdef NX_ENABLE_TCP_RACK_TLP
+UINT  _nx_tcp_socket_rack_loss_detect(NX_TCP_SOCKET *socket_ptr);
+VOID  _nx_tcp_socket_tlp_timeout_set(NX_TCP_SOCKET *socket_ptr);
+VOID  _nx_tcp_socket_tlp_send(NX_IP *ip_ptr, NX_TCP_SOCKET *socket_ptr);
+#endif /* NX_ENABLE_TCP_RACK_TLP */
+#ifdef NX_ENABLE_IP_PATH_MTU_DISCOVERY
+VOID  _nx_tcp_socket_path_mtu_refresh(NX_TCP_SOCKET *socket_ptr);
+#endif /* NX_ENABLE_IP_PATH_MTU_DISCOVERY */
 VOID  _nx_tcp_connect_cleanup(TX_THREAD *thread_ptr NX_CLEANUP_PARAMETER);
 VOID  _nx_tcp_disconnect_cleanup(TX_THREAD *thread_ptr NX_CLEANUP_PARAMETER);
 VOID  _nx_tcp_initialize(VOID);
@@ -379,6 +436,11 @@ UINT _nxe_tcp_info_get(NX_IP *ip_ptr, ULONG *tcp_packets_sent, ULONG *tcp_bytes_
 UINT _nxe_tcp_server_socket_accept(NX_TCP_SOCKET *socket_ptr, ULONG wait_option);
 UINT _nxe_tcp_server_socket_listen(NX_IP *ip_ptr, UINT port, NX_TCP_SOCKET *socket_ptr, UINT listen_queue_size,
                                    VOID (*tcp_listen_callback)(NX_TCP_SOCKET *socket_ptr, UINT port));
+UINT _nxe_tcp_server_socket_pool_accept(NX_IP *ip_ptr, UINT port, NX_TCP_SOCKET **socket_array, UINT array_size,
+                                       UINT *accepted_count, ULONG wait_option);
+UINT _nxe_tcp_server_socket_pool_listen(NX_IP *ip_ptr, UINT port, NX_TCP_SOCKET **socket_array, UINT socket_count,
+                                       UINT listen_queue_size, VOID (*tcp_listen_callback)(NX_TCP_SOCKET *socket_ptr, UINT port));
+UINT _nxe_tcp_server_socket_pool_release(NX_TCP_SOCKET *socket_ptr);
 UINT _nxe_tcp_server_socket_relisten(NX_IP *ip_ptr, UINT port, NX_TCP_SOCKET *socket_ptr);
 UINT _nxe_tcp_server_socket_unaccept(NX_TCP_SOCKET *socket_ptr);
 UINT _nxe_tcp_server_socket_unlisten(NX_IP *ip_ptr, UINT port);
@@ -395,6 +457,7 @@ UINT _nxe_tcp_socket_info_get(NX_TCP_SOCKET *socket_ptr, ULONG *tcp_packets_sent
                               ULONG *tcp_checksum_errors, ULONG *tcp_socket_state,
                               ULONG *tcp_transmit_queue_depth, ULONG *tcp_transmit_window,
                               ULONG *tcp_receive_window);
+UINT _nxe_tcp_socket_extended_info_get(NX_TCP_SOCKET *socket_ptr, NX_TCP_SOCKET_INFO *info_ptr);
 UINT _nxe_tcp_socket_mss_get(NX_TCP_SOCKET *socket_ptr, ULONG *mss);
 UINT _nxe_tcp_socket_mss_peer_get(NX_TCP_SOCKET *socket_ptr, ULONG *peer_mss);
 UINT _nxe_tcp_socket_mss_set(NX_TCP_SOCKET *socket_ptr, ULONG mss);
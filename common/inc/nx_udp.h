@@ -82,6 +82,28 @@ typedef struct NX_UDP_HEADER_STRUCT
 } NX_UDP_HEADER;
 
 
+/* Define the macros that add a packet placed on the receive queue of a socket to the bytes
+   queued on the socket, and take a packet removed from the queue off them.  */
+
+#ifdef NX_ENABLE_UDP_RECEIVE_BUDGET
+#define NX_UDP_RECEIVE_BYTES_ADD(s, p)      ((s) -> nx_udp_socket_receive_bytes += (p) -> nx_packet_length)
+#define NX_UDP_RECEIVE_BYTES_REMOVE(s, p)   ((s) -> nx_udp_socket_receive_bytes -= (p) -> nx_packet_length)
+#else
+#define NX_UDP_RECEIVE_BYTES_ADD(s, p)
+#define NX_UDP_RECEIVE_BYTES_REMOVE(s, p)
+#endif /* NX_ENABLE_UDP_RECEIVE_BUDGET */
+
+
+/* Define the hash of the source of a received packet, used to spread flows over the
+   sockets sharing a port, and the hash of a connected socket into the connected socket
+   table.  */
+
+#ifdef NX_ENABLE_UDP_FLOW_DEMUX
+#define NX_UDP_FLOW_HASH(a, p)              ((ULONG)((((a) ^ (ULONG)(p)) * (ULONG)0x9E3779B1) >> 16))
+#define NX_UDP_CONNECTED_HASH(l, a, p)      ((UINT)(NX_UDP_FLOW_HASH((a) ^ ((ULONG)(l) << 16), p) & NX_UDP_CONNECTED_TABLE_MASK))
+#endif /* NX_ENABLE_UDP_FLOW_DEMUX */
+
+
 /* Define UDP component function prototypes.  */
 
 UINT _nx_udp_enable(NX_IP *ip_ptr);
@@ -93,29 +115,54 @@ UINT _nx_udp_info_get(NX_IP *ip_ptr, ULONG *udp_packets_sent, ULONG *udp_bytes_s
 UINT _nx_udp_socket_bind(NX_UDP_SOCKET *socket_ptr, UINT  port, ULONG wait_option);
 UINT _nx_udp_socket_checksum_disable(NX_UDP_SOCKET *socket_ptr);
 UINT _nx_udp_socket_checksum_enable(NX_UDP_SOCKET *socket_ptr);
+UINT _nx_udp_socket_connect(NX_UDP_SOCKET *socket_ptr, ULONG ip_address, UINT port);
 UINT _nx_udp_socket_create(NX_IP *ip_ptr, NX_UDP_SOCKET *socket_ptr, CHAR *name,
                            ULONG type_of_service, ULONG fragment, UINT time_to_live, ULONG queue_maximum);
 UINT _nx_udp_socket_delete(NX_UDP_SOCKET *socket_ptr);
+UINT _nx_udp_socket_drop_info_get(NX_UDP_SOCKET *socket_ptr, ULONG *queue_full_drops, ULONG *no_buffer_drops,
+                                 ULONG *checksum_drops);
+UINT _nx_udp_socket_drop_notify(NX_UDP_SOCKET *socket_ptr, ULONG threshold, ULONG period,
+                               VOID (*drop_notify)(NX_UDP_SOCKET *socket_ptr, ULONG drops));
 UINT _nx_udp_socket_info_get(NX_UDP_SOCKET *socket_ptr, ULONG *udp_packets_sent, ULONG *udp_bytes_sent,
                              ULONG *udp_packets_received, ULONG *udp_bytes_received, ULONG *udp_packets_queued,
                              ULONG *udp_receive_packets_dropped, ULONG *udp_checksum_errors);
 UINT _nx_udp_socket_interface_send(NX_UDP_SOCKET *socket_ptr, NX_PACKET *packet_ptr, ULONG ip_address, UINT port, UINT interface_index);
 UINT _nx_udp_socket_bytes_available(NX_UDP_SOCKET *socket_ptr, ULONG *bytes_available);
 UINT _nx_udp_socket_port_get(NX_UDP_SOCKET *socket_ptr, UINT *port_ptr);
+UINT _nx_udp_socket_port_share_enable(NX_UDP_SOCKET *socket_ptr);
 UINT _nx_udp_socket_receive(NX_UDP_SOCKET *socket_ptr, NX_PACKET **packet_ptr,
                             ULONG wait_option);
+UINT _nx_udp_socket_receive_batch(NX_UDP_SOCKET *socket_ptr, NX_PACKET **packet_array, UINT array_size,
+                                  UINT *received_count, ULONG wait_option);
+UINT _nx_udp_socket_receive_buffer_set(NX_UDP_SOCKET *socket_ptr, ULONG maximum_bytes);
 UINT _nx_udp_socket_receive_notify(NX_UDP_SOCKET *socket_ptr,
                                    VOID (*udp_receive_notify)(NX_UDP_SOCKET *socket_ptr));
+UINT _nx_udp_socket_segment_send(NX_UDP_SOCKET *socket_ptr, NX_PACKET *packet_ptr,
+                                 ULONG ip_address, UINT port, ULONG segment_size, ULONG wait_option);
 UINT _nx_udp_socket_send(NX_UDP_SOCKET *socket_ptr, NX_PACKET *packet_ptr,
                          ULONG ip_address, UINT port);
+UINT _nx_udp_socket_send_batch(NX_UDP_SOCKET *socket_ptr, NX_UDP_SEND_ENTRY *entry_array, UINT entry_count,
+                               UINT *sent_count);
 UINT _nx_udp_socket_unbind(NX_UDP_SOCKET *socket_ptr);
 UINT _nx_udp_source_extract(NX_PACKET *packet_ptr, ULONG *ip_address, UINT *port);
 UINT _nx_udp_packet_info_extract(NX_PACKET *packet_ptr, ULONG *ip_address,
                                  UINT *protocol, UINT *port, UINT *interface_index);
 VOID _nx_udp_initialize(VOID);
+ULONG _nx_udp_checksum(NX_PACKET *packet_ptr, ULONG source_address, ULONG destination_address);
 VOID _nx_udp_bind_cleanup(TX_THREAD *thread_ptr NX_CLEANUP_PARAMETER);
 VOID _nx_udp_packet_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr);
 VOID _nx_udp_receive_cleanup(TX_THREAD *thread_ptr NX_CLEANUP_PARAMETER);
+#ifdef NX_ENABLE_EPHEMERAL_PORT_BITMAP
+VOID _nx_udp_port_bitmap_release(NX_IP *ip_ptr, UINT port);
+#endif /* NX_ENABLE_EPHEMERAL_PORT_BITMAP */
+#ifdef NX_ENABLE_UDP_RECEIVE_BUDGET
+VOID _nx_udp_socket_drop_record(NX_UDP_SOCKET *socket_ptr, ULONG drops);
+#endif /* NX_ENABLE_UDP_RECEIVE_BUDGET */
+#ifdef NX_ENABLE_UDP_FLOW_DEMUX
+NX_UDP_SOCKET *_nx_udp_socket_find(NX_IP *ip_ptr, UINT port, ULONG source_ip, UINT source_port);
+VOID _nx_udp_socket_connected_link(NX_UDP_SOCKET *socket_ptr);
+VOID _nx_udp_socket_connected_unlink(NX_UDP_SOCKET *socket_ptr);
+#endif /* NX_ENABLE_UDP_FLOW_DEMUX */
 
 
 /* Define error checking shells for API services.  These are only referenced by the
@@ -130,21 +177,34 @@ UINT _nxe_udp_info_get(NX_IP *ip_ptr, ULONG *udp_packets_sent, ULONG *udp_bytes_
 UINT _nxe_udp_socket_bind(NX_UDP_SOCKET *socket_ptr, UINT  port, ULONG wait_option);
 UINT _nxe_udp_socket_checksum_disable(NX_UDP_SOCKET *socket_ptr);
 UINT _nxe_udp_socket_checksum_enable(NX_UDP_SOCKET *socket_ptr);
+UINT _nxe_udp_socket_connect(NX_UDP_SOCKET *socket_ptr, ULONG ip_address, UINT port);
 UINT _nxe_udp_socket_create(NX_IP *ip_ptr, NX_UDP_SOCKET *socket_ptr, CHAR *name,
                             ULONG type_of_service, ULONG fragment, UINT time_to_live, ULONG queue_maximum, UINT udp_socket_size);
 UINT _nxe_udp_socket_delete(NX_UDP_SOCKET *socket_ptr);
+UINT _nxe_udp_socket_drop_info_get(NX_UDP_SOCKET *socket_ptr, ULONG *queue_full_drops, ULONG *no_buffer_drops,
+                                  ULONG *checksum_drops);
+UINT _nxe_udp_socket_drop_notify(NX_UDP_SOCKET *socket_ptr, ULONG threshold, ULONG period,
+                                VOID (*drop_notify)(NX_UDP_SOCKET *socket_ptr, ULONG drops));
 UINT _nxe_udp_socket_info_get(NX_UDP_SOCKET *socket_ptr, ULONG *udp_packets_sent, ULONG *udp_bytes_sent,
                               ULONG *udp_packets_received, ULONG *udp_bytes_received, ULONG *udp_packets_queued,
                               ULONG *udp_receive_packets_dropped, ULONG *udp_checksum_errors);
 UINT _nxe_udp_socket_interface_send(NX_UDP_SOCKET *socket_ptr, NX_PACKET **packet_ptr_ptr, ULONG ip_address, UINT port, UINT interface_index);
 UINT _nxe_udp_socket_bytes_available(NX_UDP_SOCKET *socket_ptr, ULONG *bytes_available);
 UINT _nxe_udp_socket_port_get(NX_UDP_SOCKET *socket_ptr, UINT *port_ptr);
+UINT _nxe_udp_socket_port_share_enable(NX_UDP_SOCKET *socket_ptr);
 UINT _nxe_udp_socket_receive(NX_UDP_SOCKET *socket_ptr, NX_PACKET **packet_ptr,
                              ULONG wait_option);
+UINT _nxe_udp_socket_receive_batch(NX_UDP_SOCKET *socket_ptr, NX_PACKET **packet_array, UINT array_size,
+                                   UINT *received_count, ULONG wait_option);
+UINT _nxe_udp_socket_receive_buffer_set(NX_UDP_SOCKET *socket_ptr, ULONG maximum_bytes);
 UINT _nxe_udp_socket_receive_notify(NX_UDP_SOCKET *socket_ptr,
                                     VOID (*udp_receive_notify)(NX_UDP_SOCKET *socket_ptr));
+UINT _nxe_udp_socket_segment_send(NX_UDP_SOCKET *socket_ptr, NX_PACKET **packet_ptr_ptr,
+                                  ULONG ip_address, UINT port, ULONG segment_size, ULONG wait_option);
 UINT _nxe_udp_socket_send(NX_UDP_SOCKET *socket_ptr, NX_PACKET **packet_ptr_ptr,
                           ULONG ip_address, UINT port);
+UINT _nxe_udp_socket_send_batch(NX_UDP_SOCKET *socket_ptr, NX_UDP_SEND_ENTRY *entry_array, UINT entry_count,
+                                UINT *sent_count);
 UINT _nxe_udp_socket_unbind(NX_UDP_SOCKET *socket_ptr);
 UINT _nxe_udp_source_extract(NX_PACKET *packet_ptr, ULONG *ip_address, UINT *port);
 UINT _nxe_udp_packet_info_extract(NX_PACKET *packet_ptr, ULONG *ip_address,
@@ -73,6 +73,15 @@
 #define NX_ENABLE_IP_STATIC_ROUTING
 */
 
+/* Defined, this option indexes the static routing table with a 4-bit stride longest prefix match
+   trie, so a route lookup visits at most 8 trie nodes however many routes are configured.  It
+   requires NX_ENABLE_IP_STATIC_ROUTING and contiguous network masks.  The table holds
+   NX_IP_ROUTING_TABLE_SIZE routes and the trie NX_IP_ROUTING_TRIE_NODES nodes.  By default
+   this feature is not compiled in.  */
+/*
+#define NX_ENABLE_IP_STATIC_ROUTE_TRIE
+*/
+
 /* This define specifies the size of the physical packet header. The default value is 16 (based on
    a typical 16-byte Ethernet header).  */
 
@@ -219,6 +228,17 @@
 */
 
 
+/* Defined, this option enables RACK-TLP time based loss detection (RFC 8985).  A lost segment
+   is retransmitted once a later segment has been delivered and a reordering window has passed,
+   instead of waiting for three duplicate ACKs, and a tail loss probe is sent about two round
+   trip times after the last transmission so that losses at the end of a flight do not wait for
+   the retransmit timeout.  Defining this option adds a transmit time stamp to every packet.
+   Default disabled.  */
+/*
+#define NX_ENABLE_TCP_RACK_TLP
+*/
+
+
 
 /* Defined, this option enables the optional TCP immediate ACK response processing.  */
 
@@ -256,6 +276,299 @@
 */
 
 
+/* Defined, this option keeps the sequence range of every packet on the TCP transmit queue in a
+   compact per-socket ring, so incoming ACKs are matched with a binary search instead of walking
+   the queue and parsing each packet's TCP header.  Default disabled.  */
+/*
+#define NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX
+*/
+
+
+/* This define specifies the number of entries in the TCP transmit queue index, which is also
+   the largest transmit queue depth a socket can be configured with when
+   NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX is defined.  The default value is NX_TCP_MAXIMUM_TX_QUEUE.  */
+/*
+#define NX_TCP_TRANSMIT_QUEUE_INDEX_SIZE    20
+*/
+
+
+/* Defined, this option makes the RAM network driver deliver frames asynchronously, like a real
+   device.  Each driver instance has a lock-free single producer, single consumer ring per sending
+   instance.  The sending instance posts a copy of the frame on the ring and wakes the receiving
+   IP thread, which takes the frames off its rings in the driver's deferred processing.  Default
+   disabled, so frames are delivered on the sending thread.  */
+/*
+#define NX_ENABLE_RAM_DRIVER_RINGS
+*/
+
+/* Defines the number of frames each RAM network driver ring holds, which must be a power of two.
+   Frames arriving on a full ring are dropped.  Only meaningful if NX_ENABLE_RAM_DRIVER_RINGS is
+   defined.  The default value is 64.  */
+/*
+#define NX_RAM_DRIVER_RING_SIZE             64
+*/
+
+/* Defined, this option limits the bytes queued on a UDP socket's receive queue, in addition to the
+   packet limit set at socket creation, and counts receive drops per socket by cause: queue full,
+   receive buffer full, and checksum error.  nx_udp_socket_receive_buffer_set sets the byte limit,
+   nx_udp_socket_drop_info_get returns the counters, and nx_udp_socket_drop_notify installs a
+   function called when the drops in a period reach a threshold.  Default disabled.  */
+/*
+#define NX_ENABLE_UDP_RECEIVE_BUDGET
+*/
+
+/* Defines the receive queue byte limit of new UDP sockets, where zero means no byte limit.  Only
+   meaningful if NX_ENABLE_UDP_RECEIVE_BUDGET is defined.  The default value is 0.  */
+/*
+#define NX_UDP_RECEIVE_BUFFER_DEFAULT       0
+*/
+
+/* Defined, this option adds nx_udp_socket_segment_send, which sends a large packet as a train of
+   UDP datagrams of a given payload size to the same peer.  The route is looked up once, the UDP
+   headers are built from one template, and the datagrams are passed to IP as one transmit burst.
+   The datagrams are allocated from the default packet pool of the IP instance.  Default
+   disabled.  */
+/*
+#define NX_ENABLE_UDP_SEGMENTATION
+*/
+
+/* Defined, this option adds nx_udp_socket_send_batch and nx_udp_socket_receive_batch.  A send
+   batch resolves the route once for each run of packets to the same destination, and routes and
+   hands all packets to IP under one hold of the IP mutex, as one transmit burst.  A receive batch
+   takes up to the requested number of queued datagrams from the socket at once.  Only the costs
+   paid once per call are shared by the batch; the checksum, IP and driver processing of each
+   datagram is unchanged, so the gain in datagram rate is smaller when checksums are computed in
+   software.  Default disabled.  */
+/*
+#define NX_ENABLE_UDP_BATCH
+*/
+
+/* Defined, this option adds nx_udp_socket_connect and nx_udp_socket_port_share_enable.  A
+   connected UDP socket only receives packets from its peer and is found through a table hashed
+   on the local port and the peer address and port.  Sockets that all have port sharing enabled
+   can be bound to the same port, and the packets received on the port that do not match a
+   connected socket are spread over them by a hash of their source address and port, so each
+   flow is always delivered to the same socket.  Default disabled.  */
+/*
+#define NX_ENABLE_UDP_FLOW_DEMUX
+*/
+
+/* Defines the number of buckets in the connected UDP socket table, which must be a power of
+   two.  Only meaningful if NX_ENABLE_UDP_FLOW_DEMUX is defined.  The default value is 32.  */
+/*
+#define NX_UDP_CONNECTED_TABLE_SIZE         32
+*/
+
+/* Defined, this option keeps joined multicast groups in a hash table set up with
+   nx_igmp_group_table_enable in memory supplied by the application, instead of the
+   NX_MAX_MULTICAST_GROUPS entry arrays of the IP instance.  Received multicast packets are then
+   matched with a single hash lookup, and only the groups with a pending membership report are
+   visited by the IGMP periodic processing.  Groups cannot be joined until the table is set up.
+   Default disabled.  */
+/*
+#define NX_ENABLE_IGMP_GROUP_TABLE
+*/
+
+/* Defines the number of slots in the IGMP report timer wheel, which must be a power of two.
+   Only meaningful if NX_ENABLE_IGMP_GROUP_TABLE is defined.  The default value is 32.  */
+/*
+#define NX_IGMP_TIMER_WHEEL_SIZE            32
+*/
+
+/* Defined, this option limits the packets queued for address resolution by a byte budget
+   shared by all ARP entries instead of NX_ARP_MAX_QUEUE_DEPTH packets per entry.  Each entry
+   waiting for resolution may queue up to an equal share of the budget, and when the budget is
+   exhausted the oldest packets of the entry holding the most bytes are dropped first.  An entry
+   can always queue at least one packet.  Default disabled.  */
+/*
+#define NX_ENABLE_ARP_QUEUE_BUDGET
+*/
+
+/* Defines the number of bytes that can be queued on all ARP entries waiting for address
+   resolution.  Only meaningful if NX_ENABLE_ARP_QUEUE_BUDGET is defined.  The default value is
+   16384.  */
+/*
+#define NX_ARP_QUEUE_BUDGET                 16384
+*/
+
+/* Defined, this option keeps ARP entries with a pending update on a timer wheel, so the ARP
+   periodic update only visits the entries that are due instead of every active entry.  A
+   resolved entry that was used to send packets is refreshed when NX_ARP_EXPIRATION_RATE
+   expires while its physical address stays in use.  An unused one is removed without sending
+   ARP requests.  Default disabled.  */
+/*
+#define NX_ENABLE_ARP_TIMER_WHEEL
+*/
+
+/* Defines the number of slots in the ARP timer wheel, which must be a power of two.  Updates
+   further away than the wheel size stay in their slot for more turns of the wheel.  Only
+   meaningful if NX_ENABLE_ARP_TIMER_WHEEL is defined.  The default value is 64.  */
+/*
+#define NX_ARP_TIMER_WHEEL_SIZE             64
+*/
+
+/* Defines the number of buckets in the ARP hash table, which must be a power of two no larger
+   than 65536.  Networks with many neighbors should use a value close to the number of ARP
+   entries given to nx_arp_enable.  The default value is 32.  */
+/*
+#define NX_ARP_TABLE_SIZE                   32
+*/
+
+/* Defined, this option builds transmitted IP fragments without copying the payload.  Each
+   fragment packet holds the IP header and references to slices of the original packet, which
+   is released when the last fragment is released.  The references are placed in the fragment
+   packet's buffer, so a fragment is copied if its payload spans too many packets of the
+   original chain.  This option adds fields to NX_PACKET, which affects NX_PACKET_HEADER_PAD.
+   Default disabled.  */
+/*
+#define NX_ENABLE_IP_FRAGMENT_ZERO_COPY
+*/
+
+/* Defined, this option hands a packet sent to a local address directly to the IP receive
+   processing instead of copying it into the default packet pool.  Packets still queued for TCP
+   retransmission and multicast loopback packets are copied.  Default disabled.  */
+/*
+#define NX_ENABLE_IP_LOOPBACK_ZERO_COPY
+*/
+
+/* Defined, this option processes a packet sent to a local address in the context of the sending
+   application thread instead of queuing it for the IP helper thread.  Packets sent from the IP
+   helper thread or from an ISR are still queued.  Note that UDP receive notify callbacks are then
+   invoked from the sending thread.  Default disabled.  */
+/*
+#define NX_ENABLE_IP_LOOPBACK_DIRECT_DELIVERY
+*/
+
+/* Defined, this option enables IP packet filtering.  Received packets can be checked against an
+   ordered list of rules installed with nx_ip_packet_filter_rules_set, each matching on addresses,
+   protocol, ports, TCP flags and interface, with an accept, drop or rate limit action.  The rules
+   are compiled into a table per protocol, so a packet is only compared with the rules that can
+   match it.  The nx_ip_packet_filter callback is also available.  Default disabled.  */
+/*
+#define NX_ENABLE_IP_PACKET_FILTER
+*/
+
+/* Defines the maximum number of IP packet filter rules, which must not exceed 255.  Only
+   meaningful if NX_ENABLE_IP_PACKET_FILTER is defined.  The default value is 32.  */
+/*
+#define NX_IP_PACKET_FILTER_MAX_RULES       32
+*/
+
+
+/* Defined, this option enables path MTU discovery as described in RFC 1191.  The next hop MTU
+   reported in ICMP fragmentation needed messages is kept in a per-destination path MTU cache,
+   and connected TCP sockets lower their MSS to fit the path MTU.  The path is only probed by
+   TCP sockets created with NX_DONT_FRAGMENT; sockets created with NX_FRAGMENT_OKAY keep sending
+   without the don't fragment bit.  Default disabled.  */
+/*
+#define NX_ENABLE_IP_PATH_MTU_DISCOVERY
+*/
+
+/* Defines the number of destinations held in the path MTU cache.  When the cache is full, the
+   entry closest to expiring is replaced.  Only meaningful if NX_ENABLE_IP_PATH_MTU_DISCOVERY is
+   defined.  The default value is 8.  */
+/*
+#define NX_IP_PATH_MTU_CACHE_SIZE           8
+*/
+
+/* Defines the number of seconds a learned path MTU is kept before the interface MTU is tried
+   again.  Only meaningful if NX_ENABLE_IP_PATH_MTU_DISCOVERY is defined.  The default value is
+   600, as recommended by RFC 1191.  */
+/*
+#define NX_IP_PATH_MTU_TIMEOUT              600
+*/
+
+/* Defines the smallest path MTU accepted from an ICMP message.  Smaller reports are raised to
+   this value, and segments sent on a path at the minimum are allowed to be fragmented.  Only
+   meaningful if NX_ENABLE_IP_PATH_MTU_DISCOVERY is defined.  The default value is 576.  */
+/*
+#define NX_IP_PATH_MTU_MINIMUM              576
+*/
+
+
+/* Defined, this option limits how many queued packets the IP helper thread processes for each
+   event class before it moves on to the next pending event.  When a queue still holds packets
+   after its budget is spent, its event is posted again, so the receive, driver deferred and TCP
+   queues take turns with the periodic, ARP, fragment and other events and a receive flood cannot
+   delay timers or ACK transmission indefinitely.  Default disabled.  */
+/*
+#define NX_ENABLE_IP_EVENT_BUDGET
+*/
+
+/* Defines the default number of packets processed per event class on each pass of the IP helper
+   thread.  NX_IP_RECEIVE_BUDGET, NX_IP_DRIVER_PACKET_BUDGET and NX_IP_TCP_BUDGET override it for
+   the deferred IP receive, driver deferred packet and TCP queues.  Only meaningful if
+   NX_ENABLE_IP_EVENT_BUDGET is defined.  The default value is 32.  */
+/*
+#define NX_IP_EVENT_QUANTUM                 32
+*/
+
+
+/* Defined, this option passes a transmit more hint to link drivers with each packet send request.
+   Fragment trains, packets released by ARP resolution, TCP retransmissions and the responses
+   generated while the IP thread processes a batch of received packets are sent with the hint set,
+   followed by an NX_LINK_PACKET_FLUSH request, so drivers can post transmit descriptors in bulk.
+   Default disabled.  */
+/*
+#define NX_ENABLE_DRIVER_TRANSMIT_MORE
+*/
+
+
+/* Defined, this option allows deferred IP receive processing to be spread over several receive
+   threads created with nx_ip_receive_queues_create.  Packets are steered onto a queue by a hash
+   of their addresses and protocol, plus the ports for TCP, so each flow stays in order.  The
+   receive threads process their packets under the IP mutex, like the IP thread, so the driver
+   hands packets off sooner but the processing itself is not run in parallel.  Default disabled.  */
+/*
+#define NX_ENABLE_IP_RECEIVE_QUEUES
+*/
+
+/* Defines the number of IP receive queues and threads, which must be a power of two.  Only
+   meaningful if NX_ENABLE_IP_RECEIVE_QUEUES is defined.  The default value is 4.  */
+/*
+#define NX_IP_RECEIVE_QUEUES                4
+*/
+
+
+/* Defined, this option gives each TCP and UDP socket a destination cache.  UDP sockets reuse the
+   route to their last destination until the routing table, gateway or interface addresses change,
+   and both TCP and UDP sockets pin the ARP entry of their next hop, so steady state transmissions
+   skip the route and ARP table lookups.  Default disabled.  */
+/*
+#define NX_ENABLE_IP_DESTINATION_CACHE
+*/
+
+
+/* Defined, this option keeps IP fragment re-assembly contexts in a hash table keyed by source,
+   destination, ID and protocol.  Each context holds its fragments ordered and without overlap, so
+   a datagram is found and its completion detected without walking the re-assembly list.  The
+   number of datagrams, fragments per datagram and timeout are set by NX_IP_FRAGMENT_MAX_DATAGRAMS,
+   NX_IP_FRAGMENT_MAX_FRAGMENTS and NX_IP_FRAGMENT_TIMEOUT (in seconds).  Default disabled.  */
+/*
+#define NX_ENABLE_IP_FRAGMENT_HASH
+*/
+
+
+/* Defined, this option tracks the TCP and UDP ports in use from NX_SEARCH_PORT_START through
+   NX_MAX_PORT in a bitmap per IP instance, so nx_tcp_free_port_find, nx_udp_free_port_find and
+   binds to NX_ANY_PORT find a free port without walking the bound socket lists.  The bitmaps take
+   (NX_MAX_PORT + 1 - NX_SEARCH_PORT_START) / 4 bytes of the IP instance.  Default disabled.  */
+/*
+#define NX_ENABLE_EPHEMERAL_PORT_BITMAP
+*/
+
+
+/* Defined, this option enables TCP accept pools.  A server registers an array of created sockets
+   with nx_tcp_server_socket_pool_listen; incoming connections are completed into free pool sockets
+   by the IP thread and retrieved in batches with nx_tcp_server_socket_pool_accept, and sockets are
+   returned to the pool with nx_tcp_server_socket_pool_release.  Connections reset before they are
+   accepted return their socket to the pool, and nx_tcp_server_socket_unlisten resets the
+   connections not yet accepted.  Default disabled.  */
+/*
+#define NX_ENABLE_TCP_ACCEPT_POOL
+*/
+
+
 /* This define specifies how the retransmit timeout period changes between successive retries. If this
    value is 0, the initial retransmit timeout is the same as subsequent retransmit timeouts. If this
    value is 1, each successive retransmit is twice as long. The default value is 0.  */
@@ -145,12 +145,18 @@ NX_PACKET *next_packet_ptr;
             /* Decrease the number of active ARP entries.  */
             ip_ptr -> nx_ip_arp_dynamic_active_count--;
 
+            /* Cancel the pending update of the entry.  */
+            NX_ARP_ENTRY_NEXT_UPDATE_SET(ip_ptr, arp_entry, 0);
+
             /* Pickup the queued packets head pointer.  */
             next_packet_ptr =  arp_entry -> nx_arp_packets_waiting;
 
             /* Clear the queued packets head pointer.  */
             arp_entry -> nx_arp_packets_waiting =  NX_NULL;
 
+            /* Account for the bytes taken off the queue.  */
+            NX_ARP_ENTRY_PACKETS_CLEARED(ip_ptr, arp_entry);
+
             /* Restore interrupts.  */
             TX_RESTORE
 
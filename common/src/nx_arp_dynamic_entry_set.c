@@ -114,7 +114,7 @@ ULONG         next_hop_address = 0;
     tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
 
     /* Calculate the hash index for the specified IP address.  */
-    index =  (UINT)((ip_address + (ip_address >> 8)) & NX_ROUTE_TABLE_MASK);
+    index =  NX_ARP_HASH(ip_address);
 
     /* Pickup the head pointer of the ARP entries for this IP instance.  */
     arp_list_head =  ip_ptr -> nx_ip_arp_table[index];
@@ -181,8 +181,8 @@ ULONG         next_hop_address = 0;
     arp_ptr -> nx_arp_physical_address_msw =  physical_msw;
     arp_ptr -> nx_arp_physical_address_lsw =  physical_lsw;
     arp_ptr -> nx_arp_retries =               0;
-    arp_ptr -> nx_arp_entry_next_update =     NX_ARP_EXPIRATION_RATE;
     arp_ptr -> nx_arp_ip_interface =          nx_interface;
+    NX_ARP_ENTRY_NEXT_UPDATE_SET(ip_ptr, arp_ptr, NX_ARP_EXPIRATION_RATE);
 
     /* Determine if a physical address was supplied.  */
     if ((physical_msw | physical_lsw) == 0)
@@ -190,7 +190,7 @@ ULONG         next_hop_address = 0;
 
         /* Since there isn't physical mapping, change the update rate
            for possible ARP retries.  */
-        arp_ptr -> nx_arp_entry_next_update =     NX_ARP_UPDATE_RATE;
+        NX_ARP_ENTRY_NEXT_UPDATE_SET(ip_ptr, arp_ptr, NX_ARP_UPDATE_RATE);
 
 
         /* The physical address was not specified so send an
@@ -224,11 +224,17 @@ ULONG         next_hop_address = 0;
             /* Pickup the packet pointer and clear the ARP queue pointer.  */
             queued_list_head =  arp_ptr -> nx_arp_packets_waiting;
             arp_ptr -> nx_arp_packets_waiting =  NX_NULL;
+
+            /* Account for the bytes taken off the queue.  */
+            NX_ARP_ENTRY_PACKETS_CLEARED(ip_ptr, arp_ptr);
         }
 
         /* Restore previous interrupt posture.  */
         TX_RESTORE
 
+        /* Hand the queued packets to the driver as one burst.  */
+        NX_IP_TRANSMIT_BURST_START(ip_ptr);
+
         /* Are there any packets queued to send?  */
         while (queued_list_head)
         {
@@ -251,6 +257,7 @@ ULONG         next_hop_address = 0;
             driver_request.nx_ip_driver_command              =  NX_LINK_PACKET_SEND;
             driver_request.nx_ip_driver_packet               =  packet_ptr;
             driver_request.nx_ip_driver_interface            =  packet_ptr -> nx_packet_ip_interface;
+            NX_IP_DRIVER_TRANSMIT_MORE_SET(driver_request, NX_IP_TRANSMIT_MORE(ip_ptr));
 
             /* Determine if fragmentation is needed.  */
             if (packet_ptr -> nx_packet_length > packet_ptr -> nx_packet_ip_interface -> nx_interface_ip_mtu_size)
@@ -296,6 +303,9 @@ ULONG         next_hop_address = 0;
             }
         }
 
+        /* End the burst, flushing the driver.  */
+        NX_IP_TRANSMIT_BURST_END(ip_ptr);
+
         /* Release the protection on the ARP list.  */
         tx_mutex_put(&(ip_ptr -> nx_ip_protection));
 
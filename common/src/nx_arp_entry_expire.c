@@ -0,0 +1,253 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Address Resolution Protocol (ARP)                                   */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_arp.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_arp_entry_expire                                PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function processes an ARP entry whose update time has arrived. */
+/*    If the entry has not been answered after the maximum number of      */
+/*    retries, it is removed from the active list and any packets queued  */
+/*    on it are released. Otherwise, the ARP request is sent again. A     */
+/*    resolved entry keeps its physical address while it is refreshed, so */
+/*    packets continue to be sent to it.                                  */
+/*                                                                        */
+/*    If NX_ENABLE_ARP_TIMER_WHEEL is defined, a resolved entry that was  */
+/*    not used since its physical address was confirmed is removed        */
+/*    instead of refreshed.                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                IP instance pointer           */
+/*    arp_entry                             ARP entry pointer             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_arp_packet_send                   Send periodic ARP request     */
+/*    _nx_packet_transmit_release           Release queued packet         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_arp_periodic_update               ARP periodic update           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_arp_entry_expire(NX_IP *ip_ptr, NX_ARP *arp_entry)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+NX_PACKET *packet_ptr;
+NX_PACKET *next_packet_ptr;
+
+
+#ifdef NX_ENABLE_ARP_TIMER_WHEEL
+
+    /* Determine if a resolved entry was not used to send a packet since its physical
+       address was confirmed.  Such an entry is removed instead of refreshed, so only
+       entries that are in use cost ARP requests.  */
+    if ((arp_entry -> nx_arp_retries == 0) && (arp_entry -> nx_arp_timer_used == NX_FALSE) &&
+        (arp_entry -> nx_arp_physical_address_msw | arp_entry -> nx_arp_physical_address_lsw))
+    {
+
+        /* Yes, remove the entry as if its retries were exhausted.  */
+        arp_entry -> nx_arp_retries =  NX_ARP_MAXIMUM_RETRIES;
+    }
+#endif /* NX_ENABLE_ARP_TIMER_WHEEL */
+
+    /* Determine if the number of retries has been exceeded.  */
+    if (arp_entry -> nx_arp_retries == NX_ARP_MAXIMUM_RETRIES)
+    {
+
+        /* The number of retries has been exceeded. The entry is removed
+           from the active list and any queued packet is released.  */
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* This ARP entry has expired, remove it from the active ARP list.  Check to make
+           sure it is still active.  */
+        if (arp_entry -> nx_arp_active_list_head)
+        {
+
+            /* Determine if this is the only ARP entry on the list.  */
+            if (arp_entry == arp_entry -> nx_arp_active_next)
+            {
+
+                /* Remove the entry from the list.  */
+                *(arp_entry -> nx_arp_active_list_head) =  NX_NULL;
+            }
+            else
+            {
+
+                /* Remove the entry from a list of more than one entry.  */
+
+                /* Update the list head pointer.  */
+                if (*(arp_entry -> nx_arp_active_list_head) == arp_entry)
+                {
+                    *(arp_entry -> nx_arp_active_list_head) =  arp_entry -> nx_arp_active_next;
+                }
+
+                /* Update the links of the adjacent ARP entries.  */
+                (arp_entry -> nx_arp_active_next) -> nx_arp_active_previous =
+                    arp_entry -> nx_arp_active_previous;
+                (arp_entry -> nx_arp_active_previous) -> nx_arp_active_next =
+                    arp_entry -> nx_arp_active_next;
+            }
+
+            /* Decrease the number of active ARP entries.  */
+            ip_ptr -> nx_ip_arp_dynamic_active_count--;
+
+            /* Clear the active head pointer.  */
+            arp_entry -> nx_arp_active_list_head =  NX_NULL;
+        }
+
+        /* Remove from its current position in the dynamic list.  */
+
+        /* Determine if this is the only ARP entry on the dynamic list.  */
+        if (arp_entry == arp_entry -> nx_arp_pool_next)
+        {
+
+            /* Remove the sole entry from the dynamic list head.  */
+            ip_ptr -> nx_ip_arp_dynamic_list =  NX_NULL;
+        }
+        else
+        {
+
+            /* Remove the entry from a list of more than one entry.  */
+
+            /* Update the links of the adjacent ARP dynamic pool entries.  */
+            (arp_entry -> nx_arp_pool_next) -> nx_arp_pool_previous =
+                arp_entry -> nx_arp_pool_previous;
+            (arp_entry -> nx_arp_pool_previous) -> nx_arp_pool_next =
+                arp_entry -> nx_arp_pool_next;
+
+            /* Update the list head pointer.  */
+            if (ip_ptr -> nx_ip_arp_dynamic_list == arp_entry)
+            {
+                ip_ptr -> nx_ip_arp_dynamic_list =  arp_entry -> nx_arp_pool_next;
+            }
+        }
+
+        /* Place the ARP entry at the end of the dynamic ARP pool, which is where new
+           ARP requests are allocated from.  */
+
+        /* Determine if the dynamic ARP pool is empty.  */
+        if (ip_ptr -> nx_ip_arp_dynamic_list)
+        {
+
+            /* Dynamic list is not empty, add ARP entry to the end of the list.  */
+            arp_entry -> nx_arp_pool_next =
+                ip_ptr -> nx_ip_arp_dynamic_list;
+            arp_entry -> nx_arp_pool_previous =
+                (ip_ptr -> nx_ip_arp_dynamic_list) -> nx_arp_pool_previous;
+            ((ip_ptr -> nx_ip_arp_dynamic_list) -> nx_arp_pool_previous) -> nx_arp_pool_next =
+                arp_entry;
+            (ip_ptr -> nx_ip_arp_dynamic_list) -> nx_arp_pool_previous =   arp_entry;
+        }
+        else
+        {
+
+            /* Dynamic list was empty, just place it at the head of the dynamic list.  */
+            ip_ptr -> nx_ip_arp_dynamic_list =  arp_entry;
+            arp_entry -> nx_arp_pool_next =     arp_entry;
+            arp_entry -> nx_arp_pool_previous = arp_entry;
+        }
+
+        /* Pickup the queued packets head pointer.  */
+        next_packet_ptr =  arp_entry -> nx_arp_packets_waiting;
+
+        /* Clear the queued packets head pointer.  */
+        arp_entry -> nx_arp_packets_waiting =  NX_NULL;
+
+        /* Account for the bytes taken off the queue.  */
+        NX_ARP_ENTRY_PACKETS_CLEARED(ip_ptr, arp_entry);
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Loop to remove all queued packets.  */
+        while (next_packet_ptr)
+        {
+
+            /* Pickup the packet pointer at the head of the queue.  */
+            packet_ptr =  next_packet_ptr;
+
+            /* Move to the next packet in the queue.  */
+            next_packet_ptr =  next_packet_ptr -> nx_packet_queue_next;
+
+            /* Clear the next packet queue pointer.  */
+            packet_ptr -> nx_packet_queue_next =  NX_NULL;
+
+#ifndef NX_DISABLE_IP_INFO
+
+            /* Increment the IP send packets dropped count.  */
+            ip_ptr -> nx_ip_send_packets_dropped++;
+#endif
+
+            /* Release the packet that was queued for the expired ARP entry.  */
+            _nx_packet_transmit_release(packet_ptr);
+        }
+    }
+    else
+    {
+
+        /* We haven't yet had a response to this ARP request so send it again!  */
+
+        /* Increment the ARP retry counter.  */
+        arp_entry -> nx_arp_retries++;
+
+        /* Setup the ARP update rate to the maximum value again.  */
+        NX_ARP_ENTRY_NEXT_UPDATE_SET(ip_ptr, arp_entry, NX_ARP_UPDATE_RATE);
+
+        /* Send the ARP request out.  */
+        _nx_arp_packet_send(ip_ptr, arp_entry -> nx_arp_ip_address, arp_entry -> nx_arp_ip_interface);
+    }
+}
+
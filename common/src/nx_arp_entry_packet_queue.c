@@ -0,0 +1,321 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Address Resolution Protocol (ARP)                                   */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_arp.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_arp_entry_packet_queue                          PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function queues a packet on an ARP entry that is waiting for   */
+/*    address resolution.                                                 */
+/*                                                                        */
+/*    If NX_ENABLE_ARP_QUEUE_BUDGET is defined, the packets queued on all */
+/*    ARP entries share a budget of NX_ARP_QUEUE_BUDGET bytes. The oldest */
+/*    packets of this entry are dropped while the entry holds more than   */
+/*    its equal share of the budget, and the oldest packets of the entry  */
+/*    holding the most bytes are dropped while the budget is exceeded.    */
+/*    Only the entries with queued packets are searched for the latter,   */
+/*    and the new packet is appended at the tail kept in the entry.       */
+/*    Otherwise at most NX_ARP_MAX_QUEUE_DEPTH packets are queued on the  */
+/*    entry and the oldest packet is dropped. In either case the new      */
+/*    packet is always queued.                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                IP instance pointer           */
+/*    arp_entry                             ARP entry pointer             */
+/*    packet_ptr                            Packet pointer                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_arp_entry_queue_remove            Remove entry from ARP queue   */
+/*                                            budget                      */
+/*    _nx_packet_transmit_release           Release transmit packet       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_packet_send                    Send IP packet                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_arp_entry_packet_queue(NX_IP *ip_ptr, NX_ARP *arp_entry, NX_PACKET *packet_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+NX_PACKET *remove_packet;
+NX_PACKET *remove_list;
+#ifdef NX_ENABLE_ARP_QUEUE_BUDGET
+NX_ARP    *arp_ptr;
+NX_ARP    *victim;
+ULONG      share;
+#else
+NX_PACKET *last_packet;
+UINT       queued_count;
+#endif /* NX_ENABLE_ARP_QUEUE_BUDGET */
+
+
+    /* Ensure the queue next pointer is NULL for the packet before it
+       is placed on the ARP waiting queue.  */
+    packet_ptr -> nx_packet_queue_next =  NX_NULL;
+
+    /* Initialize the list of packets to release.  */
+    remove_list =  NX_NULL;
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+#ifdef NX_ENABLE_ARP_QUEUE_BUDGET
+
+    /* Determine if this ARP entry starts waiting with this packet.  */
+    if (arp_entry -> nx_arp_queue_next == NX_NULL)
+    {
+
+        /* Yes, place the entry on the list of entries sharing the budget.  */
+        if (ip_ptr -> nx_ip_arp_queue_list)
+        {
+
+            /* The list is not empty, add the entry to the end.  */
+            arp_entry -> nx_arp_queue_next =      ip_ptr -> nx_ip_arp_queue_list;
+            arp_entry -> nx_arp_queue_previous =  (ip_ptr -> nx_ip_arp_queue_list) -> nx_arp_queue_previous;
+            ((ip_ptr -> nx_ip_arp_queue_list) -> nx_arp_queue_previous) -> nx_arp_queue_next =  arp_entry;
+            (ip_ptr -> nx_ip_arp_queue_list) -> nx_arp_queue_previous =  arp_entry;
+        }
+        else
+        {
+
+            /* The list is empty, the entry points to itself.  */
+            ip_ptr -> nx_ip_arp_queue_list =      arp_entry;
+            arp_entry -> nx_arp_queue_next =      arp_entry;
+            arp_entry -> nx_arp_queue_previous =  arp_entry;
+        }
+        ip_ptr -> nx_ip_arp_queue_entries++;
+    }
+
+    /* Compute the share of the budget available to each waiting entry.  */
+    share =  NX_ARP_QUEUE_BUDGET / ip_ptr -> nx_ip_arp_queue_entries;
+
+    /* Loop to drop packets until the new packet fits.  */
+    for (;;)
+    {
+
+        /* Determine if the new packet fits within the share of this entry.  */
+        if ((arp_entry -> nx_arp_packets_waiting_bytes + packet_ptr -> nx_packet_length) > share)
+        {
+
+            /* No, drop the oldest packet of this entry.  */
+            victim =  arp_entry;
+        }
+        else if ((ip_ptr -> nx_ip_arp_queue_bytes + packet_ptr -> nx_packet_length) > NX_ARP_QUEUE_BUDGET)
+        {
+
+            /* The budget is exhausted by other entries.  Find the entry holding the
+               most bytes among the entries with queued packets.  */
+            victim =  arp_entry;
+            arp_ptr =  ip_ptr -> nx_ip_arp_queue_list;
+            do
+            {
+
+                /* Determine if this entry holds more bytes.  */
+                if (arp_ptr -> nx_arp_packets_waiting_bytes > victim -> nx_arp_packets_waiting_bytes)
+                {
+
+                    /* Yes, remember it.  */
+                    victim =  arp_ptr;
+                }
+
+                /* Move to the next entry with queued packets.  */
+                arp_ptr =  arp_ptr -> nx_arp_queue_next;
+            } while (arp_ptr != ip_ptr -> nx_ip_arp_queue_list);
+        }
+        else
+        {
+
+            /* The packet fits.  */
+            break;
+        }
+
+        /* Pickup the oldest packet of the entry.  */
+        remove_packet =  victim -> nx_arp_packets_waiting;
+
+        /* Determine if there is nothing left to drop.  */
+        if (remove_packet == NX_NULL)
+        {
+
+            /* The entry can always queue one packet.  */
+            break;
+        }
+
+        /* Remove the packet from the ARP queue.  */
+        victim -> nx_arp_packets_waiting =  remove_packet -> nx_packet_queue_next;
+        victim -> nx_arp_packets_waiting_bytes -=  remove_packet -> nx_packet_length;
+        ip_ptr -> nx_ip_arp_queue_bytes -=  remove_packet -> nx_packet_length;
+
+        /* Determine if another entry is no longer waiting.  This entry is still
+           counted since the new packet is about to be queued.  */
+        if ((victim -> nx_arp_packets_waiting == NX_NULL) && (victim != arp_entry))
+        {
+
+            /* Remove the entry from the entries sharing the budget.  */
+            _nx_arp_entry_queue_remove(ip_ptr, victim);
+        }
+
+        /* Place the packet on the list of packets to release.  */
+        remove_packet -> nx_packet_queue_next =  remove_list;
+        remove_list =  remove_packet;
+
+#ifndef NX_DISABLE_IP_INFO
+
+        /* Increment the IP transmit resource error count.  */
+        ip_ptr -> nx_ip_transmit_resource_errors++;
+
+        /* Increment the IP send packets dropped count.  */
+        ip_ptr -> nx_ip_send_packets_dropped++;
+#endif /* !NX_DISABLE_IP_INFO */
+    }
+
+    /* Account for the bytes of the new packet.  */
+    arp_entry -> nx_arp_packets_waiting_bytes +=  packet_ptr -> nx_packet_length;
+    ip_ptr -> nx_ip_arp_queue_bytes +=  packet_ptr -> nx_packet_length;
+
+    /* Determine if the queue is empty.  */
+    if (arp_entry -> nx_arp_packets_waiting == NX_NULL)
+    {
+
+        /* Yes, we have an empty ARP packet queue.  Simply place the
+           packet at the head of the list.  */
+        arp_entry -> nx_arp_packets_waiting =  packet_ptr;
+    }
+    else
+    {
+
+        /* Place the packet after the last packet in the queue.  */
+        (arp_entry -> nx_arp_packets_waiting_tail) -> nx_packet_queue_next =  packet_ptr;
+    }
+    arp_entry -> nx_arp_packets_waiting_tail =  packet_ptr;
+#else
+
+    /* Determine if the queue is empty.  */
+    if (arp_entry -> nx_arp_packets_waiting == NX_NULL)
+    {
+
+        /* Yes, we have an empty ARP packet queue.  Simply place the
+           packet at the head of the list.  */
+        arp_entry -> nx_arp_packets_waiting =  packet_ptr;
+    }
+    else
+    {
+
+        /* Determine how many packets are on the ARP entry's packet
+           queue and remember the last packet in the queue.  We know
+           there is at least one on the queue and another that is
+           going to be queued.  */
+        last_packet =  arp_entry -> nx_arp_packets_waiting;
+        queued_count = 1;
+        while (last_packet -> nx_packet_queue_next)
+        {
+
+            /* Increment the queued count.  */
+            queued_count++;
+
+            /* Yes, move to the next packet in the queue.  */
+            last_packet =  last_packet -> nx_packet_queue_next;
+        }
+
+        /* Place the packet at the end of the list.  */
+        last_packet -> nx_packet_queue_next =  packet_ptr;
+
+        /* Determine if the packets queued has exceeded the queue
+           depth.  */
+        if (queued_count >= NX_ARP_MAX_QUEUE_DEPTH)
+        {
+
+            /* Save the packet pointer at the head of the list.  */
+            remove_packet =  arp_entry -> nx_arp_packets_waiting;
+
+            /* Remove the packet from the ARP queue.  */
+            arp_entry -> nx_arp_packets_waiting =  remove_packet -> nx_packet_queue_next;
+
+            /* Clear the remove packet queue next pointer.  */
+            remove_packet -> nx_packet_queue_next =  NX_NULL;
+
+            /* Place the packet on the list of packets to release.  */
+            remove_list =  remove_packet;
+
+#ifndef NX_DISABLE_IP_INFO
+
+            /* Increment the IP transmit resource error count.  */
+            ip_ptr -> nx_ip_transmit_resource_errors++;
+
+            /* Increment the IP send packets dropped count.  */
+            ip_ptr -> nx_ip_send_packets_dropped++;
+#endif /* !NX_DISABLE_IP_INFO */
+        }
+    }
+#endif /* NX_ENABLE_ARP_QUEUE_BUDGET */
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Loop to release the packets that were dropped from the queues.  */
+    while (remove_list)
+    {
+
+        /* Pickup the packet at the head of the list.  */
+        remove_packet =  remove_list;
+
+        /* Move to the next packet in the list.  */
+        remove_list =  remove_list -> nx_packet_queue_next;
+
+        /* Clear the remove packet queue next pointer.  */
+        remove_packet -> nx_packet_queue_next =  NX_NULL;
+
+        /* Release the packet.  */
+        _nx_packet_transmit_release(remove_packet);
+    }
+}
+
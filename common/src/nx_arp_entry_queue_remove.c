@@ -0,0 +1,128 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Address Resolution Protocol (ARP)                                   */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_arp.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_arp_entry_queue_remove                          PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes an ARP entry whose queued packets were taken  */
+/*    off or dropped from the list of entries sharing the ARP queue       */
+/*    budget, and takes its remaining bytes out of the budget. It is      */
+/*    called with interrupts disabled.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                IP instance pointer           */
+/*    arp_entry                             ARP entry pointer             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_arp_entry_packet_queue            Queue packet on ARP entry     */
+/*    _nx_arp_entry_expire                  Expire ARP entry              */
+/*    _nx_arp_entry_allocate                Allocate ARP entry            */
+/*    _nx_arp_packet_receive                Process ARP packet            */
+/*    _nx_arp_dynamic_entry_set             Set dynamic ARP entry         */
+/*    _nx_arp_dynamic_entries_invalidate    Invalidate dynamic entries    */
+/*    _nx_arp_static_entry_create           Create static ARP entry       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_arp_entry_queue_remove(NX_IP *ip_ptr, NX_ARP *arp_entry)
+{
+#ifdef NX_ENABLE_ARP_QUEUE_BUDGET
+
+    /* Determine if the entry is on the list of entries with queued packets.  */
+    if (arp_entry -> nx_arp_queue_next == NX_NULL)
+    {
+
+        /* No, nothing to do.  */
+        return;
+    }
+
+    /* Take the remaining bytes of the entry out of the budget.  */
+    ip_ptr -> nx_ip_arp_queue_bytes -=  arp_entry -> nx_arp_packets_waiting_bytes;
+    arp_entry -> nx_arp_packets_waiting_bytes =  0;
+
+    /* See if this is the only entry on the list.  */
+    if (arp_entry == arp_entry -> nx_arp_queue_next)
+    {
+
+        /* Yes, the list is now empty.  */
+        ip_ptr -> nx_ip_arp_queue_list =  NX_NULL;
+    }
+    else
+    {
+
+        /* Update the list head pointer, if necessary.  */
+        if (ip_ptr -> nx_ip_arp_queue_list == arp_entry)
+        {
+            ip_ptr -> nx_ip_arp_queue_list =  arp_entry -> nx_arp_queue_next;
+        }
+
+        /* Update the links of the adjacent entries.  */
+        (arp_entry -> nx_arp_queue_next) -> nx_arp_queue_previous =  arp_entry -> nx_arp_queue_previous;
+        (arp_entry -> nx_arp_queue_previous) -> nx_arp_queue_next =  arp_entry -> nx_arp_queue_next;
+    }
+
+    /* Clear the links of the entry.  */
+    arp_entry -> nx_arp_queue_next =      NX_NULL;
+    arp_entry -> nx_arp_queue_previous =  NX_NULL;
+
+    /* One less entry shares the budget.  */
+    ip_ptr -> nx_ip_arp_queue_entries--;
+
+#else /* !NX_ENABLE_ARP_QUEUE_BUDGET */
+    NX_PARAMETER_NOT_USED(ip_ptr);
+    NX_PARAMETER_NOT_USED(arp_entry);
+#endif /* NX_ENABLE_ARP_QUEUE_BUDGET */
+}
+
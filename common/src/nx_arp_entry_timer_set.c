@@ -0,0 +1,136 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Address Resolution Protocol (ARP)                                   */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_arp.h"
+
+
+#ifdef NX_ENABLE_ARP_TIMER_WHEEL
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_arp_entry_timer_set                             PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets the number of seconds until the next update of an*/
+/*    ARP entry, where zero cancels the pending update. The entry is moved*/
+/*    to the timer wheel slot of its update time, so the ARP periodic     */
+/*    update only visits the entries that are due.                        */
+/*                                                                        */
+/*    When an update is scheduled, the usage flag of the entry is         */
+/*    cleared, so a resolved entry is only refreshed if it is used again  */
+/*    before the update.                                                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                IP instance pointer           */
+/*    arp_entry                             ARP entry pointer             */
+/*    next_update                           Seconds until next update     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_arp_dynamic_entries_invalidate    Invalidate dynamic entries    */
+/*    _nx_arp_dynamic_entry_set             Set dynamic ARP entry         */
+/*    _nx_arp_entry_allocate                Allocate ARP entry            */
+/*    _nx_arp_entry_expire                  Process ARP entry expiration  */
+/*    _nx_arp_packet_receive                Process received ARP packet   */
+/*    _nx_arp_periodic_update               ARP periodic update           */
+/*    _nx_arp_static_entry_create           Create static ARP entry       */
+/*    _nx_ip_packet_send                    Send IP packet                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_arp_entry_timer_set(NX_IP *ip_ptr, NX_ARP *arp_entry, UINT next_update)
+{
+
+NX_ARP **slot_ptr;
+
+
+    /* Determine if an update is pending.  */
+    if (arp_entry -> nx_arp_entry_next_update)
+    {
+
+        /* Yes, remove the entry from its timer wheel slot.  */
+        slot_ptr =  &(ip_ptr -> nx_ip_arp_timer_wheel[arp_entry -> nx_arp_timer_expiry & (NX_ARP_TIMER_WHEEL_SIZE - 1)]);
+        if (arp_entry -> nx_arp_timer_previous)
+        {
+            (arp_entry -> nx_arp_timer_previous) -> nx_arp_timer_next =  arp_entry -> nx_arp_timer_next;
+        }
+        else
+        {
+            *slot_ptr =  arp_entry -> nx_arp_timer_next;
+        }
+
+        if (arp_entry -> nx_arp_timer_next)
+        {
+            (arp_entry -> nx_arp_timer_next) -> nx_arp_timer_previous =  arp_entry -> nx_arp_timer_previous;
+        }
+    }
+
+    /* Save the new update time.  */
+    arp_entry -> nx_arp_entry_next_update =  next_update;
+
+    /* Determine if an update is requested.  */
+    if (next_update)
+    {
+
+        /* Yes, start a new usage period.  */
+        arp_entry -> nx_arp_timer_used =  NX_FALSE;
+
+        /* Place the entry at the front of the slot of its update tick.  */
+        arp_entry -> nx_arp_timer_expiry =  ip_ptr -> nx_ip_arp_timer_tick + next_update;
+        slot_ptr =  &(ip_ptr -> nx_ip_arp_timer_wheel[arp_entry -> nx_arp_timer_expiry & (NX_ARP_TIMER_WHEEL_SIZE - 1)]);
+        arp_entry -> nx_arp_timer_previous =  NX_NULL;
+        arp_entry -> nx_arp_timer_next =  *slot_ptr;
+        if (*slot_ptr)
+        {
+            (*slot_ptr) -> nx_arp_timer_previous =  arp_entry;
+        }
+        *slot_ptr =  arp_entry;
+    }
+}
+#endif /* NX_ENABLE_ARP_TIMER_WHEEL */
+
@@ -0,0 +1,106 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Address Resolution Protocol (ARP)                                   */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_arp.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_arp_entry_touch                                 PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function marks a dynamic ARP entry as the most recently used by*/
+/*    moving it to the front of the dynamic ARP list. Since               */
+/*    _nx_arp_entry_allocate reuses the entry at the end of the list, the */
+/*    least recently used entry is always reused first, without searching.*/
+/*                                                                        */
+/*    The caller must have interrupts disabled.                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                IP instance pointer           */
+/*    arp_entry                             ARP entry pointer             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_packet_send                    Send IP packet                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_arp_entry_touch(NX_IP *ip_ptr, NX_ARP *arp_entry)
+{
+
+#ifdef NX_ENABLE_ARP_TIMER_WHEEL
+
+    /* Record that the entry is in use, so it is refreshed when its update is due.  */
+    arp_entry -> nx_arp_timer_used =  NX_TRUE;
+#endif /* NX_ENABLE_ARP_TIMER_WHEEL */
+
+    /* Determine if this is a dynamic entry that is not already at the front of
+       the dynamic list.  */
+    if ((arp_entry -> nx_arp_route_static == NX_FALSE) &&
+        (arp_entry != ip_ptr -> nx_ip_arp_dynamic_list))
+    {
+
+        /* Link up the neighbors first.  */
+        (arp_entry -> nx_arp_pool_next) -> nx_arp_pool_previous =
+            arp_entry -> nx_arp_pool_previous;
+        (arp_entry -> nx_arp_pool_previous) -> nx_arp_pool_next =
+            arp_entry -> nx_arp_pool_next;
+
+        /* Now link this ARP entry to the head of the list.  */
+        arp_entry -> nx_arp_pool_next =  ip_ptr -> nx_ip_arp_dynamic_list;
+        arp_entry -> nx_arp_pool_previous =    (arp_entry -> nx_arp_pool_next) -> nx_arp_pool_previous;
+        (arp_entry -> nx_arp_pool_previous) -> nx_arp_pool_next =  arp_entry;
+        (arp_entry -> nx_arp_pool_next) -> nx_arp_pool_previous =  arp_entry;
+
+        /* Now set the list head to this ARP entry.  */
+        ip_ptr -> nx_ip_arp_dynamic_list =  arp_entry;
+    }
+}
+
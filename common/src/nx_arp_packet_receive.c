@@ -432,7 +432,7 @@ NX_INTERFACE *interface_ptr;
     {
 
         /* Calculate the hash index for the sender IP address.  */
-        index =  (UINT)((sender_ip + (sender_ip >> 8)) & NX_ROUTE_TABLE_MASK);
+        index =  NX_ARP_HASH(sender_ip);
 
         /* Pickup the first ARP entry.  */
         arp_ptr =  ip_ptr -> nx_ip_arp_table[index];
@@ -484,7 +484,7 @@ NX_INTERFACE *interface_ptr;
 
             /* Set the update rate to the expiration rate since we now have an ARP
                response.  */
-            arp_ptr -> nx_arp_entry_next_update =  NX_ARP_EXPIRATION_RATE;
+            NX_ARP_ENTRY_NEXT_UPDATE_SET(ip_ptr, arp_ptr, NX_ARP_EXPIRATION_RATE);
 
             /* Reset the retry counter for this ARP entry.  */
             arp_ptr -> nx_arp_retries =  0;
@@ -505,6 +505,9 @@ NX_INTERFACE *interface_ptr;
                 /* Pickup the packet pointer and clear the ARP queue pointer.  */
                 queued_list_head =  arp_ptr -> nx_arp_packets_waiting;
                 arp_ptr -> nx_arp_packets_waiting =  NX_NULL;
+
+                /* Account for the bytes taken off the queue.  */
+                NX_ARP_ENTRY_PACKETS_CLEARED(ip_ptr, arp_ptr);
             }
 
             /* Restore previous interrupt posture.  */
@@ -540,7 +543,7 @@ NX_INTERFACE *interface_ptr;
     {
 
         /* Calculate the hash index for the sender IP address.  */
-        index =  (UINT)((sender_ip + (sender_ip >> 8)) & NX_ROUTE_TABLE_MASK);
+        index =  NX_ARP_HASH(sender_ip);
 
         /* Allocate a new ARP entry in advance of the need to send to the IP
            address.  */
@@ -554,13 +557,16 @@ NX_INTERFACE *interface_ptr;
             arp_ptr -> nx_arp_ip_address =            sender_ip;
             arp_ptr -> nx_arp_physical_address_msw =  sender_physical_msw;
             arp_ptr -> nx_arp_physical_address_lsw =  sender_physical_lsw;
-            arp_ptr -> nx_arp_entry_next_update =     NX_ARP_EXPIRATION_RATE;
             arp_ptr -> nx_arp_retries =               0;
             arp_ptr -> nx_arp_ip_interface =          interface_ptr;
+            NX_ARP_ENTRY_NEXT_UPDATE_SET(ip_ptr, arp_ptr, NX_ARP_EXPIRATION_RATE);
         }
     }
 #endif /* NX_DISABLE_ARP_AUTO_ENTRY */
 
+    /* Hand the queued packets to the driver as one burst.  */
+    NX_IP_TRANSMIT_BURST_START(ip_ptr);
+
     /* Are there any packets queued to send?  */
     while (queued_list_head)
     {
@@ -581,6 +587,7 @@ NX_INTERFACE *interface_ptr;
         driver_request.nx_ip_driver_command              =  NX_LINK_PACKET_SEND;
         driver_request.nx_ip_driver_packet               =  packet_ptr;
         driver_request.nx_ip_driver_interface            =  packet_ptr -> nx_packet_ip_interface;
+        NX_IP_DRIVER_TRANSMIT_MORE_SET(driver_request, NX_IP_TRANSMIT_MORE(ip_ptr));
 
         /* Determine if fragmentation is needed.  */
         if (packet_ptr -> nx_packet_length > packet_ptr -> nx_packet_ip_interface -> nx_interface_ip_mtu_size)
@@ -626,5 +633,8 @@ NX_INTERFACE *interface_ptr;
             (packet_ptr -> nx_packet_ip_interface -> nx_interface_link_driver_entry) (&driver_request);
         }
     }
+
+    /* End the burst, flushing the driver.  */
+    NX_IP_TRANSMIT_BURST_END(ip_ptr);
 }
 
@@ -47,6 +47,9 @@
 /*    through the dynamic ARP list to see if another ARP request needs to */
 /*    sent.                                                               */
 /*                                                                        */
+/*    If NX_ENABLE_ARP_TIMER_WHEEL is defined, only the entries in the    */
+/*    timer wheel slot of the current tick are visited.                   */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    ip_address                            IP address in a ULONG         */
@@ -57,8 +60,8 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nx_arp_packet_send                   Send periodic ARP request out */
-/*    _nx_packet_transmit_release           Release queued packet         */
+/*    _nx_arp_entry_expire                  Process ARP entry expiration  */
+/*    _nx_arp_entry_timer_set               Cancel ARP entry update       */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -74,12 +77,39 @@
 VOID  _nx_arp_periodic_update(NX_IP *ip_ptr)
 {
 
-TX_INTERRUPT_SAVE_AREA
+ULONG   i;
+NX_ARP *arp_entry;
+#ifdef NX_ENABLE_ARP_TIMER_WHEEL
+NX_ARP *next_arp_entry;
+
+
+    /* Advance the ARP tick.  */
+    ip_ptr -> nx_ip_arp_timer_tick++;
+
+    /* Pickup the first ARP entry in the timer wheel slot of this tick.  */
+    arp_entry =  ip_ptr -> nx_ip_arp_timer_wheel[ip_ptr -> nx_ip_arp_timer_tick & (NX_ARP_TIMER_WHEEL_SIZE - 1)];
+
+    /* Loop through the entries of the slot.  Entries due on a later turn of the wheel
+       stay in the slot.  */
+    while (arp_entry)
+    {
+
+        /* Pickup the next entry first, since this entry leaves the slot if it is due.  */
+        next_arp_entry =  arp_entry -> nx_arp_timer_next;
+
+        /* Determine if an ARP expiration is present.  */
+        if (arp_entry -> nx_arp_timer_expiry == ip_ptr -> nx_ip_arp_timer_tick)
+        {
+
+            /* Yes, take the entry off the timer wheel and process the expiration.  */
+            NX_ARP_ENTRY_NEXT_UPDATE_SET(ip_ptr, arp_entry, 0);
+            _nx_arp_entry_expire(ip_ptr, arp_entry);
+        }
 
-ULONG      i;
-NX_ARP    *arp_entry;
-NX_PACKET *packet_ptr;
-NX_PACKET *next_packet_ptr;
+        /* Move to the next ARP entry.  */
+        arp_entry =  next_arp_entry;
+    }
+#else
 
 
     /* Pickup pointer to ARP dynamic list.  */
@@ -100,159 +130,15 @@ NX_PACKET *next_packet_ptr;
             if (!arp_entry -> nx_arp_entry_next_update)
             {
 
-                /* Yes, an ARP expiration is present.   */
-
-                /* Determine if an ARP expiration is present.  */
-                if (arp_entry -> nx_arp_retries == NX_ARP_MAXIMUM_RETRIES)
-                {
-
-                    /* The number of retries has been exceeded. The entry is removed
-                       from the active list and any queued packet is released.  */
-
-                    /* Disable interrupts.  */
-                    TX_DISABLE
-
-                    /* This ARP entry has expired, remove it from the active ARP list.  Check to make
-                       sure it is still active.  */
-                    if (arp_entry -> nx_arp_active_list_head)
-                    {
-
-                        /* Determine if this is the only ARP entry on the list.  */
-                        if (arp_entry == arp_entry -> nx_arp_active_next)
-                        {
-
-                            /* Remove the entry from the list.  */
-                            *(arp_entry -> nx_arp_active_list_head) =  NX_NULL;
-                        }
-                        else
-                        {
-
-                            /* Remove the entry from a list of more than one entry.  */
-
-                            /* Update the list head pointer.  */
-                            if (*(arp_entry -> nx_arp_active_list_head) == arp_entry)
-                            {
-                                *(arp_entry -> nx_arp_active_list_head) =  arp_entry -> nx_arp_active_next;
-                            }
-
-                            /* Update the links of the adjacent ARP entries.  */
-                            (arp_entry -> nx_arp_active_next) -> nx_arp_active_previous =
-                                arp_entry -> nx_arp_active_previous;
-                            (arp_entry -> nx_arp_active_previous) -> nx_arp_active_next =
-                                arp_entry -> nx_arp_active_next;
-                        }
-
-                        /* Decrease the number of active ARP entries.  */
-                        ip_ptr -> nx_ip_arp_dynamic_active_count--;
-
-                        /* Clear the active head pointer.  */
-                        arp_entry -> nx_arp_active_list_head =  NX_NULL;
-                    }
-
-                    /* Remove from its current position in the dynamic list.  */
-
-                    /* Determine if this is the only ARP entry on the dynamic list.  */
-                    if (arp_entry == arp_entry -> nx_arp_pool_next)
-                    {
-
-                        /* Remove the sole entry from the dynamic list head.  */
-                        ip_ptr -> nx_ip_arp_dynamic_list =  NX_NULL;
-                    }
-                    else
-                    {
-
-                        /* Remove the entry from a list of more than one entry.  */
-
-                        /* Update the links of the adjacent ARP dynamic pool entries.  */
-                        (arp_entry -> nx_arp_pool_next) -> nx_arp_pool_previous =
-                            arp_entry -> nx_arp_pool_previous;
-                        (arp_entry -> nx_arp_pool_previous) -> nx_arp_pool_next =
-                            arp_entry -> nx_arp_pool_next;
-
-                        /* Update the list head pointer.  */
-                        if (ip_ptr -> nx_ip_arp_dynamic_list == arp_entry)
-                        {
-                            ip_ptr -> nx_ip_arp_dynamic_list =  arp_entry -> nx_arp_pool_next;
-                        }
-                    }
-
-                    /* Place the ARP entry at the end of the dynamic ARP pool, which is where new
-                       ARP requests are allocated from.  */
-
-                    /* Determine if the dynamic ARP pool is empty.  */
-                    if (ip_ptr -> nx_ip_arp_dynamic_list)
-                    {
-
-                        /* Dynamic list is not empty, add ARP entry to the end of the list.  */
-                        arp_entry -> nx_arp_pool_next =
-                            ip_ptr -> nx_ip_arp_dynamic_list;
-                        arp_entry -> nx_arp_pool_previous =
-                            (ip_ptr -> nx_ip_arp_dynamic_list) -> nx_arp_pool_previous;
-                        ((ip_ptr -> nx_ip_arp_dynamic_list) -> nx_arp_pool_previous) -> nx_arp_pool_next =
-                            arp_entry;
-                        (ip_ptr -> nx_ip_arp_dynamic_list) -> nx_arp_pool_previous =   arp_entry;
-                    }
-                    else
-                    {
-
-                        /* Dynamic list was empty, just place it at the head of the dynamic list.  */
-                        ip_ptr -> nx_ip_arp_dynamic_list =  arp_entry;
-                        arp_entry -> nx_arp_pool_next =     arp_entry;
-                        arp_entry -> nx_arp_pool_previous = arp_entry;
-                    }
-
-                    /* Pickup the queued packets head pointer.  */
-                    next_packet_ptr =  arp_entry -> nx_arp_packets_waiting;
-
-                    /* Clear the queued packets head pointer.  */
-                    arp_entry -> nx_arp_packets_waiting =  NX_NULL;
-
-                    /* Restore interrupts.  */
-                    TX_RESTORE
-
-                    /* Loop to remove all queued packets.  */
-                    while (next_packet_ptr)
-                    {
-
-                        /* Pickup the packet pointer at the head of the queue.  */
-                        packet_ptr =  next_packet_ptr;
-
-                        /* Move to the next packet in the queue.  */
-                        next_packet_ptr =  next_packet_ptr -> nx_packet_queue_next;
-
-                        /* Clear the next packet queue pointer.  */
-                        packet_ptr -> nx_packet_queue_next =  NX_NULL;
-
-#ifndef NX_DISABLE_IP_INFO
-
-                        /* Increment the IP send packets dropped count.  */
-                        ip_ptr -> nx_ip_send_packets_dropped++;
-#endif
-
-                        /* Release the packet that was queued for the expired ARP entry.  */
-                        _nx_packet_transmit_release(packet_ptr);
-                    }
-                }
-                else
-                {
-
-                    /* We haven't yet had a response to this ARP request so send it again!  */
-
-                    /* Increment the ARP retry counter.  */
-                    arp_entry -> nx_arp_retries++;
-
-                    /* Setup the ARP update rate to the maximum value again.  */
-                    arp_entry -> nx_arp_entry_next_update =  NX_ARP_UPDATE_RATE;
-
-                    /* Send the ARP request out.  */
-                    _nx_arp_packet_send(ip_ptr, arp_entry -> nx_arp_ip_address, arp_entry -> nx_arp_ip_interface);
-                }
+                /* Yes, an ARP expiration is present.  */
+                _nx_arp_entry_expire(ip_ptr, arp_entry);
             }
         }
 
         /* Move to the next ARP entry.  */
         arp_entry =  arp_entry -> nx_arp_pool_next;
     }
+#endif /* NX_ENABLE_ARP_TIMER_WHEEL */
 
     /* Reduce the defend timeout of interfaces.  */
     for (i = 0; i < NX_MAX_PHYSICAL_INTERFACES; i++)
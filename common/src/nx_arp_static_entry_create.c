@@ -162,6 +162,9 @@ ULONG         next_hop_address;
 
             /* Clear the queued packets head pointer.  */
             arp_entry -> nx_arp_packets_waiting =  NX_NULL;
+
+            /* Account for the bytes taken off the queue.  */
+            NX_ARP_ENTRY_PACKETS_CLEARED(ip_ptr, arp_entry);
         }
 
         /* Remove this entry from the ARP dynamic list.  */
@@ -218,10 +221,10 @@ ULONG         next_hop_address;
         }
 
         /* Calculate the hash index for the IP address.  */
-        index =  (UINT)((ip_address + (ip_address >> 8)) & NX_ROUTE_TABLE_MASK);
+        index =  NX_ARP_HASH(ip_address);
 
         /* Indicate the entry does not need updating.  */
-        arp_entry -> nx_arp_entry_next_update =  0;
+        NX_ARP_ENTRY_NEXT_UPDATE_SET(ip_ptr, arp_entry, 0);
 
         /* Place the important information in the ARP structure.  */
         arp_entry -> nx_arp_route_static =          NX_TRUE;
@@ -60,6 +60,7 @@
 /*                                                                        */
 /*    _nx_icmp_checksum_compute             Computer ICMP checksum        */
 /*    _nx_ip_packet_send                    Send ICMP packet out          */
+/*    _nx_ip_path_mtu_update                Record path MTU               */
 /*    _nx_packet_release                    Packet release function       */
 /*    _tx_thread_system_resume              Resume suspended thread       */
 /*    _tx_thread_system_preempt_check       Check for preemption          */
@@ -91,6 +92,12 @@ ULONG           sequence_num;
 #if (!defined(NX_DISABLE_ICMP_TX_CHECKSUM) || !defined(NX_DISABLE_ICMP_RX_CHECKSUM))
 ULONG           checksum;
 #endif
+#ifdef NX_ENABLE_IP_PATH_MTU_DISCOVERY
+NX_IP_HEADER   *ip_header_ptr;
+ULONG           path_mtu;
+ULONG           destination_ip;
+ULONG           packet_length;
+#endif /* NX_ENABLE_IP_PATH_MTU_DISCOVERY */
 
     /* Point to the ICMP message header.  */
     header_ptr =  (NX_ICMP_HEADER *)packet_ptr -> nx_packet_prepend_ptr;
@@ -313,6 +320,36 @@ ULONG           checksum;
         _nx_ip_packet_send(ip_ptr, packet_ptr, *(message_ptr - 2),
                            NX_IP_NORMAL, NX_IP_TIME_TO_LIVE, NX_IP_ICMP, NX_FRAGMENT_OKAY);
     }
+#ifdef NX_ENABLE_IP_PATH_MTU_DISCOVERY
+    else if ((message_type == NX_ICMP_DEST_UNREACHABLE_TYPE) &&
+             (((header_ptr -> nx_icmp_header_word_0 >> 16) & 0xFF) == NX_ICMP_FRAMENT_NEEDED_CODE) &&
+             ((ULONG)(packet_ptr -> nx_packet_append_ptr - packet_ptr -> nx_packet_prepend_ptr) >=
+              (sizeof(NX_ICMP_HEADER) + sizeof(NX_IP_HEADER))))
+    {
+
+        /* A packet sent with the don't fragment bit set was too big for a link in the path.
+           Pickup the next hop MTU from the low 16 bits of the second ICMP header word.  */
+        path_mtu =  header_ptr -> nx_icmp_header_word_1;
+        NX_CHANGE_ULONG_ENDIAN(path_mtu);
+        path_mtu =  path_mtu & NX_LOWER_16_MASK;
+
+        /* Point to the IP header of the packet that was too big, which follows the ICMP header.  */
+        ip_header_ptr =  (NX_IP_HEADER *)(packet_ptr -> nx_packet_prepend_ptr + sizeof(NX_ICMP_HEADER));
+
+        /* Pickup its destination and total length.  */
+        destination_ip =  ip_header_ptr -> nx_ip_header_destination_ip;
+        NX_CHANGE_ULONG_ENDIAN(destination_ip);
+        packet_length =  ip_header_ptr -> nx_ip_header_word_0;
+        NX_CHANGE_ULONG_ENDIAN(packet_length);
+        packet_length =  packet_length & NX_LOWER_16_MASK;
+
+        /* Record the path MTU to the destination.  */
+        _nx_ip_path_mtu_update(ip_ptr, destination_ip, path_mtu, packet_length);
+
+        /* Release the ICMP message.  */
+        _nx_packet_release(packet_ptr);
+    }
+#endif /* NX_ENABLE_IP_PATH_MTU_DISCOVERY */
     else
     {
 
@@ -0,0 +1,109 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Group Management Protocol (IGMP)                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_igmp.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_igmp_group_find                                 PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function finds the entry of a joined multicast group in the    */
+/*    IGMP group table of the IP instance.                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                IP instance pointer           */
+/*    group_address                         Multicast group address       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    group_ptr                             Group entry, or NX_NULL       */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_igmp_multicast_check              Check for multicast match     */
+/*    _nx_igmp_multicast_interface_join     Join multicast group          */
+/*    _nx_igmp_multicast_leave              Leave multicast group         */
+/*    _nx_igmp_packet_process               Process IGMP packet           */
+/*    _nx_ip_packet_send                    Send IP packet                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+#ifdef NX_ENABLE_IGMP_GROUP_TABLE
+NX_IGMP_GROUP  *_nx_igmp_group_find(NX_IP *ip_ptr, ULONG group_address)
+{
+
+NX_IGMP_GROUP *group_ptr;
+
+
+    /* Determine if the group table is set up.  */
+    if (ip_ptr -> nx_ip_igmp_group_table == NX_NULL)
+    {
+        return(NX_NULL);
+    }
+
+    /* Pickup the first group in the hash bucket of the address.  */
+    group_ptr =  ip_ptr -> nx_ip_igmp_group_table[NX_IGMP_GROUP_HASH(ip_ptr, group_address)];
+
+    /* Loop through the groups in the bucket.  */
+    while (group_ptr)
+    {
+
+        /* Check for a match.  */
+        if (group_ptr -> nx_igmp_group_address == group_address)
+        {
+            break;
+        }
+
+        /* Move to the next group in the bucket.  */
+        group_ptr =  group_ptr -> nx_igmp_group_hash_next;
+    }
+
+    /* Return the group entry.  */
+    return(group_ptr);
+}
+#endif /* NX_ENABLE_IGMP_GROUP_TABLE */
+
@@ -0,0 +1,134 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Group Management Protocol (IGMP)                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_igmp.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_igmp_group_table_enable                         PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets up the IGMP group table of the IP instance in    */
+/*    the supplied memory. The memory holds a power of two number of hash */
+/*    buckets followed by the group entries, so its size determines how   */
+/*    many multicast groups can be joined.                                */
+/*                                                                        */
+/*    This service is only available if NX_ENABLE_IGMP_GROUP_TABLE is     */
+/*    defined.                                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                IP instance pointer           */
+/*    table_memory                          Pointer to table memory       */
+/*    table_size                            Size of table memory          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Obtain protection mutex       */
+/*    tx_mutex_put                          Release protection mutex      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_igmp_group_table_enable(NX_IP *ip_ptr, VOID *table_memory, ULONG table_size)
+{
+#ifdef NX_ENABLE_IGMP_GROUP_TABLE
+
+ULONG          i;
+ULONG          buckets;
+ULONG          entries;
+NX_IGMP_GROUP *group_ptr;
+
+
+    /* Obtain the IP mutex so we can set up the group table.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Clear the entire table memory.  */
+    memset(table_memory, 0, table_size);
+
+    /* Determine the number of hash buckets, the largest power of two that is no more
+       than the number of entries that would fit with one bucket per entry.  */
+    entries =  table_size / (sizeof(NX_IGMP_GROUP) + sizeof(NX_IGMP_GROUP *));
+    buckets =  1;
+    while ((buckets << 1) <= entries)
+    {
+        buckets =  buckets << 1;
+    }
+
+    /* The group entries follow the hash buckets.  */
+    group_ptr =  (NX_IGMP_GROUP *)(((NX_IGMP_GROUP **)table_memory) + buckets);
+    entries =    (table_size - (buckets * sizeof(NX_IGMP_GROUP *))) / sizeof(NX_IGMP_GROUP);
+
+    /* Link all group entries on the free list.  */
+    for (i = 0; i < (entries - 1); i++)
+    {
+        group_ptr[i].nx_igmp_group_hash_next =  &group_ptr[i + 1];
+    }
+    group_ptr[i].nx_igmp_group_hash_next =  NX_NULL;
+
+    /* Store the group table information in the IP control block.  */
+    ip_ptr -> nx_ip_igmp_group_free_list =   group_ptr;
+    ip_ptr -> nx_ip_igmp_group_list =        NX_NULL;
+    ip_ptr -> nx_ip_igmp_group_table_mask =  buckets - 1;
+    ip_ptr -> nx_ip_igmp_group_table =       (NX_IGMP_GROUP **)table_memory;
+
+    /* Release the IP protection.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Return success!  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_IGMP_GROUP_TABLE */
+    NX_PARAMETER_NOT_USED(ip_ptr);
+    NX_PARAMETER_NOT_USED(table_memory);
+    NX_PARAMETER_NOT_USED(table_size);
+
+    return(NX_NOT_SUPPORTED);
+#endif /* NX_ENABLE_IGMP_GROUP_TABLE */
+}
+
@@ -0,0 +1,127 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Group Management Protocol (IGMP)                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_igmp.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_igmp_group_timer_set                            PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets the number of seconds until the membership       */
+/*    report of a multicast group is sent. The group is moved to the slot */
+/*    of the IGMP timer wheel for the tick at which the report is due. A  */
+/*    report time of zero cancels the pending report.                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                IP instance pointer           */
+/*    group_ptr                             Group entry pointer           */
+/*    report_time                           Seconds until the report, or  */
+/*                                            zero                        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_igmp_multicast_interface_join     Join multicast group          */
+/*    _nx_igmp_multicast_leave              Leave multicast group         */
+/*    _nx_igmp_packet_process               Process IGMP packet           */
+/*    _nx_igmp_periodic_processing          IGMP periodic processing      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+#ifdef NX_ENABLE_IGMP_GROUP_TABLE
+VOID  _nx_igmp_group_timer_set(NX_IP *ip_ptr, NX_IGMP_GROUP *group_ptr, ULONG report_time)
+{
+
+NX_IGMP_GROUP **slot_ptr;
+
+
+    /* Determine if a report is pending.  */
+    if (group_ptr -> nx_igmp_group_timer_active)
+    {
+
+        /* Yes, remove the group from its timer wheel slot.  */
+        slot_ptr =  &(ip_ptr -> nx_ip_igmp_timer_wheel[group_ptr -> nx_igmp_group_timer_expiry & (NX_IGMP_TIMER_WHEEL_SIZE - 1)]);
+        if (group_ptr -> nx_igmp_group_timer_previous)
+        {
+            (group_ptr -> nx_igmp_group_timer_previous) -> nx_igmp_group_timer_next =  group_ptr -> nx_igmp_group_timer_next;
+        }
+        else
+        {
+            *slot_ptr =  group_ptr -> nx_igmp_group_timer_next;
+        }
+
+        if (group_ptr -> nx_igmp_group_timer_next)
+        {
+            (group_ptr -> nx_igmp_group_timer_next) -> nx_igmp_group_timer_previous =  group_ptr -> nx_igmp_group_timer_previous;
+        }
+
+        /* The report is no longer pending.  */
+        group_ptr -> nx_igmp_group_timer_active =  NX_FALSE;
+    }
+
+    /* Determine if a report is requested.  */
+    if (report_time)
+    {
+
+        /* Yes, place the group at the front of the slot of its report tick.  */
+        group_ptr -> nx_igmp_group_timer_expiry =  ip_ptr -> nx_ip_igmp_timer_tick + report_time;
+        slot_ptr =  &(ip_ptr -> nx_ip_igmp_timer_wheel[group_ptr -> nx_igmp_group_timer_expiry & (NX_IGMP_TIMER_WHEEL_SIZE - 1)]);
+        group_ptr -> nx_igmp_group_timer_previous =  NX_NULL;
+        group_ptr -> nx_igmp_group_timer_next =  *slot_ptr;
+        if (*slot_ptr)
+        {
+            (*slot_ptr) -> nx_igmp_group_timer_previous =  group_ptr;
+        }
+        *slot_ptr =  group_ptr;
+        group_ptr -> nx_igmp_group_timer_active =  NX_TRUE;
+    }
+}
+#endif /* NX_ENABLE_IGMP_GROUP_TABLE */
+
@@ -59,7 +59,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _nx_igmp_group_find                   Find multicast group entry    */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -75,8 +75,12 @@
 UINT  _nx_igmp_multicast_check(NX_IP *ip_ptr, ULONG group, NX_INTERFACE *nx_interface)
 {
 
+#ifdef NX_ENABLE_IGMP_GROUP_TABLE
+NX_IGMP_GROUP *group_ptr;
+#else
 UINT   i;
 ULONG *join_list_ptr;
+#endif /* NX_ENABLE_IGMP_GROUP_TABLE */
 
 
     /* Check for "all hosts" group.  We always assume all hosts membership.  */
@@ -85,6 +89,18 @@ ULONG *join_list_ptr;
         return(NX_TRUE);
     }
 
+#ifdef NX_ENABLE_IGMP_GROUP_TABLE
+
+    /* Find the group in the IGMP group table.  */
+    group_ptr =  _nx_igmp_group_find(ip_ptr, group);
+
+    /* Check for a match.  */
+    if ((group_ptr) && (nx_interface == group_ptr -> nx_igmp_group_interface))
+    {
+        return(NX_TRUE);
+    }
+#else
+
     /* Loop through the IP multicast join list to find the matching group that is being
        responded to by another host on this same network.  */
     join_list_ptr =  &(ip_ptr -> nx_ip_igmp_join_list[0]);
@@ -97,6 +113,7 @@ ULONG *join_list_ptr;
             return(NX_TRUE);
         }
     }
+#endif /* NX_ENABLE_IGMP_GROUP_TABLE */
 
     /* Otherwise, we have searched the entire list, return false.  */
     return(NX_FALSE);
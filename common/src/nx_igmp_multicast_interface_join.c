@@ -59,6 +59,8 @@
 /*    tx_mutex_get                          Obtain protection mutex       */
 /*    tx_mutex_put                          Release protection mutex      */
 /*    (ip_link_driver)                      Associated IP link driver     */
+/*    _nx_igmp_group_find                   Find multicast group entry    */
+/*    _nx_igmp_group_timer_set              Set group report time         */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -74,9 +76,15 @@
 UINT  _nx_igmp_multicast_interface_join(NX_IP *ip_ptr, ULONG group_address, UINT nx_interface_index)
 {
 
+#ifdef NX_ENABLE_IGMP_GROUP_TABLE
+TX_INTERRUPT_SAVE_AREA
+NX_IGMP_GROUP  *group_ptr;
+NX_IGMP_GROUP **bucket_ptr;
+#else
 UINT          i;
 UINT          first_free;
 ULONG        *join_list_ptr;
+#endif /* NX_ENABLE_IGMP_GROUP_TABLE */
 NX_IP_DRIVER  driver_request;
 NX_INTERFACE *nx_interface;
 
@@ -89,6 +97,29 @@ NX_INTERFACE *nx_interface;
 
     nx_interface = &ip_ptr -> nx_ip_interface[nx_interface_index];
 
+#ifdef NX_ENABLE_IGMP_GROUP_TABLE
+
+    /* Search the IGMP group table for the same group request.  */
+    group_ptr =  _nx_igmp_group_find(ip_ptr, group_address);
+    if (group_ptr)
+    {
+
+        /* Yes, we have found the same entry.  The only thing required in this
+           case is to increment the join count and return.  */
+        group_ptr -> nx_igmp_group_join_count++;
+
+        /* Release the IP protection.  */
+        tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+        /* Return success!  */
+        return(NX_SUCCESS);
+    }
+
+    /* At this point, we have a new entry.   First, check to see if there is an available
+       entry.  */
+    if (ip_ptr -> nx_ip_igmp_group_free_list == NX_NULL)
+#else
+
     /* Search the multicast join list for either the same group request.  */
     first_free =     NX_MAX_MULTICAST_GROUPS;
     join_list_ptr =  &(ip_ptr -> nx_ip_igmp_join_list[0]);
@@ -125,6 +156,7 @@ NX_INTERFACE *nx_interface;
     /* At this point, we have a new entry.   First, check to see if there is an available
        entry.  */
     if (first_free == NX_MAX_MULTICAST_GROUPS)
+#endif /* NX_ENABLE_IGMP_GROUP_TABLE */
     {
 
         /* Release the protection of the IP instance.  */
@@ -160,12 +192,44 @@ NX_INTERFACE *nx_interface;
         return(NX_NO_MORE_ENTRIES);
     }
 
+#ifdef NX_ENABLE_IGMP_GROUP_TABLE
+
+    /* Take an entry off the free list and set it up.  */
+    group_ptr =  ip_ptr -> nx_ip_igmp_group_free_list;
+    ip_ptr -> nx_ip_igmp_group_free_list =  group_ptr -> nx_igmp_group_hash_next;
+    group_ptr -> nx_igmp_group_address =          group_address;
+    group_ptr -> nx_igmp_group_interface =        nx_interface;
+    group_ptr -> nx_igmp_group_join_count =       1;
+    group_ptr -> nx_igmp_group_loopback_enable =  ip_ptr -> nx_ip_igmp_global_loopback_enable;
+
+    /* Place the group on the list of joined groups.  */
+    group_ptr -> nx_igmp_group_previous =  NX_NULL;
+    group_ptr -> nx_igmp_group_next =  ip_ptr -> nx_ip_igmp_group_list;
+    if (ip_ptr -> nx_ip_igmp_group_list)
+    {
+        (ip_ptr -> nx_ip_igmp_group_list) -> nx_igmp_group_previous =  group_ptr;
+    }
+    ip_ptr -> nx_ip_igmp_group_list =  group_ptr;
+
+    /* Update on next IGMP periodic.  */
+    _nx_igmp_group_timer_set(ip_ptr, group_ptr, 1);
+
+    /* Place the group at the front of its hash bucket.  Interrupts are disabled since
+       received packets are matched against the table.  */
+    bucket_ptr =  &(ip_ptr -> nx_ip_igmp_group_table[NX_IGMP_GROUP_HASH(ip_ptr, group_address)]);
+    TX_DISABLE
+    group_ptr -> nx_igmp_group_hash_next =  *bucket_ptr;
+    *bucket_ptr =  group_ptr;
+    TX_RESTORE
+#else
+
     /* Set it up in the IP control structures.  */
     ip_ptr -> nx_ip_igmp_join_list[first_free] =              group_address;
     ip_ptr -> nx_ip_igmp_join_interface_list[first_free] =    nx_interface;
     ip_ptr -> nx_ip_igmp_join_count[first_free] =             1;
     ip_ptr -> nx_ip_igmp_update_time[first_free] =            1;   /* Update on next IGMP periodic  */
     ip_ptr -> nx_ip_igmp_group_loopback_enable[first_free] =  ip_ptr -> nx_ip_igmp_global_loopback_enable;
+#endif /* NX_ENABLE_IGMP_GROUP_TABLE */
 
 #ifndef NX_DISABLE_IGMP_INFO
     /* Increment the IGMP groups joined count.  */
@@ -59,6 +59,8 @@
 /*    tx_mutex_put                          Release protection mutex      */
 /*    (ip_link_driver)                      Associated IP link driver     */
 /*    nx_igmp_interface_report_send         Send IGMP group report        */
+/*    _nx_igmp_group_find                   Find multicast group entry    */
+/*    _nx_igmp_group_timer_set              Set group report time         */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -74,11 +76,17 @@
 UINT  _nx_igmp_multicast_leave(NX_IP *ip_ptr, ULONG group_address)
 {
 
+#ifdef NX_ENABLE_IGMP_GROUP_TABLE
+TX_INTERRUPT_SAVE_AREA
+NX_IGMP_GROUP  *group_ptr;
+NX_IGMP_GROUP **bucket_ptr;
+#else
 UINT         i;
+ULONG       *join_list_ptr;
+#endif /* NX_ENABLE_IGMP_GROUP_TABLE */
 #ifndef NX_DISABLE_IGMPV2
 UINT         interface_index = 0;
 #endif
-ULONG       *join_list_ptr;
 NX_IP_DRIVER driver_request;
 
 
@@ -88,6 +96,92 @@ NX_IP_DRIVER driver_request;
     /* Obtain the IP mutex so we can search the multicast join list.  */
     tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
 
+#ifdef NX_ENABLE_IGMP_GROUP_TABLE
+
+    /* Search the IGMP group table for the group.  */
+    group_ptr =  _nx_igmp_group_find(ip_ptr, group_address);
+    if (group_ptr)
+    {
+
+        /* Decrease the join count.  */
+        group_ptr -> nx_igmp_group_join_count--;
+
+        /* Determine if there are no other join requests.  */
+        if (group_ptr -> nx_igmp_group_join_count == 0)
+        {
+
+            /* Remove the group from its hash bucket.  Interrupts are disabled since
+               received packets are matched against the table.  */
+            bucket_ptr =  &(ip_ptr -> nx_ip_igmp_group_table[NX_IGMP_GROUP_HASH(ip_ptr, group_address)]);
+            TX_DISABLE
+            while (*bucket_ptr != group_ptr)
+            {
+                bucket_ptr =  &((*bucket_ptr) -> nx_igmp_group_hash_next);
+            }
+            *bucket_ptr =  group_ptr -> nx_igmp_group_hash_next;
+            TX_RESTORE
+
+            /* Remove the group from the list of joined groups.  */
+            if (group_ptr -> nx_igmp_group_previous)
+            {
+                (group_ptr -> nx_igmp_group_previous) -> nx_igmp_group_next =  group_ptr -> nx_igmp_group_next;
+            }
+            else
+            {
+                ip_ptr -> nx_ip_igmp_group_list =  group_ptr -> nx_igmp_group_next;
+            }
+            if (group_ptr -> nx_igmp_group_next)
+            {
+                (group_ptr -> nx_igmp_group_next) -> nx_igmp_group_previous =  group_ptr -> nx_igmp_group_previous;
+            }
+
+            /* Cancel any pending report.  */
+            _nx_igmp_group_timer_set(ip_ptr, group_ptr, 0);
+
+            /* Return the entry to the free list.  */
+            group_ptr -> nx_igmp_group_hash_next =  ip_ptr -> nx_ip_igmp_group_free_list;
+            ip_ptr -> nx_ip_igmp_group_free_list =  group_ptr;
+
+            /* Un-register the multicast group with the underlying driver.  */
+            driver_request.nx_ip_driver_ptr                  =   ip_ptr;
+            driver_request.nx_ip_driver_command              =   NX_LINK_MULTICAST_LEAVE;
+            driver_request.nx_ip_driver_physical_address_msw =   NX_IP_MULTICAST_UPPER;
+            driver_request.nx_ip_driver_physical_address_lsw =   NX_IP_MULTICAST_LOWER | (group_address & NX_IP_MULTICAST_MASK);
+            driver_request.nx_ip_driver_interface            =   group_ptr -> nx_igmp_group_interface;
+            /* If trace is enabled, insert this event into the trace buffer.  */
+            NX_TRACE_IN_LINE_INSERT(NX_TRACE_INTERNAL_IO_DRIVER_MULTICAST_LEAVE, ip_ptr, 0, 0, 0, NX_TRACE_INTERNAL_EVENTS, 0, 0)
+
+            (group_ptr -> nx_igmp_group_interface -> nx_interface_link_driver_entry) (&driver_request);
+
+#ifndef NX_DISABLE_IGMP_INFO
+            /* Decrement the IGMP groups joined count.  */
+            ip_ptr -> nx_ip_igmp_groups_joined--;
+#endif
+
+#ifndef NX_DISABLE_IGMPV2
+
+            /* IGMPv2 hosts should send a leave group message. IGMPv1
+               hosts do not. */
+            if (ip_ptr -> nx_ip_igmp_router_version != NX_IGMP_HOST_VERSION_1)
+            {
+
+                /* Find the index of the interface for this group address.  */
+                interface_index =  (UINT)(group_ptr -> nx_igmp_group_interface - &(ip_ptr -> nx_ip_interface[0]));
+
+                /* Build and send the leave report packet. */
+                _nx_igmp_interface_report_send(ip_ptr, group_address, interface_index, NX_FALSE);
+            }
+#endif  /* NX_DISABLE_IGMPV2 */
+        }
+
+        /* Release the IP protection.  */
+        tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+        /* Return success!  */
+        return(NX_SUCCESS);
+    }
+#else
+
     /* Search the multicast join list for either the same group request.  */
     join_list_ptr =  &(ip_ptr -> nx_ip_igmp_join_list[0]);
 
@@ -177,6 +271,7 @@ NX_IP_DRIVER driver_request;
         /* Move to the next entry in the join list.  */
         join_list_ptr++;
     }
+#endif /* NX_ENABLE_IGMP_GROUP_TABLE */
 
     /* The group address was not found in the multicast join list.
        Release the protection of the IP instance and quit.  */
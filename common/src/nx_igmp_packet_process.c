@@ -63,6 +63,8 @@
 /*                                                                        */
 /*    _nx_packet_release                    Release IGMP packet           */
 /*    tx_time_get                           Get current time              */
+/*    _nx_igmp_group_find                   Find multicast group entry    */
+/*    _nx_igmp_group_timer_set              Set group report time         */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -79,7 +81,12 @@
 VOID  _nx_igmp_packet_process(NX_IP *ip_ptr, NX_PACKET *packet_ptr)
 {
 
+#ifdef NX_ENABLE_IGMP_GROUP_TABLE
+NX_IGMP_GROUP  *group_ptr;
+ULONG           remaining_time;
+#else
 UINT            i;
+#endif /* NX_ENABLE_IGMP_GROUP_TABLE */
 ULONG           update_time;
 NX_IGMP_HEADER *header_ptr;
 USHORT          max_update_time;
@@ -277,6 +284,63 @@ ULONG           length;
             update_time =  1;
         }
 
+#ifdef NX_ENABLE_IGMP_GROUP_TABLE
+
+        /* Pickup the group of a group-specific query, or the first joined group
+           of a general membership query.  */
+        if (header_ptr -> nx_igmp_header_word_1 != NX_NULL)
+        {
+            group_ptr =  _nx_igmp_group_find(ip_ptr, header_ptr -> nx_igmp_header_word_1);
+        }
+        else
+        {
+            group_ptr =  ip_ptr -> nx_ip_igmp_group_list;
+        }
+
+        /* Loop through the groups and assign an arbitrary timeout to respond between
+           1 and maximum response time for each group.  */
+        while (group_ptr)
+        {
+
+            /* Compute the time left until the pending report of this group, if any.  */
+            remaining_time =  0;
+            if (group_ptr -> nx_igmp_group_timer_active)
+            {
+                remaining_time =  group_ptr -> nx_igmp_group_timer_expiry - ip_ptr -> nx_ip_igmp_timer_tick;
+            }
+
+            /* Is the current host group running timer less than the max delay?  If so,
+               let the current timer timeout.  */
+            if ((remaining_time >= max_update_time) || (remaining_time == 0))
+            {
+
+                /* Set the timeout for this multicast group. */
+                _nx_igmp_group_timer_set(ip_ptr, group_ptr, update_time);
+
+                /* Then increment the update time for the next host group so the update/expiration times
+                   are separated by one second. This avoids bursts of IGMP reports to the server. */
+                update_time++;
+
+                /* Check after each multicast group that we have not exceeded the maximum response time. */
+                if (update_time > max_update_time)
+                {
+
+                    /* We have, so wrap the update time back to one. */
+                    update_time =  1;
+                }
+            }
+
+            /* A group-specific query only concerns one group.  */
+            if (header_ptr -> nx_igmp_header_word_1 != NX_NULL)
+            {
+                break;
+            }
+
+            /* Move to the next joined group.  */
+            group_ptr =  group_ptr -> nx_igmp_group_next;
+        }
+#else
+
         /* Loop through the multicast join list and assign an arbitrary timeout to
            respond between 1 and maximum response time for each group.  */
         for (i = 0; i < NX_MAX_MULTICAST_GROUPS; i++)
@@ -324,6 +388,7 @@ ULONG           length;
                 update_time =  1;
             }
         }
+#endif /* NX_ENABLE_IGMP_GROUP_TABLE */
     }
 #ifndef NX_DISABLE_IGMPV2
 
@@ -338,6 +403,19 @@ ULONG           length;
 #endif
     {
 
+#ifdef NX_ENABLE_IGMP_GROUP_TABLE
+
+        /* Yes;  Find the group in the IGMP group table.  */
+        group_ptr =  _nx_igmp_group_find(ip_ptr, header_ptr -> nx_igmp_header_word_1);
+        if (group_ptr)
+        {
+
+            /* Cancel the pending report.  This will cancel sending a join
+               request for the same multicast group.  */
+            _nx_igmp_group_timer_set(ip_ptr, group_ptr, 0);
+        }
+#else
+
         /* Yes;  Loop through the host multicast join list to find a match.  */
         for (i = 0; i < NX_MAX_MULTICAST_GROUPS; i++)
         {
@@ -352,6 +430,7 @@ ULONG           length;
                 break;
             }
         }
+#endif /* NX_ENABLE_IGMP_GROUP_TABLE */
     }
 
     /* Release the IGMP packet.  */
@@ -55,6 +55,7 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    nx_igmp_interface_report_send         Send IGMP group report        */
+/*    _nx_igmp_group_timer_set              Set group report time         */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -70,11 +71,65 @@
 VOID  _nx_igmp_periodic_processing(NX_IP *ip_ptr)
 {
 
-UINT   i;
 UINT   status;
 UINT   interface_index = 0;
-ULONG *join_list_ptr;
 UINT   sent_count = 0;
+#ifdef NX_ENABLE_IGMP_GROUP_TABLE
+NX_IGMP_GROUP *group_ptr;
+NX_IGMP_GROUP *next_group_ptr;
+
+
+    /* Advance the IGMP tick.  */
+    ip_ptr -> nx_ip_igmp_timer_tick++;
+
+    /* Pickup the first group in the timer wheel slot of this tick.  */
+    group_ptr =  ip_ptr -> nx_ip_igmp_timer_wheel[ip_ptr -> nx_ip_igmp_timer_tick & (NX_IGMP_TIMER_WHEEL_SIZE - 1)];
+
+    /* Loop through the groups of the slot.  Groups due on a later turn of the wheel
+       stay in the slot.  */
+    while (group_ptr)
+    {
+
+        /* Pickup the next group first, since this group leaves the slot if it is due.  */
+        next_group_ptr =  group_ptr -> nx_igmp_group_timer_next;
+
+        /* Determine if the report of this group is due.  */
+        if (group_ptr -> nx_igmp_group_timer_expiry == ip_ptr -> nx_ip_igmp_timer_tick)
+        {
+
+            /* Determine if we've already sent a report on this periodic.  */
+            if (sent_count > 0)
+            {
+
+                /* We have, so send this report on the next periodic.  */
+                _nx_igmp_group_timer_set(ip_ptr, group_ptr, 1);
+            }
+            else
+            {
+
+                /* Take the group off the timer wheel.  */
+                _nx_igmp_group_timer_set(ip_ptr, group_ptr, 0);
+
+                /* Find the index of the interface this group address is on.  */
+                interface_index =  (UINT)(group_ptr -> nx_igmp_group_interface - &(ip_ptr -> nx_ip_interface[0]));
+
+                /* Build a IGMP host response packet for a join report and send it!  */
+                status = _nx_igmp_interface_report_send(ip_ptr, group_ptr -> nx_igmp_group_address, interface_index, NX_TRUE);
+
+                if (status == NX_SUCCESS)
+                {
+                    /* Update the sent count. Only one report sent per IP periodic. */
+                    sent_count++;
+                }
+            }
+        }
+
+        /* Move to the next group.  */
+        group_ptr =  next_group_ptr;
+    }
+#else
+UINT   i;
+ULONG *join_list_ptr;
 
 
     /* Search the multicast join list for pending IGMP responses.  */
@@ -151,5 +206,5 @@ UINT   sent_count = 0;
         /* Move to the next entry in the join list.  */
         join_list_ptr++;
     }
+#endif /* NX_ENABLE_IGMP_GROUP_TABLE */
 }
-
@@ -100,6 +100,9 @@ ULONG previous_network_mask;
     ip_ptr -> nx_ip_interface[0].nx_interface_ip_network_mask =  network_mask;
     ip_ptr -> nx_ip_interface[0].nx_interface_ip_network      =  ip_address & network_mask;
 
+    /* Invalidate the routes held in destination caches.  */
+    NX_IP_DESTINATION_CACHE_INVALIDATE(ip_ptr);
+
     /* Ensure the RARP function is disabled.  */
     ip_ptr -> nx_ip_rarp_periodic_update =  NX_NULL;
     ip_ptr -> nx_ip_rarp_queue_process =    NX_NULL;
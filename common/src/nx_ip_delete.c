@@ -67,6 +67,7 @@
 /*    tx_thread_terminate                   Terminate IP helper thread    */
 /*    tx_event_flags_delete                 Delete IP event flags         */
 /*    tx_thread_delete                      Delete IP helper thread       */
+/*    tx_semaphore_delete                   Delete receive queue semaphore*/
 /*    _tx_thread_system_preempt_check       Check for preemption          */
 /*    tx_timer_deactivate                   Deactivate IP-ARP timer       */
 /*    tx_timer_delete                       Delete IP-ARP timer           */
@@ -97,6 +98,9 @@ NX_PACKET   *tcp_queue_head;
 NX_PACKET   *arp_queue_head;
 NX_PACKET   *rarp_queue_head;
 UINT         i;
+#ifdef NX_ENABLE_IP_RECEIVE_QUEUES
+UINT         receive_queues;
+#endif /* NX_ENABLE_IP_RECEIVE_QUEUES */
 
     /* If trace is enabled, insert this event into the trace buffer.  */
     NX_TRACE_IN_LINE_INSERT(NX_TRACE_IP_DELETE, ip_ptr, 0, 0, 0, NX_TRACE_IP_EVENTS, 0, 0)
@@ -193,6 +197,13 @@ UINT         i;
     ip_ptr ->  nx_ip_deferred_received_packet_head =  NX_NULL;
     ip_ptr ->  nx_ip_deferred_received_packet_tail =  NX_NULL;
 
+#ifdef NX_ENABLE_IP_RECEIVE_QUEUES
+
+    /* Stop steering packets onto the receive queues.  */
+    receive_queues =  ip_ptr -> nx_ip_receive_queues_active;
+    ip_ptr -> nx_ip_receive_queues_active =  0;
+#endif /* NX_ENABLE_IP_RECEIVE_QUEUES */
+
     /* Release all queued ICMP packets.  */
     icmp_queue_head =   ip_ptr ->  nx_ip_icmp_queue_head;
     ip_ptr ->  nx_ip_icmp_queue_head =  NX_NULL;
@@ -219,6 +230,28 @@ UINT         i;
     /* Restore interrupts.  */
     TX_RESTORE
 
+#ifdef NX_ENABLE_IP_RECEIVE_QUEUES
+
+    /* Delete the receive threads while the mutex is still held.  A receive thread only
+       removes a packet from its queue with the mutex held, so none of them is in the
+       middle of a packet and every packet not yet processed is still on a queue.  No
+       more packets are queued since the queues were stopped above.  */
+    for (i = 0; i < receive_queues; i++)
+    {
+        tx_thread_terminate(&(ip_ptr -> nx_ip_receive_queues[i].nx_ip_receive_queue_thread));
+        tx_thread_delete(&(ip_ptr -> nx_ip_receive_queues[i].nx_ip_receive_queue_thread));
+        tx_semaphore_delete(&(ip_ptr -> nx_ip_receive_queues[i].nx_ip_receive_queue_semaphore));
+
+        /* Release the packets still queued.  */
+        if (ip_ptr -> nx_ip_receive_queues[i].nx_ip_receive_queue_head)
+        {
+            _nx_ip_delete_queue_clear(ip_ptr -> nx_ip_receive_queues[i].nx_ip_receive_queue_head);
+            ip_ptr -> nx_ip_receive_queues[i].nx_ip_receive_queue_head =  NX_NULL;
+            ip_ptr -> nx_ip_receive_queues[i].nx_ip_receive_queue_tail =  NX_NULL;
+        }
+    }
+#endif /* NX_ENABLE_IP_RECEIVE_QUEUES */
+
     /* Release mutex protection.  */
     tx_mutex_put(&(ip_ptr -> nx_ip_protection));
 
@@ -0,0 +1,135 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_destination_cache_route                      PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function selects the interface and next hop of a packet using  */
+/*    the destination cache of the sending socket.  If the cache holds a  */
+/*    route to the destination of the current generation, it is used      */
+/*    directly; otherwise the route is found in the routing tables and    */
+/*    recorded in the cache.  Packets whose interface is already chosen by*/
+/*    the caller bypass the cache.                                        */
+/*                                                                        */
+/*    On success, the cache is attached to the packet so IP can use the   */
+/*    ARP entry it pins.  The caller must hold the IP mutex, since the    */
+/*    cache is shared by all threads sending on the socket.               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    cache_ptr                             Pointer to destination cache  */
+/*    destination_address                   Destination IP address        */
+/*    packet_ptr                            Pointer to packet to send     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_route_find                     Find route to destination     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_udp_socket_send                   Send a UDP packet             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _nx_ip_destination_cache_route(NX_IP *ip_ptr, NX_IP_DESTINATION_CACHE *cache_ptr,
+                                      ULONG destination_address, NX_PACKET *packet_ptr)
+{
+
+ULONG status;
+
+
+    /* Determine if the caller has already chosen the interface.  */
+    if (packet_ptr -> nx_packet_ip_interface)
+    {
+
+        /* Yes, find the route without the cache.  */
+        return(_nx_ip_route_find(ip_ptr, destination_address, &packet_ptr -> nx_packet_ip_interface,
+                                 &packet_ptr -> nx_packet_next_hop_address));
+    }
+
+    /* Determine if the cached route is still valid for this destination.  */
+    if ((cache_ptr -> nx_ip_destination_cache_interface) &&
+        (cache_ptr -> nx_ip_destination_cache_address == destination_address) &&
+        (cache_ptr -> nx_ip_destination_cache_generation == ip_ptr -> nx_ip_destination_cache_generation))
+    {
+
+        /* Yes, use the cached route.  */
+        packet_ptr -> nx_packet_ip_interface =       cache_ptr -> nx_ip_destination_cache_interface;
+        packet_ptr -> nx_packet_next_hop_address =   cache_ptr -> nx_ip_destination_cache_next_hop;
+        packet_ptr -> nx_packet_destination_cache =  cache_ptr;
+
+        /* Return success to the caller.  */
+        return(NX_SUCCESS);
+    }
+
+    /* Find the route in the routing tables.  */
+    status =  _nx_ip_route_find(ip_ptr, destination_address, &packet_ptr -> nx_packet_ip_interface,
+                                &packet_ptr -> nx_packet_next_hop_address);
+    if (status != NX_SUCCESS)
+    {
+
+        /* No route, clear the cache.  */
+        cache_ptr -> nx_ip_destination_cache_interface =  NX_NULL;
+        return(status);
+    }
+
+    /* Record the route in the cache.  */
+    cache_ptr -> nx_ip_destination_cache_address =     destination_address;
+    cache_ptr -> nx_ip_destination_cache_interface =   packet_ptr -> nx_packet_ip_interface;
+    cache_ptr -> nx_ip_destination_cache_next_hop =    packet_ptr -> nx_packet_next_hop_address;
+    cache_ptr -> nx_ip_destination_cache_generation =  ip_ptr -> nx_ip_destination_cache_generation;
+    packet_ptr -> nx_packet_destination_cache =        cache_ptr;
+
+    /* Return success to the caller.  */
+    return(NX_SUCCESS);
+}
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
+
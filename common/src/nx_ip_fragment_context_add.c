@@ -0,0 +1,341 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+#include "nx_packet.h"
+
+
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_fragment_context_add                         PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds a received IP fragment to the re-assembly context*/
+/*    of its datagram, found by hashing the source, destination, ID and   */
+/*    protocol.  A new context is created for the first fragment of a     */
+/*    datagram, replacing the oldest context if all are in use.  Fragments*/
+/*    arriving in order are appended in constant time.  Duplicate or      */
+/*    overlapping fragments are dropped, and a datagram with inconsistent */
+/*    fragments or too many fragments is discarded.\n\nWhen the datagram  */
+/*    is complete, its context is released and the ordered fragment chain */
+/*    is returned.                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    packet_ptr                            Pointer to IP fragment        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    fragment_head                         First fragment of complete    */
+/*                                            datagram, NX_NULL if        */
+/*                                            incomplete                  */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_fragment_context_release       Release re-assembly context   */
+/*    _nx_packet_release                    Release packet                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_fragment_assembly              IP fragment re-assembly       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+NX_PACKET  *_nx_ip_fragment_context_add(NX_IP *ip_ptr, NX_PACKET *packet_ptr)
+{
+
+NX_IP_FRAGMENT_CONTEXT *context_ptr;
+NX_IP_FRAGMENT_CONTEXT *oldest_ptr;
+NX_IP_HEADER           *ip_header_ptr;
+NX_IP_HEADER           *search_header;
+NX_PACKET              *previous_ptr;
+NX_PACKET              *search_ptr;
+NX_PACKET              *fragment_head;
+ULONG                   id_protocol;
+ULONG                   more_fragments;
+ULONG                   offset;
+ULONG                   length;
+ULONG                   end;
+ULONG                   search_offset;
+ULONG                   search_end;
+UINT                    hash;
+UINT                    i;
+
+
+    /* Setup a pointer to the IP header of the fragment.  */
+    ip_header_ptr =  (NX_IP_HEADER *)packet_ptr -> nx_packet_prepend_ptr;
+
+    /* Pickup the offset and the length of the fragment data in bytes.  */
+    more_fragments =  ip_header_ptr -> nx_ip_header_word_1 & NX_IP_MORE_FRAGMENT;
+    offset =  (ip_header_ptr -> nx_ip_header_word_1 & NX_IP_OFFSET_MASK) * NX_IP_ALIGN_FRAGS;
+    length =  ip_header_ptr -> nx_ip_header_word_0 & NX_LOWER_16_MASK;
+    end =     offset + length - sizeof(NX_IP_HEADER);
+
+    /* Check for a malformed fragment.  All fragments but the last must carry a non-zero
+       multiple of 8 bytes, and the datagram must not exceed the maximum IP length.  */
+    if ((length < sizeof(NX_IP_HEADER)) ||
+        (end > (NX_LOWER_16_MASK - sizeof(NX_IP_HEADER))) ||
+        ((more_fragments) && ((length == sizeof(NX_IP_HEADER)) || ((length - sizeof(NX_IP_HEADER)) & (NX_IP_ALIGN_FRAGS - 1)))))
+    {
+
+#ifndef NX_DISABLE_IP_INFO
+
+        /* Increment the IP receive packets dropped count.  */
+        ip_ptr -> nx_ip_receive_packets_dropped++;
+#endif
+
+        /* Release the fragment.  */
+        _nx_packet_release(packet_ptr);
+        return(NX_NULL);
+    }
+
+    /* Convert the length to the length of the fragment data.  */
+    length =  length - sizeof(NX_IP_HEADER);
+
+    /* Build the ID/protocol field of the datagram.  */
+    id_protocol =  (ip_header_ptr -> nx_ip_header_word_1 & ~NX_LOWER_16_MASK) |
+        ((ip_header_ptr -> nx_ip_header_word_2 & NX_IP_PROTOCOL_MASK) >> NX_SHIFT_BY_16);
+
+    /* Compute the hash bucket of the datagram.  */
+    hash =  NX_IP_FRAGMENT_HASH(ip_header_ptr -> nx_ip_header_source_ip,
+                                ip_header_ptr -> nx_ip_header_destination_ip, id_protocol);
+
+    /* Search the hash bucket for the context of the datagram.  RFC 791 Section 3.2 recommends
+       that fragments be matched on source IP, destination IP, protocol and IP header ID.  */
+    context_ptr =  ip_ptr -> nx_ip_fragment_hash_table[hash];
+    while (context_ptr)
+    {
+
+        /* Determine if this context matches the fragment.  */
+        if ((context_ptr -> nx_ip_fragment_context_id_protocol == id_protocol) &&
+            (context_ptr -> nx_ip_fragment_context_source_ip == ip_header_ptr -> nx_ip_header_source_ip) &&
+            (context_ptr -> nx_ip_fragment_context_destination_ip == ip_header_ptr -> nx_ip_header_destination_ip))
+        {
+
+            /* Yes, the context is found.  */
+            break;
+        }
+
+        /* Move to the next context in the bucket.  */
+        context_ptr =  context_ptr -> nx_ip_fragment_context_next;
+    }
+
+    /* Determine if this is the first fragment of a new datagram.  */
+    if (context_ptr == NX_NULL)
+    {
+
+        /* Yes, find a free context, remembering the oldest one in case all are in use.  */
+        oldest_ptr =  &(ip_ptr -> nx_ip_fragment_contexts[0]);
+        for (i = 0; i < NX_IP_FRAGMENT_MAX_DATAGRAMS; i++)
+        {
+
+            /* Determine if this context is free.  */
+            if (ip_ptr -> nx_ip_fragment_contexts[i].nx_ip_fragment_context_head == NX_NULL)
+            {
+
+                /* Yes, use it.  */
+                context_ptr =  &(ip_ptr -> nx_ip_fragment_contexts[i]);
+                break;
+            }
+
+            /* Determine if this context has less lifetime left.  */
+            if (ip_ptr -> nx_ip_fragment_contexts[i].nx_ip_fragment_context_timeout <
+                oldest_ptr -> nx_ip_fragment_context_timeout)
+            {
+
+                /* Yes, it is the oldest so far.  */
+                oldest_ptr =  &(ip_ptr -> nx_ip_fragment_contexts[i]);
+            }
+        }
+
+        /* Determine if all contexts are in use.  */
+        if (context_ptr == NX_NULL)
+        {
+
+            /* Yes, discard the oldest datagram and reuse its context.  */
+            _nx_ip_fragment_context_release(ip_ptr, oldest_ptr, NX_TRUE);
+            context_ptr =  oldest_ptr;
+        }
+
+        /* Setup the context for the new datagram.  */
+        context_ptr -> nx_ip_fragment_context_source_ip =       ip_header_ptr -> nx_ip_header_source_ip;
+        context_ptr -> nx_ip_fragment_context_destination_ip =  ip_header_ptr -> nx_ip_header_destination_ip;
+        context_ptr -> nx_ip_fragment_context_id_protocol =     id_protocol;
+        context_ptr -> nx_ip_fragment_context_head =            packet_ptr;
+        context_ptr -> nx_ip_fragment_context_tail =            packet_ptr;
+        context_ptr -> nx_ip_fragment_context_total_length =    0;
+        context_ptr -> nx_ip_fragment_context_received_length = length;
+        context_ptr -> nx_ip_fragment_context_count =           1;
+        context_ptr -> nx_ip_fragment_context_timeout =         NX_IP_FRAGMENT_TIMEOUT;
+        packet_ptr -> nx_packet_fragment_next =                 NX_NULL;
+
+        /* Place the context at the front of its hash bucket.  */
+        context_ptr -> nx_ip_fragment_context_next =  ip_ptr -> nx_ip_fragment_hash_table[hash];
+        ip_ptr -> nx_ip_fragment_hash_table[hash] =   context_ptr;
+    }
+    else
+    {
+
+        /* Determine if the fragment is inconsistent with the datagram: too many fragments,
+           data beyond the end of the datagram, or a second last fragment that disagrees.  */
+        search_header =  (NX_IP_HEADER *)context_ptr -> nx_ip_fragment_context_tail -> nx_packet_prepend_ptr;
+        search_end =     (search_header -> nx_ip_header_word_1 & NX_IP_OFFSET_MASK) * NX_IP_ALIGN_FRAGS +
+            (search_header -> nx_ip_header_word_0 & NX_LOWER_16_MASK) - sizeof(NX_IP_HEADER);
+        if ((context_ptr -> nx_ip_fragment_context_count >= NX_IP_FRAGMENT_MAX_FRAGMENTS) ||
+            ((context_ptr -> nx_ip_fragment_context_total_length) &&
+             (end > context_ptr -> nx_ip_fragment_context_total_length)) ||
+            ((!more_fragments) &&
+             (((context_ptr -> nx_ip_fragment_context_total_length) &&
+               (end != context_ptr -> nx_ip_fragment_context_total_length)) || (search_end > end))))
+        {
+
+            /* Discard the whole datagram.  */
+            _nx_ip_fragment_context_release(ip_ptr, context_ptr, NX_TRUE);
+
+#ifndef NX_DISABLE_IP_INFO
+
+            /* Increment the IP receive packets dropped count.  */
+            ip_ptr -> nx_ip_receive_packets_dropped++;
+#endif
+
+            /* Release the fragment.  */
+            _nx_packet_release(packet_ptr);
+            return(NX_NULL);
+        }
+
+        /* Determine if the fragment follows the last fragment, which is the common case.  */
+        if (offset >= search_end)
+        {
+
+            /* Yes, append the fragment to the end of the list.  */
+            context_ptr -> nx_ip_fragment_context_tail -> nx_packet_fragment_next =  packet_ptr;
+            context_ptr -> nx_ip_fragment_context_tail =                             packet_ptr;
+            packet_ptr -> nx_packet_fragment_next =                                  NX_NULL;
+        }
+        else
+        {
+
+            /* Find the first fragment with a greater offset.  */
+            previous_ptr =  NX_NULL;
+            search_ptr =    context_ptr -> nx_ip_fragment_context_head;
+            search_end =    0;
+            do
+            {
+
+                /* Pickup the offset of this fragment.  */
+                search_header =  (NX_IP_HEADER *)search_ptr -> nx_packet_prepend_ptr;
+                search_offset =  (search_header -> nx_ip_header_word_1 & NX_IP_OFFSET_MASK) * NX_IP_ALIGN_FRAGS;
+
+                /* Determine if the new fragment goes before this fragment.  */
+                if (offset < search_offset)
+                {
+                    break;
+                }
+
+                /* Remember the end of the previous fragment.  */
+                search_end =  search_offset + (search_header -> nx_ip_header_word_0 & NX_LOWER_16_MASK) - sizeof(NX_IP_HEADER);
+
+                /* Move to the next fragment.  */
+                previous_ptr =  search_ptr;
+                search_ptr =    search_ptr -> nx_packet_fragment_next;
+            } while (search_ptr);
+
+            /* Determine if the fragment overlaps either of its neighbors.  Since the tail ends
+               after this fragment starts, the search pointer is never NULL here.  */
+            if (((previous_ptr) && (search_end > offset)) || (end > search_offset))
+            {
+
+#ifndef NX_DISABLE_IP_INFO
+
+                /* Increment the IP receive packets dropped count.  */
+                ip_ptr -> nx_ip_receive_packets_dropped++;
+#endif
+
+                /* Duplicate or overlapping data, release the fragment.  */
+                _nx_packet_release(packet_ptr);
+                return(NX_NULL);
+            }
+
+            /* Insert the fragment in front of the search pointer.  */
+            packet_ptr -> nx_packet_fragment_next =  search_ptr;
+            if (previous_ptr)
+            {
+                previous_ptr -> nx_packet_fragment_next =  packet_ptr;
+            }
+            else
+            {
+                context_ptr -> nx_ip_fragment_context_head =  packet_ptr;
+            }
+        }
+
+        /* Account for the new fragment.  */
+        context_ptr -> nx_ip_fragment_context_received_length += length;
+        context_ptr -> nx_ip_fragment_context_count++;
+    }
+
+    /* Determine if this is the last fragment of the datagram.  */
+    if (!more_fragments)
+    {
+
+        /* Yes, the total length of the datagram is now known.  */
+        context_ptr -> nx_ip_fragment_context_total_length =  end;
+    }
+
+    /* Since the fragments never overlap, the datagram is complete when all of its
+       data has been received.  */
+    if ((context_ptr -> nx_ip_fragment_context_total_length == 0) ||
+        (context_ptr -> nx_ip_fragment_context_received_length != context_ptr -> nx_ip_fragment_context_total_length))
+    {
+
+        /* More fragments are needed.  */
+        return(NX_NULL);
+    }
+
+    /* Pickup the ordered fragment chain and release the context.  */
+    fragment_head =  context_ptr -> nx_ip_fragment_context_head;
+    _nx_ip_fragment_context_release(ip_ptr, context_ptr, NX_FALSE);
+
+    /* Return the complete datagram.  */
+    return(fragment_head);
+}
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH */
+
@@ -0,0 +1,157 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+#include "nx_packet.h"
+
+
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_fragment_context_release                     PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes an IP fragment re-assembly context from its   */
+/*    hash bucket and marks it free.  If requested, the fragments held by */
+/*    the context are released and counted as a re-assembly failure.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    context_ptr                           Pointer to re-assembly context*/
+/*    release_packets                       Release the fragments         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_release                    Release packet                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_fragment_context_add           Add fragment to re-assembly   */
+/*                                            context                     */
+/*    _nx_ip_fragment_disable               Disable IP fragmenting        */
+/*    _nx_ip_fragment_timeout_check         Timeout check for fragments   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_ip_fragment_context_release(NX_IP *ip_ptr, NX_IP_FRAGMENT_CONTEXT *context_ptr, UINT release_packets)
+{
+
+NX_IP_FRAGMENT_CONTEXT *search_ptr;
+NX_IP_FRAGMENT_CONTEXT *previous_ptr;
+NX_PACKET              *fragment;
+NX_PACKET              *next_fragment;
+UINT                    hash;
+
+
+    /* Compute the hash bucket of the datagram.  */
+    hash =  NX_IP_FRAGMENT_HASH(context_ptr -> nx_ip_fragment_context_source_ip,
+                                context_ptr -> nx_ip_fragment_context_destination_ip,
+                                context_ptr -> nx_ip_fragment_context_id_protocol);
+
+    /* Find the context in its hash bucket.  */
+    previous_ptr =  NX_NULL;
+    search_ptr =    ip_ptr -> nx_ip_fragment_hash_table[hash];
+    while ((search_ptr) && (search_ptr != context_ptr))
+    {
+
+        /* Move to the next context in the bucket.  */
+        previous_ptr =  search_ptr;
+        search_ptr =    search_ptr -> nx_ip_fragment_context_next;
+    }
+
+    /* Determine if the context was found.  */
+    if (search_ptr)
+    {
+
+        /* Yes, unlink it from the bucket.  */
+        if (previous_ptr)
+        {
+            previous_ptr -> nx_ip_fragment_context_next =  context_ptr -> nx_ip_fragment_context_next;
+        }
+        else
+        {
+            ip_ptr -> nx_ip_fragment_hash_table[hash] =  context_ptr -> nx_ip_fragment_context_next;
+        }
+    }
+
+    /* Determine if the fragments should be released.  */
+    if (release_packets)
+    {
+
+#ifndef NX_DISABLE_IP_INFO
+
+        /* Increment the re-assembly failures count.  */
+        ip_ptr -> nx_ip_reassembly_failures++;
+#endif
+
+        /* Walk the chain of fragments for this datagram.  */
+        fragment =  context_ptr -> nx_ip_fragment_context_head;
+        while (fragment)
+        {
+
+#ifndef NX_DISABLE_IP_INFO
+
+            /* Increment the IP receive packets dropped count.  */
+            ip_ptr -> nx_ip_receive_packets_dropped++;
+#endif
+
+            /* Pickup the next fragment.  */
+            next_fragment =  fragment -> nx_packet_fragment_next;
+
+            /* Release this fragment.  */
+            _nx_packet_release(fragment);
+
+            /* Reassign the fragment pointer.  */
+            fragment =  next_fragment;
+        }
+    }
+
+    /* Mark the context as free.  */
+    context_ptr -> nx_ip_fragment_context_head =  NX_NULL;
+    context_ptr -> nx_ip_fragment_context_tail =  NX_NULL;
+    context_ptr -> nx_ip_fragment_context_next =  NX_NULL;
+}
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH */
+
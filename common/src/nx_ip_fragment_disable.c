@@ -55,6 +55,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_ip_fragment_context_release       Release re-assembly context   */
 /*    _nx_packet_release                    Release packet                */
 /*    tx_mutex_get                          Get protection mutex          */
 /*    tx_mutex_put                          Put protection mutex          */
@@ -79,6 +80,9 @@ NX_PACKET *new_fragment_head;
 NX_PACKET *assemble_head;
 NX_PACKET *next_packet;
 NX_PACKET *release_packet;
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH
+UINT       i;
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH */
 
 
     /* If trace is enabled, insert this event into the trace buffer.  */
@@ -112,6 +116,22 @@ NX_PACKET *release_packet;
     /* Restore interrupts.  */
     TX_RESTORE
 
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH
+
+    /* Release the fragments of every datagram being re-assembled.  */
+    for (i = 0; i < NX_IP_FRAGMENT_MAX_DATAGRAMS; i++)
+    {
+
+        /* Determine if this re-assembly context is in use.  */
+        if (ip_ptr -> nx_ip_fragment_contexts[i].nx_ip_fragment_context_head)
+        {
+
+            /* Yes, release it and its fragments.  */
+            _nx_ip_fragment_context_release(ip_ptr, &(ip_ptr -> nx_ip_fragment_contexts[i]), NX_TRUE);
+        }
+    }
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH */
+
     /* Release mutex protection.  */
     tx_mutex_put(&(ip_ptr -> nx_ip_protection));
 
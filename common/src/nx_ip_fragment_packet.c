@@ -47,6 +47,11 @@
 /*    already built IP header and driver request structure for each       */
 /*    packet fragment.                                                    */
 /*                                                                        */
+/*    If NX_ENABLE_IP_FRAGMENT_ZERO_COPY is defined, each fragment packet */
+/*    holds only the IP header and references to the slices of the        */
+/*    original payload.  The original packet is released after the last   */
+/*    fragment referencing it is released.                                */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    driver_req_ptr                        Pointer to driver request     */
@@ -59,7 +64,9 @@
 /*                                                                        */
 /*    _nx_packet_allocate                   Allocate packet for fragment  */
 /*    _nx_packet_transmit_release           Transmit packet release       */
+/*    _nx_packet_fragment_source_release    Release fragment payload      */
 /*    (ip_link_driver)                      User supplied link driver     */
+/*    _nx_ip_transmit_burst_end             End transmit burst            */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -76,6 +83,16 @@
 VOID  _nx_ip_fragment_packet(struct NX_IP_DRIVER_STRUCT *driver_req_ptr)
 {
 
+#ifdef NX_ENABLE_IP_FRAGMENT_ZERO_COPY
+TX_INTERRUPT_SAVE_AREA
+
+NX_PACKET    *reference_packet;
+NX_PACKET    *reference_ptr;
+UCHAR        *reference_start;
+ULONG         reference_size;
+ULONG         reference_remaining_size;
+ULONG         reference_count;
+#endif /* NX_ENABLE_IP_FRAGMENT_ZERO_COPY */
 UINT          status;
 #ifndef NX_DISABLE_IP_TX_CHECKSUM
 ULONG         checksum;
@@ -112,6 +129,12 @@ NX_IP        *ip_ptr;
     /* Pickup the source packet pointer.  */
     source_packet =  driver_req_ptr -> nx_ip_driver_packet;
 
+#ifdef NX_ENABLE_IP_FRAGMENT_ZERO_COPY
+
+    /* Hold a reference to the source packet until all fragments are sent.  */
+    source_packet -> nx_packet_fragment_references =  1;
+#endif /* NX_ENABLE_IP_FRAGMENT_ZERO_COPY */
+
     /* Build a pointer to the source IP header.  */
     source_header_ptr =  (NX_IP_HEADER *)source_packet -> nx_packet_prepend_ptr;
 
@@ -131,6 +154,9 @@ NX_IP        *ip_ptr;
     fragment_size =  source_packet -> nx_packet_ip_interface -> nx_interface_ip_mtu_size - sizeof(NX_IP_HEADER);
     fragment_size =  (fragment_size / NX_IP_ALIGN_FRAGS) * NX_IP_ALIGN_FRAGS;
 
+    /* Hand the fragments to the driver as one burst.  */
+    NX_IP_TRANSMIT_BURST_START(ip_ptr);
+
     /* Loop to break the source packet into fragments and send each out through
        the associated driver.  */
     while (remaining_bytes)
@@ -156,7 +182,10 @@ NX_IP        *ip_ptr;
 
             /* Error, not enough packets to perform the fragmentation...  release the
                source packet and return.  */
-            _nx_packet_transmit_release(driver_req_ptr -> nx_ip_driver_packet);
+            NX_IP_FRAGMENT_SOURCE_RELEASE(driver_req_ptr -> nx_ip_driver_packet);
+
+            /* End the burst, flushing the fragments already sent.  */
+            NX_IP_TRANSMIT_BURST_END(ip_ptr);
             return;
         }
 
@@ -175,6 +204,115 @@ NX_IP        *ip_ptr;
             remaining_bytes = 0;
         }
 
+#ifdef NX_ENABLE_IP_FRAGMENT_ZERO_COPY
+
+        /* Count the source packets that hold the payload of this fragment.  */
+        reference_packet =          source_packet;
+        reference_start =           source_ptr;
+        reference_remaining_size =  copy_remaining_size;
+        reference_count =           0;
+        while ((reference_remaining_size) && (reference_packet))
+        {
+
+            /* Calculate the size of the payload in this source packet.  */
+            reference_size =  (ULONG)(reference_packet -> nx_packet_append_ptr - reference_start);
+            if (reference_size > reference_remaining_size)
+            {
+                reference_size =  reference_remaining_size;
+            }
+
+            if (reference_size == 0)
+            {
+
+                /* Move to the next physical packet in the source message.  */
+                reference_packet =  reference_packet -> nx_packet_next;
+                if (reference_packet)
+                {
+                    reference_start =  reference_packet -> nx_packet_prepend_ptr;
+                }
+                continue;
+            }
+
+            reference_count++;
+            reference_remaining_size -= reference_size;
+            reference_start += reference_size;
+        }
+
+        /* Determine if the source holds the whole payload and the references fit in the
+           fragment packet.  Otherwise, the payload is copied.  */
+        if ((reference_remaining_size == 0) &&
+            ((ULONG)(fragment_packet -> nx_packet_data_end - fragment_packet -> nx_packet_prepend_ptr) >=
+             (reference_count * sizeof(NX_PACKET)) + sizeof(VOID *)))
+        {
+
+            /* The references are packet headers placed at the end of the fragment packet's
+               buffer.  The end of the fragment's data area is moved below them, so nothing
+               appended to the fragment can overwrite them.  */
+            reference_ptr =  (NX_PACKET *)(fragment_packet -> nx_packet_data_start +
+                                           (((ULONG)(fragment_packet -> nx_packet_data_end - fragment_packet -> nx_packet_data_start) -
+                                             (reference_count * sizeof(NX_PACKET))) / sizeof(VOID *)) * sizeof(VOID *));
+            fragment_packet -> nx_packet_data_end =  (UCHAR *)reference_ptr;
+
+            /* Build a reference to each slice of the payload.  */
+            while (copy_remaining_size)
+            {
+
+                /* Calculate the size of the payload in this source packet.  */
+                reference_size =  (ULONG)(source_packet -> nx_packet_append_ptr - source_ptr);
+                if (reference_size > copy_remaining_size)
+                {
+                    reference_size =  copy_remaining_size;
+                }
+
+                if (reference_size == 0)
+                {
+
+                    /* Move to the next physical packet in the source message.  */
+                    source_packet =  source_packet -> nx_packet_next;
+                    source_ptr =     source_packet -> nx_packet_prepend_ptr;
+                    continue;
+                }
+
+                /* Setup the reference like a packet whose data is the payload slice.  A
+                   reference has no pool owner, so releasing it by mistake is rejected.  */
+                memset(reference_ptr, 0, sizeof(NX_PACKET));
+                reference_ptr -> nx_packet_tcp_queue_next =  (NX_PACKET *)NX_PACKET_ALLOCATED;
+                reference_ptr -> nx_packet_ip_interface =    fragment_packet -> nx_packet_ip_interface;
+                reference_ptr -> nx_packet_data_start =      source_ptr;
+                reference_ptr -> nx_packet_prepend_ptr =     source_ptr;
+                reference_ptr -> nx_packet_append_ptr =      source_ptr + reference_size;
+                reference_ptr -> nx_packet_data_end =        reference_ptr -> nx_packet_append_ptr;
+
+                /* Link the reference to the fragment packet.  */
+                if (fragment_packet -> nx_packet_last)
+                {
+                    (fragment_packet -> nx_packet_last) -> nx_packet_next =  reference_ptr;
+                }
+                else
+                {
+                    fragment_packet -> nx_packet_next =  reference_ptr;
+                }
+                fragment_packet -> nx_packet_last =  reference_ptr;
+                fragment_packet -> nx_packet_length +=  reference_size;
+
+                copy_remaining_size -= reference_size;
+                source_ptr += reference_size;
+                reference_ptr++;
+            }
+
+            /* The fragment now holds a reference to the source packet.  */
+            fragment_packet -> nx_packet_fragment_source =  driver_req_ptr -> nx_ip_driver_packet;
+
+            /* Disable interrupts, since fragments may be released by the driver from an ISR.  */
+            TX_DISABLE
+
+            (driver_req_ptr -> nx_ip_driver_packet) -> nx_packet_fragment_references++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+        }
+#endif /* NX_ENABLE_IP_FRAGMENT_ZERO_COPY */
+
         /* Copy data.  */
         while (copy_remaining_size)
         {
@@ -210,8 +348,11 @@ NX_IP        *ip_ptr;
 
                 /* Error, not enough packets to perform the fragmentation...  release the
                    source packet and return.  */
-                _nx_packet_transmit_release(driver_req_ptr -> nx_ip_driver_packet);
+                NX_IP_FRAGMENT_SOURCE_RELEASE(driver_req_ptr -> nx_ip_driver_packet);
                 _nx_packet_release(fragment_packet);
+
+                /* End the burst, flushing the fragments already sent.  */
+                NX_IP_TRANSMIT_BURST_END(ip_ptr);
                 return;
             }
 
@@ -249,8 +390,11 @@ NX_IP        *ip_ptr;
 
                     /* Error, not enough packets to perform the fragmentation...  release the
                        source packet and return.  */
-                    _nx_packet_transmit_release(driver_req_ptr -> nx_ip_driver_packet);
+                    NX_IP_FRAGMENT_SOURCE_RELEASE(driver_req_ptr -> nx_ip_driver_packet);
                     _nx_packet_release(fragment_packet);
+
+                    /* End the burst, flushing the fragments already sent.  */
+                    NX_IP_TRANSMIT_BURST_END(ip_ptr);
                     return;
                 }
             }
@@ -330,6 +474,8 @@ NX_IP        *ip_ptr;
         /* Send the packet to the associated driver for output.  */
         driver_request.nx_ip_driver_packet =   fragment_packet;
 
+        NX_IP_DRIVER_TRANSMIT_MORE_SET(driver_request, NX_IP_TRANSMIT_MORE(ip_ptr));
+
         /* If trace is enabled, insert this event into the trace buffer.  */
         NX_TRACE_IN_LINE_INSERT(NX_TRACE_INTERNAL_IO_DRIVER_PACKET_SEND, ip_ptr, fragment_packet, fragment_packet -> nx_packet_length, 0, NX_TRACE_INTERNAL_EVENTS, 0, 0);
 
@@ -339,6 +485,9 @@ NX_IP        *ip_ptr;
         fragment_offset += fragment_size;
     }
 
+    /* End the burst, flushing the driver.  */
+    NX_IP_TRANSMIT_BURST_END(ip_ptr);
+
 #ifndef NX_DISABLE_IP_INFO
 
     /* Increment the total number of successful fragment requests.  */
@@ -346,6 +495,6 @@ NX_IP        *ip_ptr;
 #endif
 
     /* The original packet has been sent out in fragments... release it!  */
-    _nx_packet_transmit_release(driver_req_ptr -> nx_ip_driver_packet);
+    NX_IP_FRAGMENT_SOURCE_RELEASE(driver_req_ptr -> nx_ip_driver_packet);
 }
 
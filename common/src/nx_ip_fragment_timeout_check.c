@@ -57,6 +57,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_ip_fragment_context_release       Release re-assembly context   */
 /*    _nx_packet_release                    Release packet                */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -73,6 +74,39 @@
 VOID  _nx_ip_fragment_timeout_check(NX_IP *ip_ptr)
 {
 
+#ifdef NX_ENABLE_IP_FRAGMENT_HASH
+NX_IP_FRAGMENT_CONTEXT *context_ptr;
+UINT                    i;
+
+
+    /* Loop through the re-assembly contexts.  */
+    for (i = 0; i < NX_IP_FRAGMENT_MAX_DATAGRAMS; i++)
+    {
+
+        /* Pickup the context.  */
+        context_ptr =  &(ip_ptr -> nx_ip_fragment_contexts[i]);
+
+        /* Determine if the context is in use.  */
+        if (context_ptr -> nx_ip_fragment_context_head == NX_NULL)
+        {
+            continue;
+        }
+
+        /* Determine if the datagram has timed out.  */
+        if (context_ptr -> nx_ip_fragment_context_timeout > 1)
+        {
+
+            /* No, just decrement its lifetime.  */
+            context_ptr -> nx_ip_fragment_context_timeout--;
+        }
+        else
+        {
+
+            /* Yes, discard the datagram.  */
+            _nx_ip_fragment_context_release(ip_ptr, context_ptr, NX_TRUE);
+        }
+    }
+#else
 NX_PACKET *fragment;
 NX_PACKET *next_fragment;
 
@@ -132,5 +166,6 @@ NX_PACKET *next_fragment;
         /* Assign the fragment head to the timeout pointer.  */
         ip_ptr -> nx_ip_timeout_fragment =  ip_ptr -> nx_ip_fragment_assembly_head;
     }
+#endif /* NX_ENABLE_IP_FRAGMENT_HASH */
 }
 
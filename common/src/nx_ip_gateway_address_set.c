@@ -105,6 +105,9 @@ NX_INTERFACE *nx_ip_interface = NX_NULL;
         ip_ptr -> nx_ip_gateway_address =  0x0;
         ip_ptr -> nx_ip_gateway_interface = NX_NULL;
 
+        /* Invalidate the routes held in destination caches.  */
+        NX_IP_DESTINATION_CACHE_INVALIDATE(ip_ptr);
+
         /* Restore interrupts.  */
         TX_RESTORE
 
@@ -149,6 +152,9 @@ NX_INTERFACE *nx_ip_interface = NX_NULL;
     ip_ptr -> nx_ip_gateway_address =  ip_address;
     ip_ptr -> nx_ip_gateway_interface = nx_ip_interface;
 
+    /* Invalidate the routes held in destination caches.  */
+    NX_IP_DESTINATION_CACHE_INVALIDATE(ip_ptr);
+
     /* Restore interrupts.  */
     TX_RESTORE
 
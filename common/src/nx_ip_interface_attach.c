@@ -119,6 +119,9 @@ NX_IP_DRIVER  driver_request;
     nx_interface -> nx_interface_link_driver_entry = ip_link_driver;
     nx_interface -> nx_interface_ip_instance       = ip_ptr;
 
+    /* Invalidate the routes held in destination caches.  */
+    NX_IP_DESTINATION_CACHE_INVALIDATE(ip_ptr);
+
     nx_interface -> nx_interface_name = interface_name;
 
     /* If trace is enabled, insert this event into the trace buffer.  */
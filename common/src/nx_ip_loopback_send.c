@@ -28,6 +28,7 @@
 #include "nx_api.h"
 #include "nx_ip.h"
 #include "nx_packet.h"
+#include "tx_thread.h"
 
 
 /**************************************************************************/
@@ -45,6 +46,13 @@
 /*    This function prepends an IP header and sends an IP packet to the   */
 /*    appropriate link driver.                                            */
 /*                                                                        */
+/*    If NX_ENABLE_IP_LOOPBACK_ZERO_COPY is defined, a packet the caller  */
+/*    releases is handed to the receive processing without a copy,        */
+/*    unless it is still queued for TCP retransmission.  If               */
+/*    NX_ENABLE_IP_LOOPBACK_DIRECT_DELIVERY is defined, packets sent from */
+/*    an application thread are processed in that thread instead of       */
+/*    being queued for the IP helper thread.                              */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    ip_ptr                                Pointer to IP control block   */
@@ -59,6 +67,7 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_ip_packet_deferred_receive        Receive loopback packet       */
+/*    _nx_ip_packet_receive                 Deliver loopback packet       */
 /*    _nx_packet_copy                       Copy packet for loopback      */
 /*    _nx_packet_transmit_release           Release transmit packet       */
 /*                                                                        */
@@ -77,10 +86,39 @@ VOID _nx_ip_loopback_send(NX_IP *ip_ptr, NX_PACKET *packet_ptr, UINT packet_rele
 {
 
 NX_PACKET *packet_copy;
+UINT       status;
+
+
+#ifdef NX_ENABLE_IP_LOOPBACK_ZERO_COPY
+
+    /* Determine if the caller gives up the packet and it is not held on a TCP
+       transmit queue for retransmission.  */
+    if ((packet_release) &&
+        (packet_ptr -> nx_packet_tcp_queue_next == ((NX_PACKET *)NX_PACKET_ALLOCATED)))
+    {
+
+        /* Yes, hand the original packet over to the receive processing instead
+           of copying it.  */
+        packet_copy =  packet_ptr;
+        packet_ptr -> nx_packet_queue_next =  NX_NULL;
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+        packet_ptr -> nx_packet_destination_cache =  NX_NULL;
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE  */
+
+        /* The packet now belongs to the receive path.  */
+        packet_release =  NX_FALSE;
+        status =  NX_SUCCESS;
+    }
+    else
+#endif /* NX_ENABLE_IP_LOOPBACK_ZERO_COPY  */
+    {
+
+        /* Copy the packet so it can be enqueued properly by the receive
+           processing.  */
+        status =  _nx_packet_copy(packet_ptr, &packet_copy, ip_ptr -> nx_ip_default_packet_pool, NX_NO_WAIT);
+    }
 
-    /* Copy the packet so it can be enqueued properly by the receive
-       processing.  */
-    if (_nx_packet_copy(packet_ptr, &packet_copy, ip_ptr -> nx_ip_default_packet_pool, NX_NO_WAIT) == NX_SUCCESS)
+    if (status == NX_SUCCESS)
     {
 
 #ifndef NX_DISABLE_IP_INFO
@@ -89,12 +127,29 @@ NX_PACKET *packet_copy;
         ip_ptr -> nx_ip_total_packets_sent++;
 
         /* Increment the IP bytes sent count.  */
-        ip_ptr -> nx_ip_total_bytes_sent +=  packet_ptr -> nx_packet_length - sizeof(NX_IP_HEADER);
+        ip_ptr -> nx_ip_total_bytes_sent +=  packet_copy -> nx_packet_length - sizeof(NX_IP_HEADER);
 #endif
 
-        /* Send the packet to this IP's receive processing queue like it came in from the
-           driver.  */
-        _nx_ip_packet_deferred_receive(ip_ptr, packet_copy);
+#ifdef NX_ENABLE_IP_LOOPBACK_DIRECT_DELIVERY
+
+        /* Determine if the caller is an application thread.  Packets sent from the
+           IP helper thread or from an ISR still go through the deferred queue so
+           that the receive processing cannot recurse back into this path.  */
+        if ((_tx_thread_current_ptr) && (TX_THREAD_GET_SYSTEM_STATE() == 0) &&
+            (_tx_thread_current_ptr != &(ip_ptr -> nx_ip_thread)))
+        {
+
+            /* Yes, process the packet right away in the context of the caller.  */
+            _nx_ip_packet_receive(ip_ptr, packet_copy);
+        }
+        else
+#endif /* NX_ENABLE_IP_LOOPBACK_DIRECT_DELIVERY  */
+        {
+
+            /* Send the packet to this IP's receive processing queue like it came in from the
+               driver.  */
+            _nx_ip_packet_deferred_receive(ip_ptr, packet_copy);
+        }
     }
 #ifndef NX_DISABLE_IP_INFO
     else
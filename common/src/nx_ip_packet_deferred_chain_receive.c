@@ -0,0 +1,173 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_packet_deferred_chain_receive                PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function receives a chain of packets from the link driver      */
+/*    (usually the link driver's input ISR) and appends it to the deferred*/
+/*    receive packet queue.  The packets are linked through               */
+/*    nx_packet_queue_next, and the chain is queued with a single         */
+/*    interrupt lockout and at most one wakeup of the IP helper thread.   */
+/*    If the driver does not supply the tail of the chain, it is found    */
+/*    before interrupts are disabled.                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP control block   */
+/*    packet_head                           Pointer to first packet of    */
+/*                                            chain                       */
+/*    packet_tail                           Pointer to last packet of     */
+/*                                            chain, or NX_NULL           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_event_flags_set                    Set events for IP thread      */
+/*    _nx_ip_packet_flow_hash               Compute receive flow hash     */
+/*    _nx_ip_packet_flow_receive            Steer packet onto the receive */
+/*                                            queue of its flow           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application I/O Driver                                              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_ip_packet_deferred_chain_receive(NX_IP *ip_ptr, NX_PACKET *packet_head, NX_PACKET *packet_tail)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+#ifdef NX_ENABLE_IP_RECEIVE_QUEUES
+NX_PACKET *packet_ptr;
+#endif /* NX_ENABLE_IP_RECEIVE_QUEUES */
+
+
+    /* Check for an empty chain.  */
+    if (packet_head == NX_NULL)
+    {
+        return;
+    }
+
+#ifdef NX_ENABLE_IP_RECEIVE_QUEUES
+
+    /* Determine if the receive queues are running.  */
+    if (ip_ptr -> nx_ip_receive_queues_active)
+    {
+
+        /* Yes, each packet must be steered onto the receive queue of its flow.  */
+        while (packet_head)
+        {
+
+            /* Unlink the first packet of the chain.  The link of the tail packet is
+               not terminated by the driver, so stop at the tail if one was given.  */
+            packet_ptr =   packet_head;
+            if (packet_ptr == packet_tail)
+            {
+                packet_head =  NX_NULL;
+            }
+            else
+            {
+                packet_head =  packet_ptr -> nx_packet_queue_next;
+            }
+
+            /* Steer the packet.  */
+            _nx_ip_packet_flow_receive(ip_ptr, packet_ptr, _nx_ip_packet_flow_hash(packet_ptr));
+        }
+
+        return;
+    }
+#endif /* NX_ENABLE_IP_RECEIVE_QUEUES */
+
+    /* Determine if the tail of the chain needs to be found.  */
+    if (packet_tail == NX_NULL)
+    {
+
+        /* Walk the chain to its last packet.  */
+        packet_tail =  packet_head;
+        while (packet_tail -> nx_packet_queue_next)
+        {
+            packet_tail =  packet_tail -> nx_packet_queue_next;
+        }
+    }
+
+    /* Terminate the chain.  */
+    packet_tail -> nx_packet_queue_next =  NX_NULL;
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Check to see if the deferred processing queue is empty.  */
+    if (ip_ptr -> nx_ip_deferred_received_packet_head)
+    {
+
+        /* Not empty, just append the chain to the end of the queue.  */
+        (ip_ptr -> nx_ip_deferred_received_packet_tail) -> nx_packet_queue_next =  packet_head;
+        ip_ptr -> nx_ip_deferred_received_packet_tail =  packet_tail;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+    else
+    {
+
+        /* Empty deferred receive processing queue.  Just setup the head pointers and
+           set the event flags to ensure the IP helper thread looks at the deferred processing
+           queue.  */
+        ip_ptr -> nx_ip_deferred_received_packet_head =  packet_head;
+        ip_ptr -> nx_ip_deferred_received_packet_tail =  packet_tail;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Wakeup IP helper thread to process the IP deferred receive.  */
+        tx_event_flags_set(&(ip_ptr -> nx_ip_events), NX_IP_RECEIVE_EVENT, TX_OR);
+    }
+}
+
@@ -58,10 +58,15 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    tx_event_flags_set                    Set events for IP thread      */
+/*    _nx_ip_packet_flow_hash               Compute receive flow hash     */
+/*    _nx_ip_packet_flow_receive            Steer packet onto the receive */
+/*                                            queue of its flow           */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
 /*    Application I/O Driver                                              */
+/*    _nx_ip_packet_flow_receive            Steer packet onto the receive */
+/*                                            queue of its flow           */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -76,6 +81,18 @@ VOID  _nx_ip_packet_deferred_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr)
 TX_INTERRUPT_SAVE_AREA
 
 
+#ifdef NX_ENABLE_IP_RECEIVE_QUEUES
+
+    /* Determine if the receive queues are running.  */
+    if (ip_ptr -> nx_ip_receive_queues_active)
+    {
+
+        /* Yes, steer the packet onto the receive queue of its flow.  */
+        _nx_ip_packet_flow_receive(ip_ptr, packet_ptr, _nx_ip_packet_flow_hash(packet_ptr));
+        return;
+    }
+#endif /* NX_ENABLE_IP_RECEIVE_QUEUES */
+
     /* Disable interrupts.  */
     TX_DISABLE
 
@@ -0,0 +1,231 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+#ifdef NX_ENABLE_IP_PACKET_FILTER
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_packet_filter_rules_check                    PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks a received IP packet against the installed     */
+/*    packet filter rules and returns the action to take. Only the rules  */
+/*    in the decision table of the packet's protocol class are compared.  */
+/*    The ports and TCP flags are taken from the first fragment only, so  */
+/*    rules that need them do not match later fragments. A rate limited   */
+/*    rule accepts packets while its token bucket holds a packet's worth  */
+/*    of tokens.                                                          */
+/*                                                                        */
+/*    The IP header must be in host byte order and without options.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP control block   */
+/*    packet_ptr                            Pointer to received packet    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    action                                NX_IP_PACKET_FILTER_ACCEPT or */
+/*                                            NX_IP_PACKET_FILTER_DROP    */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_time_get                           Get current time              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_packet_receive                 Receive IP packet             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_ip_packet_filter_rules_check(NX_IP *ip_ptr, NX_PACKET *packet_ptr)
+{
+
+NX_IP_PACKET_FILTER_RULE *rules;
+NX_IP_PACKET_FILTER_RULE *rule_ptr;
+NX_IP_HEADER             *ip_header_ptr;
+UCHAR                    *transport_ptr;
+UCHAR                    *table;
+ULONG                     protocol;
+ULONG                     current_time;
+ULONG                     elapsed;
+ULONG                     limit;
+UINT                      class_index;
+UINT                      count;
+UINT                      transport;
+UINT                      source_port;
+UINT                      destination_port;
+UINT                      tcp_flags;
+UINT                      i;
+
+
+    /* Determine if the rules are enabled.  */
+    if (ip_ptr -> nx_ip_packet_filter_rules_enabled == NX_FALSE)
+    {
+        return(NX_IP_PACKET_FILTER_ACCEPT);
+    }
+
+    /* Pickup the installed rules.  */
+    rules =  ip_ptr -> nx_ip_packet_filter_rules;
+
+    /* Pickup the IP header and the protocol class.  */
+    ip_header_ptr =  (NX_IP_HEADER *)packet_ptr -> nx_packet_prepend_ptr;
+    protocol =       ip_header_ptr -> nx_ip_header_word_2 & NX_IP_PROTOCOL_MASK;
+    if (protocol == NX_IP_TCP)
+    {
+        class_index =  NX_IP_PACKET_FILTER_CLASS_TCP;
+    }
+    else if (protocol == NX_IP_UDP)
+    {
+        class_index =  NX_IP_PACKET_FILTER_CLASS_UDP;
+    }
+    else if (protocol == NX_IP_ICMP)
+    {
+        class_index =  NX_IP_PACKET_FILTER_CLASS_ICMP;
+    }
+    else
+    {
+        class_index =  NX_IP_PACKET_FILTER_CLASS_OTHER;
+    }
+
+    /* Pickup the ports and TCP flags from the first fragment of a TCP or UDP datagram.  */
+    transport =         NX_FALSE;
+    source_port =       0;
+    destination_port =  0;
+    tcp_flags =         0;
+    if (((class_index == NX_IP_PACKET_FILTER_CLASS_TCP) || (class_index == NX_IP_PACKET_FILTER_CLASS_UDP)) &&
+        ((ip_header_ptr -> nx_ip_header_word_1 & NX_IP_OFFSET_MASK) == 0))
+    {
+
+        /* Setup a pointer to the TCP or UDP header, which is still in network byte order.  */
+        transport_ptr =  packet_ptr -> nx_packet_prepend_ptr + sizeof(NX_IP_HEADER);
+
+        /* Make sure the ports, and for TCP the flags, are in the first packet.  */
+        if ((ULONG)(packet_ptr -> nx_packet_append_ptr - transport_ptr) >=
+            ((class_index == NX_IP_PACKET_FILTER_CLASS_TCP) ? 14UL : 4UL))
+        {
+            source_port =       ((UINT)transport_ptr[0] << 8) | (UINT)transport_ptr[1];
+            destination_port =  ((UINT)transport_ptr[2] << 8) | (UINT)transport_ptr[3];
+            if (class_index == NX_IP_PACKET_FILTER_CLASS_TCP)
+            {
+                tcp_flags =  (UINT)transport_ptr[13];
+            }
+            transport =  NX_TRUE;
+        }
+    }
+
+    /* Walk the rules that can match this protocol class, in order.  */
+    count =  ip_ptr -> nx_ip_packet_filter_class_count[class_index];
+    table =  ip_ptr -> nx_ip_packet_filter_class_table[class_index];
+    for (i = 0; i < count; i++)
+    {
+
+        /* Setup a pointer to the rule.  */
+        rule_ptr =  &rules[table[i]];
+
+        /* Compare the addresses, protocol and interface.  */
+        if (((ip_header_ptr -> nx_ip_header_source_ip & rule_ptr -> nx_ip_packet_filter_rule_source_mask) !=
+             rule_ptr -> nx_ip_packet_filter_rule_source_ip) ||
+            ((ip_header_ptr -> nx_ip_header_destination_ip & rule_ptr -> nx_ip_packet_filter_rule_destination_mask) !=
+             rule_ptr -> nx_ip_packet_filter_rule_destination_ip) ||
+            ((rule_ptr -> nx_ip_packet_filter_rule_protocol) && (rule_ptr -> nx_ip_packet_filter_rule_protocol != protocol)) ||
+            ((rule_ptr -> nx_ip_packet_filter_rule_interface) &&
+             (rule_ptr -> nx_ip_packet_filter_rule_interface != packet_ptr -> nx_packet_ip_interface)))
+        {
+            continue;
+        }
+
+        /* Compare the ports and TCP flags, if the rule uses them.  */
+        if ((rule_ptr -> nx_ip_packet_filter_rule_transport) &&
+            ((transport == NX_FALSE) ||
+             (source_port < rule_ptr -> nx_ip_packet_filter_rule_source_port_low) ||
+             (source_port > rule_ptr -> nx_ip_packet_filter_rule_source_port_high) ||
+             (destination_port < rule_ptr -> nx_ip_packet_filter_rule_destination_port_low) ||
+             (destination_port > rule_ptr -> nx_ip_packet_filter_rule_destination_port_high) ||
+             ((tcp_flags & rule_ptr -> nx_ip_packet_filter_rule_tcp_flags_mask) != rule_ptr -> nx_ip_packet_filter_rule_tcp_flags_value)))
+        {
+            continue;
+        }
+
+        /* The rule matches.  */
+        rule_ptr -> nx_ip_packet_filter_rule_matches++;
+
+        /* Determine if the rule is rate limited.  */
+        if (rule_ptr -> nx_ip_packet_filter_rule_action != NX_IP_PACKET_FILTER_RATE_LIMIT)
+        {
+            return(rule_ptr -> nx_ip_packet_filter_rule_action);
+        }
+
+        /* Fill the token bucket for the time elapsed, up to the burst.  */
+        current_time =  tx_time_get();
+        elapsed =       current_time - rule_ptr -> nx_ip_packet_filter_rule_time;
+        limit =         rule_ptr -> nx_ip_packet_filter_rule_burst * NX_IP_PERIODIC_RATE;
+        rule_ptr -> nx_ip_packet_filter_rule_time =  current_time;
+        if (elapsed >= (limit / rule_ptr -> nx_ip_packet_filter_rule_rate) + 1)
+        {
+            rule_ptr -> nx_ip_packet_filter_rule_tokens =  limit;
+        }
+        else
+        {
+            rule_ptr -> nx_ip_packet_filter_rule_tokens += elapsed * rule_ptr -> nx_ip_packet_filter_rule_rate;
+            if (rule_ptr -> nx_ip_packet_filter_rule_tokens > limit)
+            {
+                rule_ptr -> nx_ip_packet_filter_rule_tokens =  limit;
+            }
+        }
+
+        /* Accept the packet if the bucket holds a packet's worth of tokens.  */
+        if (rule_ptr -> nx_ip_packet_filter_rule_tokens >= NX_IP_PERIODIC_RATE)
+        {
+            rule_ptr -> nx_ip_packet_filter_rule_tokens -=  NX_IP_PERIODIC_RATE;
+            return(NX_IP_PACKET_FILTER_ACCEPT);
+        }
+
+        /* Over the rate, drop the packet.  */
+        return(NX_IP_PACKET_FILTER_DROP);
+    }
+
+    /* No rule matches, take the default action.  */
+    return(ip_ptr -> nx_ip_packet_filter_default_action);
+}
+#endif /* NX_ENABLE_IP_PACKET_FILTER */
+
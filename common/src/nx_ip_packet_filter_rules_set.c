@@ -0,0 +1,223 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_packet_filter_rules_set                      PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function installs an ordered list of packet filter rules on the*/
+/*    IP instance, replacing any rules installed before. A rule count of  */
+/*    zero removes the rules, and every packet then gets the default      */
+/*    action. Each rule is normalized and assigned to the protocol        */
+/*    classes it can match, building a decision table so a                */
+/*    received packet is only compared with the rules that apply to its   */
+/*    protocol.                                                           */
+/*                                                                        */
+/*    The rule array is normalized in place and used by the receive path, */
+/*    so it must remain valid and unmodified while installed.             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP control block   */
+/*    rule_array                            Pointer to array of rules     */
+/*    rule_count                            Number of rules in the array  */
+/*    default_action                        Action for packets matching no*/
+/*                                            rule                        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Obtain protection mutex       */
+/*    tx_mutex_put                          Release protection mutex      */
+/*    tx_time_get                           Get current time              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_ip_packet_filter_rules_set(NX_IP *ip_ptr, NX_IP_PACKET_FILTER_RULE *rule_array, UINT rule_count, UINT default_action)
+{
+#ifdef NX_ENABLE_IP_PACKET_FILTER
+
+TX_INTERRUPT_SAVE_AREA
+
+NX_IP_PACKET_FILTER_RULE *rule_ptr;
+UINT                      i;
+UINT                      class_index;
+UINT                      class_mask;
+
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_IP_PACKET_FILTER_RULES_SET, ip_ptr, rule_array, rule_count, default_action, NX_TRACE_IP_EVENTS, 0, 0)
+
+    /* Obtain the IP internal mutex.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Disable the rules while the decision table is rebuilt.  */
+    TX_DISABLE
+    ip_ptr -> nx_ip_packet_filter_rules_enabled =  NX_FALSE;
+    ip_ptr -> nx_ip_packet_filter_rules =          NX_NULL;
+    TX_RESTORE
+
+    /* Clear the decision table.  */
+    for (class_index = 0; class_index < NX_IP_PACKET_FILTER_CLASSES; class_index++)
+    {
+        ip_ptr -> nx_ip_packet_filter_class_count[class_index] =  0;
+    }
+
+    /* Loop to compile each rule.  */
+    for (i = 0; i < rule_count; i++)
+    {
+
+        /* Setup a pointer to the rule.  */
+        rule_ptr =  &rule_array[i];
+
+        /* Pre-mask the addresses so they are compared with a single AND.  */
+        rule_ptr -> nx_ip_packet_filter_rule_source_ip &=       rule_ptr -> nx_ip_packet_filter_rule_source_mask;
+        rule_ptr -> nx_ip_packet_filter_rule_destination_ip &=  rule_ptr -> nx_ip_packet_filter_rule_destination_mask;
+
+        /* A high port of zero leaves the range open.  */
+        if (rule_ptr -> nx_ip_packet_filter_rule_source_port_high == 0)
+        {
+            rule_ptr -> nx_ip_packet_filter_rule_source_port_high =  0xFFFF;
+        }
+        if (rule_ptr -> nx_ip_packet_filter_rule_destination_port_high == 0)
+        {
+            rule_ptr -> nx_ip_packet_filter_rule_destination_port_high =  0xFFFF;
+        }
+
+        /* Determine if the rule looks into the TCP or UDP header.  */
+        rule_ptr -> nx_ip_packet_filter_rule_transport =
+            (UCHAR)((rule_ptr -> nx_ip_packet_filter_rule_source_port_low != 0) ||
+                    (rule_ptr -> nx_ip_packet_filter_rule_source_port_high != 0xFFFF) ||
+                    (rule_ptr -> nx_ip_packet_filter_rule_destination_port_low != 0) ||
+                    (rule_ptr -> nx_ip_packet_filter_rule_destination_port_high != 0xFFFF) ||
+                    (rule_ptr -> nx_ip_packet_filter_rule_tcp_flags_mask != 0));
+
+        /* Start a rate limited rule with a full bucket.  */
+        if (rule_ptr -> nx_ip_packet_filter_rule_burst == 0)
+        {
+            rule_ptr -> nx_ip_packet_filter_rule_burst =  1;
+        }
+        rule_ptr -> nx_ip_packet_filter_rule_tokens =   rule_ptr -> nx_ip_packet_filter_rule_burst * NX_IP_PERIODIC_RATE;
+        rule_ptr -> nx_ip_packet_filter_rule_time =     tx_time_get();
+        rule_ptr -> nx_ip_packet_filter_rule_matches =  0;
+
+        /* Work out the protocol classes the rule can match.  */
+        if (rule_ptr -> nx_ip_packet_filter_rule_protocol == NX_IP_ICMP)
+        {
+            class_mask =  (1 << NX_IP_PACKET_FILTER_CLASS_ICMP);
+        }
+        else if (rule_ptr -> nx_ip_packet_filter_rule_protocol == NX_IP_TCP)
+        {
+            class_mask =  (1 << NX_IP_PACKET_FILTER_CLASS_TCP);
+        }
+        else if (rule_ptr -> nx_ip_packet_filter_rule_protocol == NX_IP_UDP)
+        {
+            class_mask =  (1 << NX_IP_PACKET_FILTER_CLASS_UDP);
+        }
+        else if (rule_ptr -> nx_ip_packet_filter_rule_protocol)
+        {
+            class_mask =  (1 << NX_IP_PACKET_FILTER_CLASS_OTHER);
+        }
+        else if (rule_ptr -> nx_ip_packet_filter_rule_tcp_flags_mask)
+        {
+
+            /* Any protocol, but only TCP has flags.  */
+            class_mask =  (1 << NX_IP_PACKET_FILTER_CLASS_TCP);
+        }
+        else if (rule_ptr -> nx_ip_packet_filter_rule_transport)
+        {
+
+            /* Any protocol, but only TCP and UDP have ports.  */
+            class_mask =  (1 << NX_IP_PACKET_FILTER_CLASS_TCP) | (1 << NX_IP_PACKET_FILTER_CLASS_UDP);
+        }
+        else
+        {
+            class_mask =  (1 << NX_IP_PACKET_FILTER_CLASSES) - 1;
+        }
+
+        /* Append the rule to the table of each of those classes.  */
+        for (class_index = 0; class_index < NX_IP_PACKET_FILTER_CLASSES; class_index++)
+        {
+            if (class_mask & (1 << class_index))
+            {
+                ip_ptr -> nx_ip_packet_filter_class_table[class_index][ip_ptr -> nx_ip_packet_filter_class_count[class_index]] =  (UCHAR)i;
+                ip_ptr -> nx_ip_packet_filter_class_count[class_index]++;
+            }
+        }
+    }
+
+    /* Install the rules.  With no rules the filter is only needed to apply a default
+       action of drop.  */
+    ip_ptr -> nx_ip_packet_filter_default_action =  default_action;
+    if ((rule_count) || (default_action != NX_IP_PACKET_FILTER_ACCEPT))
+    {
+        TX_DISABLE
+        ip_ptr -> nx_ip_packet_filter_rules =          rule_array;
+        ip_ptr -> nx_ip_packet_filter_rules_enabled =  NX_TRUE;
+        TX_RESTORE
+    }
+
+    /* Release the IP internal mutex.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Return success.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_IP_PACKET_FILTER */
+    NX_PARAMETER_NOT_USED(ip_ptr);
+    NX_PARAMETER_NOT_USED(rule_array);
+    NX_PARAMETER_NOT_USED(rule_count);
+    NX_PARAMETER_NOT_USED(default_action);
+
+    return(NX_NOT_SUPPORTED);
+#endif /* NX_ENABLE_IP_PACKET_FILTER */
+}
+
@@ -0,0 +1,125 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+#ifdef NX_ENABLE_IP_RECEIVE_QUEUES
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_packet_flow_hash                             PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes the receive flow hash of an IP packet whose  */
+/*    IP header starts at the prepend pointer.  The hash covers the source*/
+/*    and destination addresses and the protocol.  For TCP segments that  */
+/*    are not fragmented it also covers the ports.  Other protocols hash  */
+/*    on addresses only, so fragments of a datagram are steered together  */
+/*    with unfragmented datagrams of the same flow.                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    packet_ptr                            Pointer to received packet    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    flow_hash                             Hash of the packet's flow     */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_packet_deferred_receive        Defer IP packet receive       */
+/*    _nx_ip_packet_deferred_chain_receive  Defer chain of IP packets     */
+/*    Application I/O Driver                                              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _nx_ip_packet_flow_hash(NX_PACKET *packet_ptr)
+{
+
+UCHAR *header_ptr;
+ULONG  header_length;
+ULONG  hash;
+
+
+    /* Pickup a pointer to the IP header.  */
+    header_ptr =  packet_ptr -> nx_packet_prepend_ptr;
+
+    /* Make sure the fixed IP header is in the first packet.  */
+    if ((ULONG)(packet_ptr -> nx_packet_append_ptr - header_ptr) < sizeof(NX_IP_HEADER))
+    {
+
+        /* Too short to classify, steer onto the first queue.  */
+        return(0);
+    }
+
+    /* Mix the source address, destination address and protocol.  */
+    hash =  (((ULONG)header_ptr[12]) << 24) | (((ULONG)header_ptr[13]) << 16) |
+            (((ULONG)header_ptr[14]) << 8) | ((ULONG)header_ptr[15]);
+    hash =  hash ^ ((((ULONG)header_ptr[16]) << 16) | (((ULONG)header_ptr[17]) << 24) |
+                    ((ULONG)header_ptr[18]) | (((ULONG)header_ptr[19]) << 8));
+    hash =  hash ^ ((ULONG)header_ptr[9]);
+
+    /* Pickup the IP header length in bytes.  */
+    header_length =  ((ULONG)(header_ptr[0] & 0x0F)) << 2;
+
+    /* Determine if this is an unfragmented TCP segment with its ports in the first packet.  */
+    if ((header_ptr[9] == 6) && ((header_ptr[6] & 0x3F) == 0) && (header_ptr[7] == 0) &&
+        ((ULONG)(packet_ptr -> nx_packet_append_ptr - header_ptr) >= (header_length + 4)))
+    {
+
+        /* Yes, mix in the source and destination ports.  */
+        hash =  hash ^ ((((ULONG)header_ptr[header_length]) << 8) | ((ULONG)header_ptr[header_length + 1]) |
+                        (((ULONG)header_ptr[header_length + 2]) << 24) | (((ULONG)header_ptr[header_length + 3]) << 16));
+    }
+
+    /* Spread every input bit over the low order bits used to select the queue.  */
+    hash =  hash ^ (hash >> 16);
+    hash =  (hash * 0x45D9F3B) & 0xFFFFFFFF;
+    hash =  hash ^ (hash >> 16);
+
+    /* Return the flow hash.  */
+    return(hash);
+}
+#endif /* NX_ENABLE_IP_RECEIVE_QUEUES */
+
@@ -0,0 +1,134 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+#ifdef NX_ENABLE_IP_RECEIVE_QUEUES
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_packet_flow_receive                          PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places a received IP packet on the receive queue      */
+/*    selected by its flow hash and wakes up the receive thread of that   */
+/*    queue when the queue was empty.  If the receive queues have not been*/
+/*    created, the packet is deferred to the IP helper thread.  It may be */
+/*    called from the driver's receive ISR.                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP control block   */
+/*    packet_ptr                            Pointer to packet to receive  */
+/*    flow_hash                             Hash of the packet's flow     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_packet_deferred_receive        Defer IP packet receive       */
+/*    tx_semaphore_put                      Wakeup receive thread         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_packet_deferred_receive        Defer IP packet receive       */
+/*    _nx_ip_packet_deferred_chain_receive  Defer chain of IP packets     */
+/*    Application I/O Driver                                              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_ip_packet_flow_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr, ULONG flow_hash)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+NX_IP_RECEIVE_QUEUE *queue_ptr;
+
+
+    /* Select the queue of this flow.  */
+    queue_ptr =  &(ip_ptr -> nx_ip_receive_queues[flow_hash & (NX_IP_RECEIVE_QUEUES - 1)]);
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Determine if the receive queues are running.  This is checked with interrupts
+       disabled, since nx_ip_delete stops the queues with interrupts disabled and then
+       releases the packets left on them.  */
+    if (ip_ptr -> nx_ip_receive_queues_active == 0)
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* No, defer the packet to the IP helper thread.  */
+        _nx_ip_packet_deferred_receive(ip_ptr, packet_ptr);
+        return;
+    }
+
+    /* Place the packet at the end of the queue.  */
+    packet_ptr -> nx_packet_queue_next =  NX_NULL;
+    if (queue_ptr -> nx_ip_receive_queue_head)
+    {
+
+        /* Not empty, the receive thread is already processing this queue.  */
+        (queue_ptr -> nx_ip_receive_queue_tail) -> nx_packet_queue_next =  packet_ptr;
+        queue_ptr -> nx_ip_receive_queue_tail =  packet_ptr;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+    else
+    {
+
+        /* Empty queue, setup the head and tail pointers.  */
+        queue_ptr -> nx_ip_receive_queue_head =  packet_ptr;
+        queue_ptr -> nx_ip_receive_queue_tail =  packet_ptr;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Wakeup the receive thread of this queue.  */
+        tx_semaphore_put(&(queue_ptr -> nx_ip_receive_queue_semaphore));
+    }
+}
+#endif /* NX_ENABLE_IP_RECEIVE_QUEUES */
+
@@ -67,6 +67,7 @@
 /*    (ip_raw_ip_raw_packet_processing)     Process a Raw IP packet       */
 /*    (nx_ip_forward_packet_process)        Forward IP packet             */
 /*    _nx_igmp_multicast_check              Check for Multicast match     */
+/*    _nx_ip_packet_filter_rules_check      Check packet filter rules     */
 /*    _nx_packet_release                    Packet release function       */
 /*    tx_event_flags_set                    Set events for IP thread      */
 /*                                                                        */
@@ -467,6 +468,26 @@ ULONG          temp;
     }
 #endif /* NX_ENABLE_SOURCE_ADDRESS_CHECK */
 
+#ifdef NX_ENABLE_IP_PACKET_FILTER
+    /* Check the packet against the packet filter rules, if they are enabled.  */
+    if ((ip_ptr -> nx_ip_packet_filter_rules_enabled) &&
+        (_nx_ip_packet_filter_rules_check(ip_ptr, packet_ptr) != NX_IP_PACKET_FILTER_ACCEPT))
+    {
+
+#ifndef NX_DISABLE_IP_INFO
+
+        /* Increment the IP receive packets dropped count.  */
+        ip_ptr -> nx_ip_receive_packets_dropped++;
+#endif
+
+        /* Drop the packet.  */
+        _nx_packet_release(packet_ptr);
+
+        /* Return to caller.  */
+        return;
+    }
+#endif /* NX_ENABLE_IP_PACKET_FILTER */
+
     /* Determine if the IP datagram is for this IP address or a broadcast IP on this
        network.  */
     if ((ip_header_ptr -> nx_ip_header_destination_ip == packet_ptr -> nx_packet_ip_interface -> nx_interface_ip_address) ||
@@ -66,6 +66,9 @@
 /*    _nx_packet_copy                       Copy packet for loopback      */
 /*    _nx_packet_transmit_release           Release transmit packet       */
 /*    _nx_ip_loopback_send                  Send packet via the LB driver */
+/*    _nx_igmp_group_find                   Find multicast group entry    */
+/*    _nx_arp_entry_touch                   Mark ARP entry recently used  */
+/*    _nx_arp_entry_packet_queue            Queue packet for resolution   */
 /*    (nx_ip_fragment_processing)           Fragment processing           */
 /*    (ip_link_driver)                      User supplied link driver     */
 /*                                                                        */
@@ -95,9 +98,14 @@ ULONG      temp;
 #endif /* !NX_DISABLE_IP_TX_CHECKSUM */
 UINT       index;
 NX_ARP    *arp_ptr;
-NX_PACKET *last_packet;
-NX_PACKET *remove_packet;
-UINT       queued_count;
+#ifdef NX_ENABLE_IGMP_GROUP_TABLE
+NX_IGMP_GROUP
+          *group_ptr;
+#endif /* NX_ENABLE_IGMP_GROUP_TABLE */
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+NX_IP_DESTINATION_CACHE
+          *cache_ptr;
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
 
 
 #ifndef NX_DISABLE_IP_INFO
@@ -106,6 +114,13 @@ UINT       queued_count;
     ip_ptr -> nx_ip_total_packet_send_requests++;
 #endif /* !NX_DISABLE_IP_INFO */
 
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+
+    /* Pickup the destination cache of the packet, which is only valid for this send.  */
+    cache_ptr =  packet_ptr -> nx_packet_destination_cache;
+    packet_ptr -> nx_packet_destination_cache =  NX_NULL;
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
+
     /* Prepend the IP header to the packet.  First, make room for the IP header.  */
     packet_ptr -> nx_packet_prepend_ptr =  packet_ptr -> nx_packet_prepend_ptr - sizeof(NX_IP_HEADER);
 
@@ -247,6 +262,7 @@ UINT       queued_count;
             driver_request.nx_ip_driver_physical_address_msw =  0xFFFFUL;
             driver_request.nx_ip_driver_physical_address_lsw =  0xFFFFFFFFUL;
             driver_request.nx_ip_driver_interface            =  packet_ptr -> nx_packet_ip_interface;
+            NX_IP_DRIVER_TRANSMIT_MORE_SET(driver_request, NX_IP_TRANSMIT_MORE(ip_ptr));
 #ifndef NX_DISABLE_FRAGMENTATION
             /* Determine if fragmentation is needed.  */
             if ((packet_ptr -> nx_packet_length) > (packet_ptr -> nx_packet_ip_interface -> nx_interface_ip_mtu_size))
@@ -306,6 +322,10 @@ UINT       queued_count;
             driver_request.nx_ip_driver_interface            =  packet_ptr -> nx_packet_ip_interface;
 
             /* Determine if the group was joined by this IP instance, and requested a packet via its loopback interface.  */
+#ifdef NX_ENABLE_IGMP_GROUP_TABLE
+            group_ptr =  _nx_igmp_group_find(ip_ptr, destination_ip);
+            if ((group_ptr) && (group_ptr -> nx_igmp_group_loopback_enable))
+#else
             index =  0;
             while (index < NX_MAX_MULTICAST_GROUPS)
             {
@@ -321,21 +341,17 @@ UINT       queued_count;
                 /* Increment the join list index.  */
                 index++;
             }
-            if (index < NX_MAX_MULTICAST_GROUPS)
+            if ((index < NX_MAX_MULTICAST_GROUPS) && (ip_ptr -> nx_ip_igmp_group_loopback_enable[index]))
+#endif /* NX_ENABLE_IGMP_GROUP_TABLE */
             {
 
-                /* Determine if the group has loopback enabled.  */
-                if (ip_ptr -> nx_ip_igmp_group_loopback_enable[index])
-                {
-
-                    /*
-                       Yes, loopback is enabled! Send the packet via
-                       the loopback interface, and do not release the
-                       original packet so it can be transmitted via a physical
-                       interface later on.
-                     */
-                    _nx_ip_loopback_send(ip_ptr, packet_ptr, NX_FALSE);
-                }
+                /*
+                   Yes, loopback is enabled! Send the packet via
+                   the loopback interface, and do not release the
+                   original packet so it can be transmitted via a physical
+                   interface later on.
+                 */
+                _nx_ip_loopback_send(ip_ptr, packet_ptr, NX_FALSE);
             }
 
             /* Build the driver request.  */
@@ -343,6 +359,7 @@ UINT       queued_count;
             driver_request.nx_ip_driver_command    =  NX_LINK_PACKET_SEND;
             driver_request.nx_ip_driver_packet     =  packet_ptr;
             driver_request.nx_ip_driver_interface  =  packet_ptr -> nx_packet_ip_interface;
+            NX_IP_DRIVER_TRANSMIT_MORE_SET(driver_request, NX_IP_TRANSMIT_MORE(ip_ptr));
 
 #ifndef NX_DISABLE_FRAGMENTATION
             /* Determine if fragmentation is needed.  */
@@ -398,7 +415,7 @@ UINT       queued_count;
         /* Look into the ARP Routing Table to derive the physical address.  */
 
         /* Calculate the hash index for the destination IP address.  */
-        index =  (UINT)((destination_ip + (destination_ip >> 8)) & NX_ROUTE_TABLE_MASK);
+        index =  NX_ARP_HASH(destination_ip);
 
         /* Disable interrupts temporarily.  */
         TX_DISABLE
@@ -406,6 +423,20 @@ UINT       queued_count;
         /* Determine if there is an entry for this IP address.  */
         arp_ptr =  ip_ptr -> nx_ip_arp_table[index];
 
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+
+        /* Determine if the destination cache pins an active ARP entry for the next hop.  */
+        if ((cache_ptr) && (cache_ptr -> nx_ip_destination_cache_arp) &&
+            (cache_ptr -> nx_ip_destination_cache_arp -> nx_arp_active_list_head) &&
+            (cache_ptr -> nx_ip_destination_cache_arp -> nx_arp_ip_address == destination_ip) &&
+            (cache_ptr -> nx_ip_destination_cache_arp -> nx_arp_ip_interface == packet_ptr -> nx_packet_ip_interface))
+        {
+
+            /* Yes, use it instead of the entry at the head of the hash bucket.  */
+            arp_ptr =  cache_ptr -> nx_ip_destination_cache_arp;
+        }
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
+
         /* Determine if this arp entry matches the destination IP address.  */
         if ((arp_ptr) && (arp_ptr -> nx_arp_ip_address == destination_ip))
         {
@@ -422,6 +453,18 @@ UINT       queued_count;
                 driver_request.nx_ip_driver_physical_address_lsw =  arp_ptr -> nx_arp_physical_address_lsw;
                 driver_request.nx_ip_driver_interface            =  packet_ptr -> nx_packet_ip_interface;
 
+                /* Mark the ARP entry as the most recently used.  */
+                _nx_arp_entry_touch(ip_ptr, arp_ptr);
+
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+
+                /* Pin the ARP entry in the destination cache.  */
+                if (cache_ptr)
+                {
+                    cache_ptr -> nx_ip_destination_cache_arp =  arp_ptr;
+                }
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
+
                 /* Restore interrupts.  */
                 TX_RESTORE
 
@@ -429,6 +472,7 @@ UINT       queued_count;
                 driver_request.nx_ip_driver_ptr =      ip_ptr;
                 driver_request.nx_ip_driver_command =  NX_LINK_PACKET_SEND;
                 driver_request.nx_ip_driver_packet =   packet_ptr;
+                NX_IP_DRIVER_TRANSMIT_MORE_SET(driver_request, NX_IP_TRANSMIT_MORE(ip_ptr));
 
 #ifndef NX_DISABLE_FRAGMENTATION
                 /* Determine if fragmentation is needed.  */
@@ -481,81 +525,11 @@ UINT       queued_count;
             else
             {
 
-                /* No physical mapping available. Set the current packet's queue next pointer to NULL.  */
-                packet_ptr -> nx_packet_queue_next =  NX_NULL;
-
-                /* Determine if the queue is empty.  */
-                if (arp_ptr -> nx_arp_packets_waiting == NX_NULL)
-                {
-
-                    /* Yes, we have an empty ARP packet queue.  Simply place the
-                       packet at the head of the list.  */
-                    arp_ptr -> nx_arp_packets_waiting =  packet_ptr;
-
-                    /* Restore interrupts.  */
-                    TX_RESTORE
-                }
-                else
-                {
-
-                    /* Determine how many packets are on the ARP entry's packet
-                       queue and remember the last packet in the queue.  We know
-                       there is at least one on the queue and another that is
-                       going to be queued.  */
-                    last_packet =  arp_ptr -> nx_arp_packets_waiting;
-                    queued_count = 1;
-                    while (last_packet -> nx_packet_queue_next)
-                    {
-
-                        /* Increment the queued count.  */
-                        queued_count++;
-
-                        /* Yes, move to the next packet in the queue.  */
-                        last_packet =  last_packet -> nx_packet_queue_next;
-                    }
-
-                    /* Place the packet at the end of the list.  */
-                    last_packet -> nx_packet_queue_next =  packet_ptr;
-
-                    /* Default the remove packet pointer to NULL.  */
-                    remove_packet =  NX_NULL;
-
-                    /* Determine if the packets queued has exceeded the queue
-                       depth.  */
-                    if (queued_count >= NX_ARP_MAX_QUEUE_DEPTH)
-                    {
-
-                        /* Save the packet pointer at the head of the list.  */
-                        remove_packet =  arp_ptr -> nx_arp_packets_waiting;
-
-                        /* Remove the packet from the ARP queue.  */
-                        arp_ptr -> nx_arp_packets_waiting =  remove_packet -> nx_packet_queue_next;
-
-                        /* Clear the remove packet queue next pointer.  */
-                        remove_packet -> nx_packet_queue_next =  NX_NULL;
-
-#ifndef NX_DISABLE_IP_INFO
-
-                        /* Increment the IP transmit resource error count.  */
-                        ip_ptr -> nx_ip_transmit_resource_errors++;
-
-                        /* Increment the IP send packets dropped count.  */
-                        ip_ptr -> nx_ip_send_packets_dropped++;
-#endif /* !NX_DISABLE_IP_INFO */
-                    }
-
-                    /* Restore interrupts.  */
-                    TX_RESTORE
-
-                    /* Determine if there is a packet to remove.  */
-                    if (remove_packet)
-                    {
+                /* No physical mapping available.  Restore interrupts.  */
+                TX_RESTORE
 
-                        /* Yes, the packet queue depth for this ARP entry was exceeded
-                           so release the packet that was removed from the queue.  */
-                        _nx_packet_transmit_release(remove_packet);
-                    }
-                }
+                /* Queue the packet until the address is resolved.  */
+                _nx_arp_entry_packet_queue(ip_ptr, arp_ptr, packet_ptr);
 
                 /* Return to caller.  */
                 return;
@@ -617,6 +591,18 @@ UINT       queued_count;
                     /* Move this ARP entry to the head of the list.  */
                     ip_ptr -> nx_ip_arp_table[index] =  arp_ptr;
 
+                    /* Mark the ARP entry as the most recently used.  */
+                    _nx_arp_entry_touch(ip_ptr, arp_ptr);
+
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+
+                    /* Pin the ARP entry in the destination cache.  */
+                    if (cache_ptr)
+                    {
+                        cache_ptr -> nx_ip_destination_cache_arp =  arp_ptr;
+                    }
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
+
                     /* Restore interrupts.  */
                     TX_RESTORE
 
@@ -625,6 +611,7 @@ UINT       queued_count;
                     driver_request.nx_ip_driver_command    =  NX_LINK_PACKET_SEND;
                     driver_request.nx_ip_driver_packet     =  packet_ptr;
                     driver_request.nx_ip_driver_interface  =  packet_ptr -> nx_packet_ip_interface;
+                    NX_IP_DRIVER_TRANSMIT_MORE_SET(driver_request, NX_IP_TRANSMIT_MORE(ip_ptr));
 
 #ifndef NX_DISABLE_FRAGMENTATION
                     /* Determine if fragmentation is needed.  */
@@ -679,85 +666,8 @@ UINT       queued_count;
 
                     /* We don't have physical mapping.  */
 
-                    /* Disable interrupts.  */
-                    TX_DISABLE
-
-                    /* Ensure the current packet's queue next pointer to NULL.  */
-                    packet_ptr -> nx_packet_queue_next =  NX_NULL;
-
-                    /* Determine if the queue is empty.  */
-                    if (arp_ptr -> nx_arp_packets_waiting == NX_NULL)
-                    {
-
-                        /* Yes, we have an empty ARP packet queue.  Simply place the
-                           packet at the head of the list.  */
-                        arp_ptr -> nx_arp_packets_waiting =  packet_ptr;
-
-                        /* Restore interrupts.  */
-                        TX_RESTORE
-                    }
-                    else
-                    {
-
-
-                        /* Determine how many packets are on the ARP entry's packet
-                           queue and remember the last packet in the queue.  We know
-                           there is at least one on the queue and another that is
-                           going to be queued.  */
-                        last_packet =  arp_ptr -> nx_arp_packets_waiting;
-                        queued_count = 1;
-                        while (last_packet -> nx_packet_queue_next)
-                        {
-
-                            /* Increment the queued count.  */
-                            queued_count++;
-
-                            /* Yes, move to the next packet in the queue.  */
-                            last_packet =  last_packet -> nx_packet_queue_next;
-                        }
-
-                        /* Place the packet at the end of the list.  */
-                        last_packet -> nx_packet_queue_next =  packet_ptr;
-
-                        /* Default the remove packet pointer to NULL.  */
-                        remove_packet =  NX_NULL;
-
-                        /* Determine if the packets queued has exceeded the queue
-                           depth.  */
-                        if (queued_count >= NX_ARP_MAX_QUEUE_DEPTH)
-                        {
-
-                            /* Save the packet pointer at the head of the list.  */
-                            remove_packet =  arp_ptr -> nx_arp_packets_waiting;
-
-                            /* Remove the packet from the ARP queue.  */
-                            arp_ptr -> nx_arp_packets_waiting =  remove_packet -> nx_packet_queue_next;
-
-                            /* Clear the remove packet queue next pointer.  */
-                            remove_packet -> nx_packet_queue_next =  NX_NULL;
-
-#ifndef NX_DISABLE_IP_INFO
-
-                            /* Increment the IP transmit resource error count.  */
-                            ip_ptr -> nx_ip_transmit_resource_errors++;
-
-                            /* Increment the IP send packets dropped count.  */
-                            ip_ptr -> nx_ip_send_packets_dropped++;
-#endif /* !NX_DISABLE_IP_INFO */
-                        }
-
-                        /* Restore interrupts.  */
-                        TX_RESTORE
-
-                        /* Determine if there is a packet to remove.  */
-                        if (remove_packet)
-                        {
-
-                            /* Yes, the packet queue depth for this ARP entry was exceeded
-                               so release the packet that was removed from the queue.  */
-                            _nx_packet_transmit_release(remove_packet);
-                        }
-                    }
+                    /* Queue the packet until the address is resolved.  */
+                    _nx_arp_entry_packet_queue(ip_ptr, arp_ptr, packet_ptr);
 
                     /* Return to caller.  */
                     return;
@@ -799,16 +709,12 @@ UINT       queued_count;
                 arp_ptr -> nx_arp_ip_address           =  destination_ip;
                 arp_ptr -> nx_arp_physical_address_msw =  0;
                 arp_ptr -> nx_arp_physical_address_lsw =  0;
-                arp_ptr -> nx_arp_entry_next_update    =  NX_ARP_UPDATE_RATE;
                 arp_ptr -> nx_arp_retries              =  0;
                 arp_ptr -> nx_arp_ip_interface         =  packet_ptr -> nx_packet_ip_interface;
-
-                /* Ensure the queue next pointer is NULL for the packet before it
-                   is placed on the ARP waiting queue.  */
-                packet_ptr -> nx_packet_queue_next =  NX_NULL;
+                NX_ARP_ENTRY_NEXT_UPDATE_SET(ip_ptr, arp_ptr, NX_ARP_UPDATE_RATE);
 
                 /* Queue the packet for output.  */
-                arp_ptr -> nx_arp_packets_waiting =  packet_ptr;
+                _nx_arp_entry_packet_queue(ip_ptr, arp_ptr, packet_ptr);
 
                 /* Call ARP send to send an ARP request.  */
                 (ip_ptr -> nx_ip_arp_packet_send)(ip_ptr, destination_ip, packet_ptr -> nx_packet_ip_interface);
@@ -826,6 +732,7 @@ UINT       queued_count;
         driver_request.nx_ip_driver_command    =  NX_LINK_PACKET_SEND;
         driver_request.nx_ip_driver_packet     =  packet_ptr;
         driver_request.nx_ip_driver_interface  =  packet_ptr -> nx_packet_ip_interface;
+        NX_IP_DRIVER_TRANSMIT_MORE_SET(driver_request, NX_IP_TRANSMIT_MORE(ip_ptr));
 
 #ifndef NX_DISABLE_FRAGMENTATION
         /* Determine if fragmentation is needed.  */
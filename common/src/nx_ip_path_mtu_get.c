@@ -0,0 +1,108 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+#ifdef NX_ENABLE_IP_PATH_MTU_DISCOVERY
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_path_mtu_get                                 PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the path MTU to the specified destination. It */
+/*    is the MTU learned from ICMP fragmentation needed messages if the   */
+/*    destination is in the path MTU cache, and never more than the       */
+/*    supplied MTU of the outgoing interface.                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    destination_address                   Destination IP address        */
+/*    mtu                                   MTU of the outgoing interface */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    path_mtu                              Path MTU to the destination   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_destination_cache_route        Find route using the cache    */
+/*    _nx_tcp_socket_path_mtu_refresh       Refresh TCP socket MSS        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _nx_ip_path_mtu_get(NX_IP *ip_ptr, ULONG destination_address, ULONG mtu)
+{
+
+UINT            i;
+NX_IP_PATH_MTU *entry_ptr;
+
+
+    /* Search the path MTU cache for the destination.  */
+    for (i = 0; i < NX_IP_PATH_MTU_CACHE_SIZE; i++)
+    {
+
+        /* Pickup the entry.  */
+        entry_ptr =  &(ip_ptr -> nx_ip_path_mtu_cache[i]);
+
+        /* Determine if this entry is valid and for the destination.  */
+        if ((entry_ptr -> nx_ip_path_mtu_timeout) &&
+            (entry_ptr -> nx_ip_path_mtu_address == destination_address))
+        {
+
+            /* Yes, the path MTU can not be larger than the interface MTU.  */
+            if (entry_ptr -> nx_ip_path_mtu_size < mtu)
+            {
+                return(entry_ptr -> nx_ip_path_mtu_size);
+            }
+            break;
+        }
+    }
+
+    /* Return the MTU of the interface.  */
+    return(mtu);
+}
+#endif /* NX_ENABLE_IP_PATH_MTU_DISCOVERY */
+
@@ -0,0 +1,112 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+#ifdef NX_ENABLE_IP_PATH_MTU_DISCOVERY
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_path_mtu_periodic_update                     PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called once a second by the IP helper thread to age*/
+/*    the path MTU cache. An expired entry is removed, so the interface   */
+/*    MTU is tried again for its destination, as recommended by RFC 1191. */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_thread_entry                   IP helper thread              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_ip_path_mtu_periodic_update(NX_IP *ip_ptr)
+{
+
+UINT            i;
+UINT            expired;
+NX_IP_PATH_MTU *entry_ptr;
+
+
+    /* Loop through the path MTU cache.  */
+    expired =  NX_FALSE;
+    for (i = 0; i < NX_IP_PATH_MTU_CACHE_SIZE; i++)
+    {
+
+        /* Pickup the entry.  */
+        entry_ptr =  &(ip_ptr -> nx_ip_path_mtu_cache[i]);
+
+        /* Skip unused entries.  */
+        if (entry_ptr -> nx_ip_path_mtu_timeout == 0)
+        {
+            continue;
+        }
+
+        /* Decrement the timeout and check for expiration.  */
+        entry_ptr -> nx_ip_path_mtu_timeout--;
+        if (entry_ptr -> nx_ip_path_mtu_timeout == 0)
+        {
+            expired =  NX_TRUE;
+        }
+    }
+
+    /* Determine if any entry expired.  */
+    if (expired)
+    {
+
+        /* Yes, advance the generation so sockets raise their MSS again.  */
+        ip_ptr -> nx_ip_path_mtu_generation++;
+        NX_IP_DESTINATION_CACHE_INVALIDATE(ip_ptr);
+    }
+}
+#endif /* NX_ENABLE_IP_PATH_MTU_DISCOVERY */
+
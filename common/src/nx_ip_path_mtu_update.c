@@ -0,0 +1,183 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+#ifdef NX_ENABLE_IP_PATH_MTU_DISCOVERY
+/* Define the MTU plateaus of RFC 1191, section 7, used when a router does not report its next
+   hop MTU.  */
+static const ULONG _nx_ip_path_mtu_plateaus[] =
+{
+    32000, 17914, 8166, 4352, 2002, 1492, 1006, 508, 296, 68
+};
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_path_mtu_update                              PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function records the path MTU reported for a destination by an */
+/*    ICMP fragmentation needed message, as described in RFC 1191. If the */
+/*    router did not report its next hop MTU, the path MTU is estimated   */
+/*    from the plateau below the length of the packet that was too big.   */
+/*    Reports that would not lower the path MTU are ignored. When the     */
+/*    cache is full, the entry closest to expiring is replaced.           */
+/*                                                                        */
+/*    The path MTU cache generation is advanced so connected TCP sockets  */
+/*    recompute their MSS.                                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    destination_address                   Destination IP address        */
+/*    path_mtu                              Reported next hop MTU, or zero*/
+/*    packet_length                         Total length of the packet    */
+/*                                            that was too big            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Obtain protection mutex       */
+/*    tx_mutex_put                          Release protection mutex      */
+/*    _nx_ip_route_find                     Find outgoing interface       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_icmp_packet_process               Process ICMP packet           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_ip_path_mtu_update(NX_IP *ip_ptr, ULONG destination_address, ULONG path_mtu, ULONG packet_length)
+{
+
+UINT            i;
+NX_IP_PATH_MTU *entry_ptr;
+NX_IP_PATH_MTU *replace_ptr;
+NX_INTERFACE   *interface_ptr;
+ULONG           next_hop_address;
+
+
+    /* Determine if the router reported its next hop MTU.  */
+    if (path_mtu == 0)
+    {
+
+        /* No, use the largest plateau below the length of the packet that was too big.  */
+        for (i = 0; i < (sizeof(_nx_ip_path_mtu_plateaus) / sizeof(ULONG)) - 1; i++)
+        {
+            if (_nx_ip_path_mtu_plateaus[i] < packet_length)
+            {
+                break;
+            }
+        }
+        path_mtu =  _nx_ip_path_mtu_plateaus[i];
+    }
+
+    /* Do not accept a path MTU below the minimum.  */
+    if (path_mtu < NX_IP_PATH_MTU_MINIMUM)
+    {
+        path_mtu =  NX_IP_PATH_MTU_MINIMUM;
+    }
+
+    /* Obtain the IP internal mutex.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Find the interface used to reach the destination.  */
+    interface_ptr =  NX_NULL;
+    if ((_nx_ip_route_find(ip_ptr, destination_address, &interface_ptr, &next_hop_address) != NX_SUCCESS) ||
+        (path_mtu >= interface_ptr -> nx_interface_ip_mtu_size))
+    {
+
+        /* No route, or the report does not lower the MTU of the interface.  */
+        tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+        return;
+    }
+
+    /* Look for the destination in the cache, remembering the entry closest to expiring
+       in case it is not there.  Unused entries have a timeout of zero.  */
+    replace_ptr =  &(ip_ptr -> nx_ip_path_mtu_cache[0]);
+    for (i = 0; i < NX_IP_PATH_MTU_CACHE_SIZE; i++)
+    {
+
+        /* Pickup the entry.  */
+        entry_ptr =  &(ip_ptr -> nx_ip_path_mtu_cache[i]);
+
+        /* Determine if this entry is for the destination.  */
+        if ((entry_ptr -> nx_ip_path_mtu_timeout) &&
+            (entry_ptr -> nx_ip_path_mtu_address == destination_address))
+        {
+
+            /* Yes, a learned path MTU is only ever lowered.  */
+            if (entry_ptr -> nx_ip_path_mtu_size <= path_mtu)
+            {
+                tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+                return;
+            }
+
+            /* Update this entry.  */
+            replace_ptr =  entry_ptr;
+            break;
+        }
+
+        /* Determine if this entry expires before the current candidate.  */
+        if (entry_ptr -> nx_ip_path_mtu_timeout < replace_ptr -> nx_ip_path_mtu_timeout)
+        {
+            replace_ptr =  entry_ptr;
+        }
+    }
+
+    /* Record the path MTU.  */
+    replace_ptr -> nx_ip_path_mtu_address =  destination_address;
+    replace_ptr -> nx_ip_path_mtu_size =     path_mtu;
+    replace_ptr -> nx_ip_path_mtu_timeout =  NX_IP_PATH_MTU_TIMEOUT;
+
+    /* Advance the generation so sockets pick up the new path MTU.  */
+    ip_ptr -> nx_ip_path_mtu_generation++;
+    NX_IP_DESTINATION_CACHE_INVALIDATE(ip_ptr);
+
+    /* Release the IP internal mutex.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+}
+#endif /* NX_ENABLE_IP_PATH_MTU_DISCOVERY */
+
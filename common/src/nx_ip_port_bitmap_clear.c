@@ -0,0 +1,95 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+#ifdef NX_ENABLE_EPHEMERAL_PORT_BITMAP
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_port_bitmap_clear                            PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function marks a port as free in the ephemeral port bitmap.    */
+/*    Ports outside the range covered by the bitmap are ignored.          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    bitmap_ptr                            Pointer to port bitmap        */
+/*    port                                  Port no longer in use         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_port_bitmap_release           Release TCP port in bitmap    */
+/*    _nx_udp_port_bitmap_release           Release UDP port in bitmap    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_ip_port_bitmap_clear(NX_PORT_BITMAP *bitmap_ptr, UINT port)
+{
+
+ULONG offset;
+ULONG word;
+
+
+    /* Determine if the port is covered by the bitmap.  */
+    if (port < NX_SEARCH_PORT_START)
+    {
+        return;
+    }
+
+    /* Compute the position of the port in the bitmap.  */
+    offset =  (ULONG)port - NX_SEARCH_PORT_START;
+    word =    offset >> 5;
+
+    /* Mark the port as free, and its word as no longer full.  */
+    bitmap_ptr -> nx_port_bitmap_used[word] &=  ~(((ULONG)1) << (offset & 31));
+    bitmap_ptr -> nx_port_bitmap_full[word >> 5] &=  ~(((ULONG)1) << (word & 31));
+}
+#endif /* NX_ENABLE_EPHEMERAL_PORT_BITMAP */
+
@@ -0,0 +1,167 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+#ifdef NX_ENABLE_EPHEMERAL_PORT_BITMAP
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_port_bitmap_find                             PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function finds the first free port in the ephemeral port bitmap*/
+/*    at or after the specified port, wrapping from NX_MAX_PORT back to   */
+/*    NX_SEARCH_PORT_START.  Groups of 32 fully used words are skipped    */
+/*    with a single test of the full array, so the cost does not depend on*/
+/*    the number of bound sockets.  The port must be within the range     */
+/*    covered by the bitmap.                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    bitmap_ptr                            Pointer to port bitmap        */
+/*    port                                  Starting port                 */
+/*    free_port_ptr                         Pointer to return free port   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_free_port_find                Find free TCP port            */
+/*    _nx_udp_free_port_find                Find free UDP port            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_ip_port_bitmap_find(NX_PORT_BITMAP *bitmap_ptr, UINT port, UINT *free_port_ptr)
+{
+
+ULONG offset;
+ULONG word;
+ULONG bit;
+ULONG free_bits;
+ULONG checked;
+
+
+    /* Compute the position of the starting port in the bitmap.  */
+    offset =  (ULONG)port - NX_SEARCH_PORT_START;
+    word =    offset >> 5;
+    bit =     offset & 31;
+
+    /* Pickup the free ports of the starting word at or after the starting port.  */
+    free_bits =  (~(bitmap_ptr -> nx_port_bitmap_used[word])) & (((ULONG)0xFFFFFFFF) << bit);
+
+    /* Ports of the last word beyond NX_MAX_PORT are never free.  */
+    if (word == (NX_PORT_BITMAP_WORDS - 1))
+    {
+        free_bits =  free_bits & NX_PORT_BITMAP_LAST_MASK;
+    }
+
+    /* Loop through the remaining words, ending with the starting word itself.  Any free
+       port found in the starting word at that point lies before the starting port.  */
+    checked =  0;
+    while (free_bits == 0)
+    {
+
+        /* Determine if every word has been checked.  */
+        if (checked == NX_PORT_BITMAP_WORDS)
+        {
+
+            /* No free port in the bitmap.  */
+            return(NX_NO_FREE_PORTS);
+        }
+
+        /* Move to the next word.  */
+        word++;
+        checked++;
+        if (word == NX_PORT_BITMAP_WORDS)
+        {
+            word =  0;
+        }
+
+        /* Skip a whole group of used words at once.  */
+        while ((!(word & 31)) && (bitmap_ptr -> nx_port_bitmap_full[word >> 5] == ((ULONG)0xFFFFFFFF)) &&
+               ((checked + 32) <= NX_PORT_BITMAP_WORDS))
+        {
+
+            word =  word + 32;
+            checked =  checked + 32;
+            if (word >= NX_PORT_BITMAP_WORDS)
+            {
+                word =  0;
+            }
+        }
+
+        /* Determine if this word has a free port.  */
+        if (!(bitmap_ptr -> nx_port_bitmap_full[word >> 5] & (((ULONG)1) << (word & 31))))
+        {
+
+            /* Yes, pickup its free ports.  */
+            free_bits =  ~(bitmap_ptr -> nx_port_bitmap_used[word]);
+
+            /* Ports of the last word beyond NX_MAX_PORT are never free.  */
+            if (word == (NX_PORT_BITMAP_WORDS - 1))
+            {
+                free_bits =  free_bits & NX_PORT_BITMAP_LAST_MASK;
+            }
+        }
+    }
+
+    /* Find the lowest free port in the word.  */
+    bit =  0;
+    while (!(free_bits & 1))
+    {
+        free_bits =  free_bits >> 1;
+        bit++;
+    }
+
+    /* Return the free port.  */
+    *free_port_ptr =  (UINT)((word << 5) + bit + NX_SEARCH_PORT_START);
+
+    /* Return success.  */
+    return(NX_SUCCESS);
+}
+#endif /* NX_ENABLE_EPHEMERAL_PORT_BITMAP */
+
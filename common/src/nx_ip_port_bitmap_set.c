@@ -0,0 +1,113 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+#ifdef NX_ENABLE_EPHEMERAL_PORT_BITMAP
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_port_bitmap_set                              PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function marks a port as in use in the ephemeral port bitmap,  */
+/*    and marks its word as full once every port of the word is in use.   */
+/*    Ports outside the range covered by the bitmap are ignored.          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    bitmap_ptr                            Pointer to port bitmap        */
+/*    port                                  Port now in use               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_client_socket_bind            Bind TCP client socket        */
+/*    _nx_tcp_packet_process                Process incoming TCP packet   */
+/*    _nx_tcp_server_socket_relisten        Relisten on TCP server socket */
+/*    _nx_udp_socket_bind                   Bind UDP socket               */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_ip_port_bitmap_set(NX_PORT_BITMAP *bitmap_ptr, UINT port)
+{
+
+ULONG offset;
+ULONG word;
+ULONG used_mask;
+
+
+    /* Determine if the port is covered by the bitmap.  */
+    if (port < NX_SEARCH_PORT_START)
+    {
+        return;
+    }
+
+    /* Compute the position of the port in the bitmap.  */
+    offset =  (ULONG)port - NX_SEARCH_PORT_START;
+    word =    offset >> 5;
+
+    /* Mark the port as in use.  */
+    bitmap_ptr -> nx_port_bitmap_used[word] |=  ((ULONG)1) << (offset & 31);
+
+    /* Pickup the mask of the ports of this word that are inside the range.  */
+    used_mask =  ((ULONG)0xFFFFFFFF);
+    if (word == (NX_PORT_BITMAP_WORDS - 1))
+    {
+        used_mask =  NX_PORT_BITMAP_LAST_MASK;
+    }
+
+    /* Determine if every port of the word is in use now.  */
+    if ((bitmap_ptr -> nx_port_bitmap_used[word] & used_mask) == used_mask)
+    {
+
+        /* Yes, mark the word as full.  */
+        bitmap_ptr -> nx_port_bitmap_full[word >> 5] |=  ((ULONG)1) << (word & 31);
+    }
+}
+#endif /* NX_ENABLE_EPHEMERAL_PORT_BITMAP */
+
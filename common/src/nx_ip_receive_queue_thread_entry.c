@@ -0,0 +1,149 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+#include "nx_packet.h"
+
+
+#ifdef NX_ENABLE_IP_RECEIVE_QUEUES
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_receive_queue_thread_entry                   PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is the entry of an IP receive thread.  It waits for   */
+/*    packets to be placed on its receive queue and passes them, in order,*/
+/*    to the IP receive processing under the IP protection mutex, as the  */
+/*    IP helper thread does.  As with drivers that call                   */
+/*    _nx_ip_packet_receive directly, TCP, ICMP and IGMP processing is    */
+/*    handed over to the IP helper thread.                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr_value                       Pointer to IP receive queue   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Obtain protection mutex       */
+/*    tx_mutex_put                          Release protection mutex      */
+/*    tx_semaphore_get                      Wait for queued packets       */
+/*    _nx_ip_packet_receive                 IP receive packet processing  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ThreadX                                                             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_ip_receive_queue_thread_entry(ULONG queue_ptr_value)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+NX_IP_RECEIVE_QUEUE *queue_ptr;
+NX_IP               *ip_ptr;
+NX_PACKET           *packet_ptr;
+
+
+    /* Setup the receive queue and IP pointers.  */
+    queue_ptr =  (NX_IP_RECEIVE_QUEUE *)queue_ptr_value;
+    ip_ptr =     queue_ptr -> nx_ip_receive_queue_ip;
+
+    /* Loop to process packets placed on this queue.  */
+    while (1)
+    {
+
+        /* Wait until the queue becomes non-empty.  */
+        tx_semaphore_get(&(queue_ptr -> nx_ip_receive_queue_semaphore), TX_WAIT_FOREVER);
+
+        /* Loop to process all queued packets.  */
+        while (queue_ptr -> nx_ip_receive_queue_head)
+        {
+
+            /* Obtain the IP mutex before taking the packet.  The IP receive processing
+               reads state shared with application threads, such as the packet filter
+               rules, and the IP helper thread also holds the mutex while it runs it.
+               Since packets are only removed with the mutex held, nx_ip_delete finds
+               every packet not yet processed on the queue.  */
+            tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+            /* Disable interrupts.  */
+            TX_DISABLE
+
+            /* Remove the first packet.  */
+            packet_ptr =  queue_ptr -> nx_ip_receive_queue_head;
+            if (packet_ptr == NX_NULL)
+            {
+
+                /* The queue was emptied meanwhile.  */
+                TX_RESTORE
+                tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+                break;
+            }
+            queue_ptr -> nx_ip_receive_queue_head =  packet_ptr -> nx_packet_queue_next;
+
+            /* Check for end of the queue.  */
+            if (queue_ptr -> nx_ip_receive_queue_head == NX_NULL)
+            {
+
+                /* Yes, the queue is empty.  Set the tail pointer to NULL.  */
+                queue_ptr -> nx_ip_receive_queue_tail =  NX_NULL;
+            }
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Increment the number of packets processed by this queue.  */
+            queue_ptr -> nx_ip_receive_queue_packets++;
+
+            /* Call the actual IP packet receive function.  */
+            _nx_ip_packet_receive(ip_ptr, packet_ptr);
+
+            /* Release the IP mutex.  */
+            tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+        }
+    }
+}
+#endif /* NX_ENABLE_IP_RECEIVE_QUEUES */
+
@@ -0,0 +1,191 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_receive_queues_create                        PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates the receive queues of an IP instance and one  */
+/*    receive thread for each of them.  The supplied stack area is divided*/
+/*    evenly among the threads.  Once created, deferred IP packets are    */
+/*    steered onto the queues by their flow hash instead of being         */
+/*    processed by the IP helper thread.                                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP control block   */
+/*    stack_ptr                             Pointer to stack area for the */
+/*                                            receive threads             */
+/*    stack_size                            Size of the stack area        */
+/*    priority                              Priority of the receive       */
+/*                                            threads                     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Obtain protection mutex       */
+/*    tx_mutex_put                          Release protection mutex      */
+/*    tx_semaphore_create                   Create queue semaphore        */
+/*    tx_semaphore_delete                   Delete queue semaphore        */
+/*    tx_thread_create                      Create receive thread         */
+/*    tx_thread_terminate                   Terminate receive thread      */
+/*    tx_thread_delete                      Delete receive thread         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_ip_receive_queues_create(NX_IP *ip_ptr, VOID *stack_ptr, ULONG stack_size, UINT priority)
+{
+#ifdef NX_ENABLE_IP_RECEIVE_QUEUES
+
+TX_INTERRUPT_SAVE_AREA
+
+NX_IP_RECEIVE_QUEUE *queue_ptr;
+ULONG                thread_stack_size;
+UINT                 i;
+
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_IP_RECEIVE_QUEUES_CREATE, ip_ptr, NX_IP_RECEIVE_QUEUES, stack_size, priority, NX_TRACE_IP_EVENTS, 0, 0)
+
+    /* Obtain the IP internal mutex.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Determine if the receive queues already exist.  */
+    if (ip_ptr -> nx_ip_receive_queues_active)
+    {
+
+        /* Release the mutex.  */
+        tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+        /* Return an already enabled error.  */
+        return(NX_ALREADY_ENABLED);
+    }
+
+    /* Divide the stack area evenly, keeping each stack ULONG aligned.  */
+    thread_stack_size =  (stack_size / NX_IP_RECEIVE_QUEUES) & ~((ULONG)(sizeof(ULONG) - 1));
+
+    /* Loop to create each receive queue.  */
+    for (i = 0; i < NX_IP_RECEIVE_QUEUES; i++)
+    {
+
+        /* Setup the receive queue.  */
+        queue_ptr =  &(ip_ptr -> nx_ip_receive_queues[i]);
+        queue_ptr -> nx_ip_receive_queue_ip =       ip_ptr;
+        queue_ptr -> nx_ip_receive_queue_head =     NX_NULL;
+        queue_ptr -> nx_ip_receive_queue_tail =     NX_NULL;
+        queue_ptr -> nx_ip_receive_queue_packets =  0;
+
+        /* Create the semaphore that wakes up the receive thread.  */
+        if (tx_semaphore_create(&(queue_ptr -> nx_ip_receive_queue_semaphore), ip_ptr -> nx_ip_name, 0))
+        {
+            break;
+        }
+
+        /* Create the receive thread of this queue.  */
+        if (tx_thread_create(&(queue_ptr -> nx_ip_receive_queue_thread), ip_ptr -> nx_ip_name,
+                             _nx_ip_receive_queue_thread_entry, (ULONG)queue_ptr,
+                             ((UCHAR *)stack_ptr) + (i * thread_stack_size), thread_stack_size,
+                             priority, priority, 1, TX_AUTO_START))
+        {
+
+            /* Delete the semaphore of this queue.  */
+            tx_semaphore_delete(&(queue_ptr -> nx_ip_receive_queue_semaphore));
+            break;
+        }
+    }
+
+    /* Determine if every receive queue was created.  */
+    if (i < NX_IP_RECEIVE_QUEUES)
+    {
+
+        /* No, delete the queues created so far.  */
+        while (i--)
+        {
+
+            /* Delete the receive thread and semaphore of this queue.  */
+            queue_ptr =  &(ip_ptr -> nx_ip_receive_queues[i]);
+            tx_thread_terminate(&(queue_ptr -> nx_ip_receive_queue_thread));
+            tx_thread_delete(&(queue_ptr -> nx_ip_receive_queue_thread));
+            tx_semaphore_delete(&(queue_ptr -> nx_ip_receive_queue_semaphore));
+        }
+
+        /* Release the mutex.  */
+        tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+        /* Return an error.  */
+        return(NX_IP_INTERNAL_ERROR);
+    }
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Start steering deferred packets onto the receive queues.  */
+    ip_ptr -> nx_ip_receive_queues_active =  NX_IP_RECEIVE_QUEUES;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Release the mutex.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Return success.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_IP_RECEIVE_QUEUES */
+    NX_PARAMETER_NOT_USED(ip_ptr);
+    NX_PARAMETER_NOT_USED(stack_ptr);
+    NX_PARAMETER_NOT_USED(stack_size);
+    NX_PARAMETER_NOT_USED(priority);
+
+    return(NX_NOT_SUPPORTED);
+#endif /* NX_ENABLE_IP_RECEIVE_QUEUES */
+}
+
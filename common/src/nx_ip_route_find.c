@@ -93,6 +93,13 @@ ULONG  _nx_ip_route_find(NX_IP *ip_ptr, ULONG destination_address, NX_INTERFACE
 
 NX_INTERFACE *nx_interface;
 ULONG         i;
+#ifdef NX_ENABLE_IP_STATIC_ROUTE_TRIE
+NX_IP_ROUTING_TRIE_NODE
+             *node_ptr;
+ULONG         shift;
+ULONG         slot;
+UINT          route;
+#endif /* NX_ENABLE_IP_STATIC_ROUTE_TRIE */
 
     /* Determine whether or not destination_address is multicast or directed broadcast. */
     if (((destination_address & NX_IP_CLASS_D_MASK) == NX_IP_CLASS_D_TYPE) ||
@@ -113,6 +120,46 @@ ULONG         i;
 
 #ifdef NX_ENABLE_IP_STATIC_ROUTING
 
+#ifdef NX_ENABLE_IP_STATIC_ROUTE_TRIE
+
+    /* Walk down the routing trie, remembering the longest matching prefix.  */
+    route =     0;
+    node_ptr =  &(ip_ptr -> nx_ip_routing_trie[0]);
+    shift =     32 - NX_IP_ROUTING_TRIE_STRIDE;
+    while (ip_ptr -> nx_ip_routing_table_entry_count)
+    {
+
+        /* Pickup the slot of the destination at this level.  */
+        slot =  (destination_address >> shift) & (NX_IP_ROUTING_TRIE_FANOUT - 1);
+
+        /* Determine if a prefix ends in this slot.  */
+        if (node_ptr -> nx_ip_routing_trie_node_route[slot])
+        {
+
+            /* Yes, it is longer than any found so far.  */
+            route =  node_ptr -> nx_ip_routing_trie_node_route[slot];
+        }
+
+        /* Determine if there are longer prefixes below this slot.  */
+        if (node_ptr -> nx_ip_routing_trie_node_child[slot] == 0)
+        {
+            break;
+        }
+
+        /* Move to the child node.  */
+        node_ptr =  &(ip_ptr -> nx_ip_routing_trie[node_ptr -> nx_ip_routing_trie_node_child[slot]]);
+        shift =     shift - NX_IP_ROUTING_TRIE_STRIDE;
+    }
+
+    /* Determine if a route was found.  */
+    if (route)
+    {
+        *nx_ip_interface = ip_ptr -> nx_ip_routing_table[route - 1].nx_ip_routing_entry_ip_interface;
+        *next_hop_address = ip_ptr -> nx_ip_routing_table[route - 1].nx_ip_routing_entry_next_hop_address;
+
+        return(NX_SUCCESS);
+    }
+#else
 
     /* Search through the routing table, check whether the entry exists or not. */
     for (i = 0; i < ip_ptr -> nx_ip_routing_table_entry_count; i++)
@@ -125,6 +172,7 @@ ULONG         i;
             return(NX_SUCCESS);
         }
     }
+#endif /* NX_ENABLE_IP_STATIC_ROUTE_TRIE */
 
 #endif /* NX_ENABLE_IP_STATIC_ROUTING */
 
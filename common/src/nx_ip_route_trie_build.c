@@ -0,0 +1,164 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+#ifdef NX_ENABLE_IP_STATIC_ROUTE_TRIE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_route_trie_build                             PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function rebuilds the longest prefix match trie from the static*/
+/*    routing table.  Routes are inserted from the shortest prefix to the */
+/*    longest, so the slots a longer prefix covers replace those of the   */
+/*    shorter prefixes it is contained in.  A lookup then keeps the last  */
+/*    route found while descending the trie.\n\nThe trie is rebuilt       */
+/*    whenever the routing table changes, which keeps route add and delete*/
+/*    simple.  The caller must hold the IP protection mutex.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*    NX_OVERFLOW                           Not enough trie nodes         */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_static_route_add               Add static routing entry      */
+/*    _nx_ip_static_route_delete            Delete static routing entry   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_ip_route_trie_build(NX_IP *ip_ptr)
+{
+
+NX_IP_ROUTING_TRIE_NODE *node_ptr;
+NX_IP_ROUTING_ENTRY     *route_ptr;
+ULONG                    network;
+ULONG                    mask;
+ULONG                    shift;
+ULONG                    slot;
+ULONG                    slots;
+UINT                     prefix_length;
+UINT                     child;
+UINT                     i;
+
+
+    /* Clear the root node.  */
+    memset(&(ip_ptr -> nx_ip_routing_trie[0]), 0, sizeof(NX_IP_ROUTING_TRIE_NODE));
+    ip_ptr -> nx_ip_routing_trie_node_count =  1;
+
+    /* The routing table is sorted from the longest prefix to the shortest, so walk it
+       backward.  */
+    i =  (UINT)ip_ptr -> nx_ip_routing_table_entry_count;
+    while (i)
+    {
+
+        /* Pickup the route.  */
+        i--;
+        route_ptr =  &(ip_ptr -> nx_ip_routing_table[i]);
+        network =    route_ptr -> nx_ip_routing_entry_destination_ip;
+        mask =       route_ptr -> nx_ip_routing_entry_net_mask;
+
+        /* Compute the prefix length.  */
+        prefix_length =  0;
+        while (mask & 0x80000000)
+        {
+            mask =  mask << 1;
+            prefix_length++;
+        }
+
+        /* Walk down the trie, creating nodes, until the prefix ends within the node.  */
+        node_ptr =  &(ip_ptr -> nx_ip_routing_trie[0]);
+        shift =     32 - NX_IP_ROUTING_TRIE_STRIDE;
+        while (prefix_length > NX_IP_ROUTING_TRIE_STRIDE)
+        {
+
+            /* Pickup the slot of the network at this level.  */
+            slot =   (network >> shift) & (NX_IP_ROUTING_TRIE_FANOUT - 1);
+            child =  node_ptr -> nx_ip_routing_trie_node_child[slot];
+
+            /* Determine if the child node must be created.  */
+            if (child == 0)
+            {
+
+                /* Check for available trie nodes.  */
+                if (ip_ptr -> nx_ip_routing_trie_node_count == NX_IP_ROUTING_TRIE_NODES)
+                {
+
+                    /* The trie is full.  */
+                    return(NX_OVERFLOW);
+                }
+
+                /* Allocate and clear the next node.  */
+                child =  (UINT)ip_ptr -> nx_ip_routing_trie_node_count++;
+                memset(&(ip_ptr -> nx_ip_routing_trie[child]), 0, sizeof(NX_IP_ROUTING_TRIE_NODE));
+                node_ptr -> nx_ip_routing_trie_node_child[slot] =  (USHORT)child;
+            }
+
+            /* Move to the child node.  */
+            node_ptr =       &(ip_ptr -> nx_ip_routing_trie[child]);
+            shift =          shift - NX_IP_ROUTING_TRIE_STRIDE;
+            prefix_length =  prefix_length - NX_IP_ROUTING_TRIE_STRIDE;
+        }
+
+        /* Expand the prefix to every slot it covers in this node.  */
+        slots =  ((ULONG)1) << (NX_IP_ROUTING_TRIE_STRIDE - prefix_length);
+        slot =   ((network >> shift) & (NX_IP_ROUTING_TRIE_FANOUT - 1)) & ~(slots - 1);
+        while (slots--)
+        {
+            node_ptr -> nx_ip_routing_trie_node_route[slot++] =  (USHORT)(i + 1);
+        }
+    }
+
+    /* Return success to the caller.  */
+    return(NX_SUCCESS);
+}
+#endif /* NX_ENABLE_IP_STATIC_ROUTE_TRIE */
+
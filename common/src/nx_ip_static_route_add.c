@@ -64,6 +64,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_ip_route_trie_build               Rebuild static routing trie   */
 /*    tx_mutex_get                                                        */
 /*    tx_mutex_put                                                        */
 /*                                                                        */
@@ -90,8 +91,20 @@ UINT  _nx_ip_static_route_add(NX_IP *ip_ptr, ULONG network_address,
 
 ULONG         i;
 NX_INTERFACE *nx_ip_interface = NX_NULL;
+#ifdef NX_ENABLE_IP_STATIC_ROUTE_TRIE
+ULONG         j;
+#endif /* NX_ENABLE_IP_STATIC_ROUTE_TRIE */
 
 
+#ifdef NX_ENABLE_IP_STATIC_ROUTE_TRIE
+
+    /* The routing trie only holds contiguous network masks.  */
+    if ((~net_mask) & ((~net_mask) + 1))
+    {
+        return(NX_IP_ADDRESS_ERROR);
+    }
+#endif /* NX_ENABLE_IP_STATIC_ROUTE_TRIE */
+
     /* Obtain the IP mutex so we can manipulate the internal routing table. */
     /* This routine does not need to be protected by mask off interrupt
        because it cannot be invoked from ISR. */
@@ -139,6 +152,9 @@ NX_INTERFACE *nx_ip_interface = NX_NULL;
             /* Update the interface. */
             ip_ptr -> nx_ip_routing_table[i].nx_ip_routing_entry_ip_interface = nx_ip_interface;
 
+            /* Invalidate the routes held in destination caches.  */
+            NX_IP_DESTINATION_CACHE_INVALIDATE(ip_ptr);
+
             /* All done.  Unlock the mutex, and return */
             tx_mutex_put(&(ip_ptr -> nx_ip_protection));
 
@@ -202,6 +218,30 @@ NX_INTERFACE *nx_ip_interface = NX_NULL;
 
     ip_ptr -> nx_ip_routing_table_entry_count++;
 
+    /* Invalidate the routes held in destination caches.  */
+    NX_IP_DESTINATION_CACHE_INVALIDATE(ip_ptr);
+
+#ifdef NX_ENABLE_IP_STATIC_ROUTE_TRIE
+
+    /* Rebuild the routing trie.  */
+    if (_nx_ip_route_trie_build(ip_ptr) != NX_SUCCESS)
+    {
+
+        /* Out of trie nodes, remove the new entry from the table.  */
+        ip_ptr -> nx_ip_routing_table_entry_count--;
+        for (j = i; j < ip_ptr -> nx_ip_routing_table_entry_count; j++)
+        {
+            ip_ptr -> nx_ip_routing_table[j] =  ip_ptr -> nx_ip_routing_table[j + 1];
+        }
+
+        /* Restore the trie of the previous table, which is known to fit.  */
+        _nx_ip_route_trie_build(ip_ptr);
+
+        tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+        return(NX_OVERFLOW);
+    }
+#endif /* NX_ENABLE_IP_STATIC_ROUTE_TRIE */
+
     /* Unlock the mutex. */
     tx_mutex_put(&(ip_ptr -> nx_ip_protection));
 
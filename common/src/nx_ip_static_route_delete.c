@@ -62,6 +62,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_ip_route_trie_build               Rebuild static routing trie   */
 /*    tx_mutex_get                                                        */
 /*    tx_mutex_put                                                        */
 /*                                                                        */
@@ -124,16 +125,18 @@ UINT  status         = NX_NOT_SUCCESSFUL;
 
             /* If the entry is not the last one, we need to shift to the
                reset of the table to fill the hole. */
-            for (j = i; j < ip_ptr -> nx_ip_routing_table_entry_count; j++)
+            for (j = i; j < (ip_ptr -> nx_ip_routing_table_entry_count - 1); j++)
             {
 
                 ip_ptr -> nx_ip_routing_table[j].nx_ip_routing_entry_destination_ip = ip_ptr -> nx_ip_routing_table[j + 1].nx_ip_routing_entry_destination_ip;
                 ip_ptr -> nx_ip_routing_table[j].nx_ip_routing_entry_net_mask = ip_ptr -> nx_ip_routing_table[j + 1].nx_ip_routing_entry_net_mask;
                 ip_ptr -> nx_ip_routing_table[j].nx_ip_routing_entry_next_hop_address = ip_ptr -> nx_ip_routing_table[j + 1].nx_ip_routing_entry_next_hop_address;
+                ip_ptr -> nx_ip_routing_table[j].nx_ip_routing_entry_ip_interface = ip_ptr -> nx_ip_routing_table[j + 1].nx_ip_routing_entry_ip_interface;
             }
-            ip_ptr -> nx_ip_routing_table[j - 1].nx_ip_routing_entry_destination_ip = 0;
-            ip_ptr -> nx_ip_routing_table[j - 1].nx_ip_routing_entry_net_mask = 0;
-            ip_ptr -> nx_ip_routing_table[j - 1].nx_ip_routing_entry_next_hop_address = 0;
+            ip_ptr -> nx_ip_routing_table[j].nx_ip_routing_entry_destination_ip = 0;
+            ip_ptr -> nx_ip_routing_table[j].nx_ip_routing_entry_net_mask = 0;
+            ip_ptr -> nx_ip_routing_table[j].nx_ip_routing_entry_next_hop_address = 0;
+            ip_ptr -> nx_ip_routing_table[j].nx_ip_routing_entry_ip_interface = NX_NULL;
 
             break;
         }
@@ -146,6 +149,15 @@ UINT  status         = NX_NOT_SUCCESSFUL;
 
         ip_ptr -> nx_ip_routing_table_entry_count--;
 
+        /* Invalidate the routes held in destination caches.  */
+        NX_IP_DESTINATION_CACHE_INVALIDATE(ip_ptr);
+
+#ifdef NX_ENABLE_IP_STATIC_ROUTE_TRIE
+
+        /* Rebuild the routing trie.  A smaller table always fits.  */
+        _nx_ip_route_trie_build(ip_ptr);
+#endif /* NX_ENABLE_IP_STATIC_ROUTE_TRIE */
+
         /* Indicate successful deletion. */
         status = NX_SUCCESS;
     }
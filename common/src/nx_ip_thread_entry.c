@@ -67,6 +67,8 @@
 /*    tx_event_flags_get                    Suspend on event flags that   */
 /*                                            are used to signal this     */
 /*                                            thread what to do           */
+/*    tx_event_flags_set                    Repost events left over when  */
+/*                                            a budget is spent           */
 /*    tx_mutex_get                          Obtain protection mutex       */
 /*    tx_mutex_put                          Release protection mutex      */
 /*    (nx_ip_driver_deferred_packet_handler)Optional deferred packet      */
@@ -82,8 +84,10 @@
 /*    (nx_ip_igmp_periodic_processing)      IGMP periodic processing      */
 /*    (nx_ip_tcp_queue_process)             TCP message queue processing  */
 /*    (nx_ip_tcp_periodic_processing)       TCP periodic processing       */
+/*    _nx_ip_path_mtu_periodic_update       Path MTU cache aging          */
 /*    (nx_tcp_deferred_cleanup_check)       TCP deferred cleanup check    */
 /*    (ip_link_driver)                      User supplied link driver     */
+/*    _nx_ip_transmit_burst_end             End transmit burst            */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -105,8 +109,13 @@ NX_IP_DRIVER driver_request;
 NX_IP       *ip_ptr;
 ULONG        ip_events;
 NX_PACKET   *packet_ptr;
+NX_PACKET   *next_packet_ptr;
 UINT         i;
 ULONG        foo;
+#ifdef NX_ENABLE_IP_EVENT_BUDGET
+UINT         budget;
+NX_PACKET   *last_packet_ptr;
+#endif /* NX_ENABLE_IP_EVENT_BUDGET */
 
 
     /* Setup IP pointer from the input value.  */
@@ -181,8 +190,14 @@ ULONG        foo;
         if (ip_events & NX_IP_DRIVER_PACKET_EVENT)
         {
 
+#ifdef NX_ENABLE_IP_EVENT_BUDGET
+            /* Loop to process deferred packet requests, up to the budget for this pass.  */
+            budget =  NX_IP_DRIVER_PACKET_BUDGET;
+            while ((ip_ptr -> nx_ip_driver_deferred_packet_head) && (budget))
+#else
             /* Loop to process all deferred packet requests.  */
             while (ip_ptr -> nx_ip_driver_deferred_packet_head)
+#endif /* NX_ENABLE_IP_EVENT_BUDGET */
             {
                 /* Remove the first packet and process it!  */
 
@@ -212,7 +227,22 @@ ULONG        foo;
                     /* Call the actual Deferred packet processing function.  */
                     (ip_ptr ->  nx_ip_driver_deferred_packet_handler)(ip_ptr, packet_ptr);
                 }
+#ifdef NX_ENABLE_IP_EVENT_BUDGET
+
+                /* Account for this packet.  */
+                budget--;
+#endif /* NX_ENABLE_IP_EVENT_BUDGET */
+            }
+#ifdef NX_ENABLE_IP_EVENT_BUDGET
+
+            /* Determine if the budget ran out with packets still queued.  */
+            if (ip_ptr -> nx_ip_driver_deferred_packet_head)
+            {
+
+                /* Yes, post the event again so the other pending events are serviced first.  */
+                tx_event_flags_set(&(ip_ptr -> nx_ip_events), NX_IP_DRIVER_PACKET_EVENT, TX_OR);
             }
+#endif /* NX_ENABLE_IP_EVENT_BUDGET */
 
             /* Determine if there is anything else to do in the loop.  */
             ip_events =  ip_events & ~(NX_IP_DRIVER_PACKET_EVENT);
@@ -227,35 +257,86 @@ ULONG        foo;
         if (ip_events & NX_IP_RECEIVE_EVENT)
         {
 
+            /* Hand the responses to this batch to the drivers as one burst.  */
+            NX_IP_TRANSMIT_BURST_START(ip_ptr);
+
+#ifdef NX_ENABLE_IP_EVENT_BUDGET
+            /* Loop to process deferred packet requests, up to the budget for this pass.  */
+            budget =  NX_IP_RECEIVE_BUDGET;
+            while ((ip_ptr -> nx_ip_deferred_received_packet_head) && (budget))
+#else
             /* Loop to process all deferred packet requests.  */
             while (ip_ptr -> nx_ip_deferred_received_packet_head)
+#endif /* NX_ENABLE_IP_EVENT_BUDGET */
             {
 
-                /* Remove the first packet and process it!  */
+                /* Remove all queued packets at once and process them as a batch.  */
 
                 /* Disable interrupts.  */
                 TX_DISABLE
 
-                /* Pickup the first packet.  */
+                /* Pickup the entire queue.  */
                 packet_ptr =  ip_ptr -> nx_ip_deferred_received_packet_head;
+#ifdef NX_ENABLE_IP_EVENT_BUDGET
+                last_packet_ptr =  ip_ptr -> nx_ip_deferred_received_packet_tail;
+#endif /* NX_ENABLE_IP_EVENT_BUDGET */
 
-                /* Move the head pointer to the next packet.  */
-                ip_ptr -> nx_ip_deferred_received_packet_head =  packet_ptr -> nx_packet_queue_next;
+                /* The queue is now empty.  */
+                ip_ptr -> nx_ip_deferred_received_packet_head =  NX_NULL;
+                ip_ptr -> nx_ip_deferred_received_packet_tail =  NX_NULL;
 
-                /* Check for end of deferred processing queue.  */
-                if (ip_ptr -> nx_ip_deferred_received_packet_head == NX_NULL)
-                {
+                /* Restore interrupts.  */
+                TX_RESTORE
 
-                    /* Yes, the queue is empty.  Set the tail pointer to NULL.  */
-                    ip_ptr -> nx_ip_deferred_received_packet_tail =  NX_NULL;
+                /* Loop to process the packets in the order they were received.  */
+                while (packet_ptr)
+                {
+#ifdef NX_ENABLE_IP_EVENT_BUDGET
+
+                    /* Determine if the budget for this pass is spent.  */
+                    if (budget == 0)
+                    {
+
+                        /* Yes, return the unprocessed packets to the front of the queue,
+                           ahead of anything received in the meantime.  */
+                        TX_DISABLE
+                        last_packet_ptr -> nx_packet_queue_next =  ip_ptr -> nx_ip_deferred_received_packet_head;
+                        if (ip_ptr -> nx_ip_deferred_received_packet_head == NX_NULL)
+                        {
+                            ip_ptr -> nx_ip_deferred_received_packet_tail =  last_packet_ptr;
+                        }
+                        ip_ptr -> nx_ip_deferred_received_packet_head =  packet_ptr;
+                        TX_RESTORE
+                        break;
+                    }
+
+                    /* Account for this packet.  */
+                    budget--;
+#endif /* NX_ENABLE_IP_EVENT_BUDGET */
+
+                    /* Pickup the next packet before the queue link is reused.  */
+                    next_packet_ptr =  packet_ptr -> nx_packet_queue_next;
+
+                    /* Call the actual IP packet receive function.  */
+                    _nx_ip_packet_receive(ip_ptr, packet_ptr);
+
+                    /* Move to the next packet.  */
+                    packet_ptr =  next_packet_ptr;
                 }
+            }
+#ifdef NX_ENABLE_IP_EVENT_BUDGET
 
-                /* Restore interrupts.  */
-                TX_RESTORE
+            /* Determine if the budget ran out with packets still queued.  */
+            if (ip_ptr -> nx_ip_deferred_received_packet_head)
+            {
 
-                /* Call the actual IP packet receive function.  */
-                _nx_ip_packet_receive(ip_ptr, packet_ptr);
+                /* Yes, post the event again so the other pending events are serviced first.  */
+                tx_event_flags_set(&(ip_ptr -> nx_ip_events), NX_IP_RECEIVE_EVENT, TX_OR);
             }
+#endif /* NX_ENABLE_IP_EVENT_BUDGET */
+
+            /* End the burst, flushing the drivers.  */
+            NX_IP_TRANSMIT_BURST_END(ip_ptr);
 
             /* Determine if there is anything else to do in the loop.  */
             ip_events =  ip_events & ~(NX_IP_RECEIVE_EVENT);
@@ -269,8 +350,10 @@ ULONG        foo;
         if (ip_events & NX_IP_TCP_EVENT)
         {
 
-            /* Process the TCP packet queue.  */
+            /* Process the TCP packet queue, sending the resulting segments as one burst.  */
+            NX_IP_TRANSMIT_BURST_START(ip_ptr);
             (ip_ptr -> nx_ip_tcp_queue_process)(ip_ptr);
+            NX_IP_TRANSMIT_BURST_END(ip_ptr);
 
             /* Determine if there is anything else to do in the loop.  */
             ip_events =  ip_events & ~(NX_IP_TCP_EVENT);
@@ -326,6 +409,11 @@ ULONG        foo;
                 (ip_ptr -> nx_ip_igmp_periodic_processing)(ip_ptr);
             }
 
+#ifdef NX_ENABLE_IP_PATH_MTU_DISCOVERY
+            /* Age the path MTU cache.  */
+            _nx_ip_path_mtu_periodic_update(ip_ptr);
+#endif /* NX_ENABLE_IP_PATH_MTU_DISCOVERY */
+
             /* Process TCP periodic events, if TCP has been enabled.  */
             if (ip_ptr -> nx_ip_tcp_periodic_processing)
             {
@@ -0,0 +1,115 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+#ifdef NX_ENABLE_DRIVER_TRANSMIT_MORE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ip_transmit_burst_end                           PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function ends a burst of transmissions.  When the outermost    */
+/*    burst ends, every link driver that may be holding packets sent with */
+/*    the transmit more hint is given an NX_LINK_PACKET_FLUSH request.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP control block   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    (nx_interface_link_driver_entry)      Link driver                   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_fragment_packet                Fragment an IP packet         */
+/*    _nx_ip_thread_entry                   IP helper thread              */
+/*    _nx_tcp_socket_retransmit             Retransmit TCP packets        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_ip_transmit_burst_end(NX_IP *ip_ptr)
+{
+
+NX_IP_DRIVER driver_request;
+UINT         i;
+
+
+    /* Determine if this ends the outermost burst.  */
+    if (--(ip_ptr -> nx_ip_transmit_burst))
+    {
+
+        /* No, the outermost burst will flush the drivers.  */
+        return;
+    }
+
+    /* Loop through the interfaces to find the drivers holding packets.  */
+    for (i = 0; i < NX_MAX_PHYSICAL_INTERFACES; i++)
+    {
+
+        /* Skip interfaces that have nothing pending.  */
+        if ((!ip_ptr -> nx_ip_interface[i].nx_interface_valid) ||
+            (!ip_ptr -> nx_ip_interface[i].nx_interface_transmit_pending))
+        {
+            continue;
+        }
+
+        /* Clear the pending flag.  */
+        ip_ptr -> nx_ip_interface[i].nx_interface_transmit_pending =  NX_FALSE;
+
+        /* Build the driver request.  */
+        driver_request.nx_ip_driver_ptr =            ip_ptr;
+        driver_request.nx_ip_driver_command =        NX_LINK_PACKET_FLUSH;
+        driver_request.nx_ip_driver_packet =         NX_NULL;
+        driver_request.nx_ip_driver_interface =      &(ip_ptr -> nx_ip_interface[i]);
+        driver_request.nx_ip_driver_transmit_more =  NX_FALSE;
+
+        /* Ask the driver to start transmitting the packets it is holding.  */
+        (ip_ptr -> nx_ip_interface[i].nx_interface_link_driver_entry)(&driver_request);
+    }
+}
+#endif /* NX_ENABLE_DRIVER_TRANSMIT_MORE */
+
@@ -125,6 +125,12 @@ ULONG                  trace_timestamp;
         work_ptr -> nx_packet_append_ptr       =  work_ptr -> nx_packet_prepend_ptr;
         work_ptr -> nx_packet_ip_interface     =  NX_NULL;
         work_ptr -> nx_packet_next_hop_address =  NX_NULL;
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+        work_ptr -> nx_packet_destination_cache = NX_NULL;
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
+#ifdef NX_ENABLE_IP_FRAGMENT_ZERO_COPY
+        work_ptr -> nx_packet_fragment_source = NX_NULL;
+#endif /* NX_ENABLE_IP_FRAGMENT_ZERO_COPY */
         /* Set the TCP queue to the value that indicates it has been allocated.  */
         work_ptr -> nx_packet_tcp_queue_next   =  (NX_PACKET *)NX_PACKET_ALLOCATED;
 
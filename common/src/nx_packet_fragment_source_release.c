@@ -0,0 +1,100 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+#ifdef NX_ENABLE_IP_FRAGMENT_ZERO_COPY
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_fragment_source_release                  PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function drops one reference to the payload of an original     */
+/*    packet that was sent in IP fragments. The original packet is        */
+/*    released for transmission once no fragment references its payload.  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    packet_ptr                            Original packet pointer       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_transmit_release           Release transmit packet       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ip_fragment_packet                Fragment IP packet            */
+/*    _nx_packet_release                    Release packet                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_packet_fragment_source_release(NX_PACKET *packet_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+ULONG references;
+
+
+    /* Disable interrupts, since fragments may be released by the driver from an ISR.  */
+    TX_DISABLE
+
+    /* Drop the reference.  */
+    packet_ptr -> nx_packet_fragment_references--;
+    references =  packet_ptr -> nx_packet_fragment_references;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Determine if this was the last reference to the payload.  */
+    if (references == 0)
+    {
+
+        /* Yes, the original packet has been sent out in fragments... release it!  */
+        _nx_packet_transmit_release(packet_ptr);
+    }
+}
+#endif /* NX_ENABLE_IP_FRAGMENT_ZERO_COPY */
+
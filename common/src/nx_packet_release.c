@@ -56,6 +56,7 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _tx_thread_system_resume              Resume suspended thread       */
+/*    _nx_packet_fragment_source_release    Release fragment payload      */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -76,6 +77,9 @@ TX_INTERRUPT_SAVE_AREA
 NX_PACKET_POOL *pool_ptr;               /* Pool pointer            */
 TX_THREAD      *thread_ptr;             /* Working thread pointer  */
 NX_PACKET      *next_packet;            /* Working block pointer   */
+#ifdef NX_ENABLE_IP_FRAGMENT_ZERO_COPY
+NX_PACKET      *source_packet;          /* Fragment source pointer */
+#endif /* NX_ENABLE_IP_FRAGMENT_ZERO_COPY */
 
 
     /* If trace is enabled, insert this event into the trace buffer.  */
@@ -111,6 +115,34 @@ NX_PACKET      *next_packet;            /* Working block pointer   */
         /* Pickup the next packet. */
         next_packet =  packet_ptr -> nx_packet_next;
 
+#ifdef NX_ENABLE_IP_FRAGMENT_ZERO_COPY
+
+        /* Determine if this packet is an IP fragment that references the payload of
+           its original packet.  */
+        if (packet_ptr -> nx_packet_fragment_source)
+        {
+
+            /* Yes, skip the references, which live at the end of this packet's buffer
+               past its data area.  */
+            while ((next_packet) &&
+                   ((UCHAR *)next_packet >= packet_ptr -> nx_packet_data_end) &&
+                   ((UCHAR *)next_packet < packet_ptr -> nx_packet_data_start +
+                    (packet_ptr -> nx_packet_pool_owner) -> nx_packet_pool_payload_size))
+            {
+                next_packet =  next_packet -> nx_packet_next;
+            }
+
+            /* Give the buffer its full data area back.  */
+            packet_ptr -> nx_packet_data_end =  packet_ptr -> nx_packet_data_start +
+                (packet_ptr -> nx_packet_pool_owner) -> nx_packet_pool_payload_size;
+
+            /* Drop the reference to the original packet.  */
+            source_packet =  packet_ptr -> nx_packet_fragment_source;
+            packet_ptr -> nx_packet_fragment_source =  NX_NULL;
+            _nx_packet_fragment_source_release(source_packet);
+        }
+#endif /* NX_ENABLE_IP_FRAGMENT_ZERO_COPY */
+
         /* Disable interrupts to put this packet back in the packet pool.  */
         TX_DISABLE
 
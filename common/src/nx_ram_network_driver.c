@@ -63,9 +63,58 @@ ULONG   simulated_address_lsw =  0x33445566;
 VOID _nx_ram_network_driver(NX_IP_DRIVER *driver_req_ptr);
 void _nx_ram_network_driver_output(NX_IP *ip_ptr, NX_PACKET *packet_ptr, UINT device_instance_id);
 void _nx_ram_network_driver_receive(NX_IP *ip_ptr, NX_PACKET *packet_ptr, UINT device_instance_id);
+#ifdef NX_ENABLE_DRIVER_TRANSMIT_MORE
+void _nx_ram_network_driver_doorbell(NX_IP *ip_ptr, UINT device_instance_id);
+#endif /* NX_ENABLE_DRIVER_TRANSMIT_MORE */
+#ifdef NX_ENABLE_RAM_DRIVER_RINGS
+void _nx_ram_network_driver_ring_post(NX_PACKET *packet_ptr, UINT source_id, UINT destination_id);
+void _nx_ram_network_driver_ring_drain(NX_IP *ip_ptr, UINT device_instance_id);
+void _nx_ram_network_driver_ring_flush(UINT device_instance_id);
+#endif /* NX_ENABLE_RAM_DRIVER_RINGS */
 
 #define NX_MAX_RAM_INTERFACES 4
 
+#ifdef NX_ENABLE_RAM_DRIVER_RINGS
+/* Define the number of frames each ring holds.  The size must be a power of two.  */
+#ifndef NX_RAM_DRIVER_RING_SIZE
+#define NX_RAM_DRIVER_RING_SIZE             64
+#endif /* NX_RAM_DRIVER_RING_SIZE */
+
+/* Define the barrier that orders the ring slot accesses against the index updates.
+   Ports for compilers other than GCC on multicore targets must define it.  */
+#ifndef NX_RAM_DRIVER_RING_BARRIER
+#ifdef __GNUC__
+#define NX_RAM_DRIVER_RING_BARRIER()        __sync_synchronize()
+#else
+#define NX_RAM_DRIVER_RING_BARRIER()
+#endif /* __GNUC__ */
+#endif /* NX_RAM_DRIVER_RING_BARRIER */
+
+
+/* Define the single producer, single consumer ring of frames from one instance to
+   another.  Only the sending instance advances the tail and only the IP thread of the
+   receiving instance advances the head, so no lock is needed.  The drop counters are
+   kept per ring for the same reason: each is only written by the sending instance.  */
+typedef struct _nx_ram_network_driver_ring_type
+{
+    NX_PACKET     *nx_ram_driver_ring_packet[NX_RAM_DRIVER_RING_SIZE];
+
+    volatile ULONG nx_ram_driver_ring_head;
+    volatile ULONG nx_ram_driver_ring_tail;
+
+    /* Frames dropped on a full ring, and for lack of a receive packet.  */
+    ULONG          nx_ram_driver_ring_full;
+    ULONG          nx_ram_driver_ring_allocation_errors;
+} _nx_ram_network_driver_ring_type;
+#endif /* NX_ENABLE_RAM_DRIVER_RINGS */
+
+#ifdef NX_ENABLE_DRIVER_TRANSMIT_MORE
+/* Define the driver specific command that returns the number of times transmission was
+   started, as a real device would ring its transmit doorbell.  Comparing it with the
+   NX_LINK_GET_TX_COUNT result shows how many packets each doorbell covered.  */
+#define NX_RAM_DRIVER_GET_DOORBELL_COUNT    (NX_LINK_USER_COMMAND + 1)
+#endif /* NX_ENABLE_DRIVER_TRANSMIT_MORE */
+
 
 typedef struct _nx_ram_network_driver_instance_type
 {
@@ -79,6 +128,25 @@ typedef struct _nx_ram_network_driver_instance_type
 
     ULONG         nx_ram_driver_simulated_address_msw;
     ULONG         nx_ram_driver_simulated_address_lsw;
+
+#ifdef NX_ENABLE_DRIVER_TRANSMIT_MORE
+    /* Frames posted with the transmit more hint, waiting for the doorbell.  */
+    NX_PACKET    *nx_ram_driver_transmit_head;
+    NX_PACKET    *nx_ram_driver_transmit_tail;
+
+    /* Transmit statistics.  */
+    ULONG         nx_ram_driver_transmit_packets;
+    ULONG         nx_ram_driver_transmit_doorbells;
+#endif /* NX_ENABLE_DRIVER_TRANSMIT_MORE */
+
+#ifdef NX_ENABLE_RAM_DRIVER_RINGS
+    /* Receive rings, one per sending instance.  */
+    _nx_ram_network_driver_ring_type
+                  nx_ram_driver_receive_ring[NX_MAX_RAM_INTERFACES];
+
+    /* Frames received from the rings, only written by the receiving IP thread.  */
+    ULONG         nx_ram_driver_receive_packets;
+#endif /* NX_ENABLE_RAM_DRIVER_RINGS */
 } _nx_ram_network_driver_instance_type;
 
 static _nx_ram_network_driver_instance_type nx_ram_driver[NX_MAX_RAM_INTERFACES];
@@ -110,6 +178,8 @@ static _nx_ram_network_driver_instance_type nx_ram_driver[NX_MAX_RAM_INTERFACES]
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_ram_network_driver_output         Send physical packet out      */
+/*    _nx_ram_network_driver_ring_drain     Receive frames from the rings */
+/*    _nx_ram_network_driver_ring_flush     Release frames on the rings   */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -129,6 +199,11 @@ NX_IP        *ip_ptr;
 NX_PACKET    *packet_ptr;
 ULONG        *ethernet_frame_ptr;
 NX_INTERFACE *interface_ptr;
+#ifdef NX_ENABLE_RAM_DRIVER_RINGS
+ULONG         count;
+UINT          ring_index;
+UINT          old_threshold;
+#endif /* NX_ENABLE_RAM_DRIVER_RINGS */
 
 
     /* Setup the IP pointer from the driver request.  */
@@ -246,9 +321,30 @@ NX_INTERFACE *interface_ptr;
     case NX_LINK_UNINITIALIZE:
     {
 
+#ifdef NX_ENABLE_DRIVER_TRANSMIT_MORE
+        /* Send any frames still waiting for the doorbell.  */
+        _nx_ram_network_driver_doorbell(ip_ptr, i);
+#endif /* NX_ENABLE_DRIVER_TRANSMIT_MORE */
+
+#ifdef NX_ENABLE_RAM_DRIVER_RINGS
+        /* Disable preemption, so no sending instance posts a frame on the rings between
+           the flush and the reset of the instance.  Senders post with preemption disabled
+           too, so none is in the middle of a post either.  */
+        tx_thread_preemption_change(tx_thread_identify(), 0, &old_threshold);
+
+        /* Release any frames still on the receive rings, since the IP instance is going
+           away and must not process them.  */
+        _nx_ram_network_driver_ring_flush(i);
+#endif /* NX_ENABLE_RAM_DRIVER_RINGS */
+
         /* Zero out the driver instance. */
         memset(&(nx_ram_driver[i]), 0, sizeof(_nx_ram_network_driver_instance_type));
 
+#ifdef NX_ENABLE_RAM_DRIVER_RINGS
+        /* Restore preemption.  */
+        tx_thread_preemption_change(tx_thread_identify(), old_threshold, &old_threshold);
+#endif /* NX_ENABLE_RAM_DRIVER_RINGS */
+
         break;
     }
 
@@ -335,9 +431,50 @@ NX_INTERFACE *interface_ptr;
 #ifdef NX_DEBUG_PACKET
         printf("NetX RAM Driver Packet Send - %s\n", ip_ptr -> nx_ip_name);
 #endif
+
+#ifdef NX_ENABLE_DRIVER_TRANSMIT_MORE
+        /* Post the frame on the transmit ring.  */
+        packet_ptr -> nx_packet_queue_next =  NX_NULL;
+        if (nx_ram_driver[i].nx_ram_driver_transmit_head)
+        {
+            (nx_ram_driver[i].nx_ram_driver_transmit_tail) -> nx_packet_queue_next =  packet_ptr;
+        }
+        else
+        {
+            nx_ram_driver[i].nx_ram_driver_transmit_head =  packet_ptr;
+        }
+        nx_ram_driver[i].nx_ram_driver_transmit_tail =  packet_ptr;
+
+        /* Ring the doorbell unless more IP packets follow.  */
+        if (((driver_req_ptr -> nx_ip_driver_command != NX_LINK_PACKET_SEND) &&
+             (driver_req_ptr -> nx_ip_driver_command != NX_LINK_PACKET_BROADCAST)) ||
+            (!driver_req_ptr -> nx_ip_driver_transmit_more))
+        {
+            _nx_ram_network_driver_doorbell(ip_ptr, i);
+        }
+#else
         _nx_ram_network_driver_output(ip_ptr, packet_ptr, i);
+#endif /* NX_ENABLE_DRIVER_TRANSMIT_MORE */
+        break;
+    }
+
+#ifdef NX_ENABLE_DRIVER_TRANSMIT_MORE
+    case NX_LINK_PACKET_FLUSH:
+    {
+
+        /* Start transmitting the frames posted with the transmit more hint.  */
+        _nx_ram_network_driver_doorbell(ip_ptr, i);
+        break;
+    }
+
+    case NX_RAM_DRIVER_GET_DOORBELL_COUNT:
+    {
+
+        /* Return the number of times transmission was started.  */
+        *(driver_req_ptr -> nx_ip_driver_return_ptr) =  nx_ram_driver[i].nx_ram_driver_transmit_doorbells;
         break;
     }
+#endif /* NX_ENABLE_DRIVER_TRANSMIT_MORE */
 
     case NX_LINK_MULTICAST_JOIN:
     {
@@ -388,40 +525,78 @@ NX_INTERFACE *interface_ptr;
     case NX_LINK_GET_ERROR_COUNT:
     {
 
+#ifdef NX_ENABLE_RAM_DRIVER_RINGS
+        /* Return the number of frames dropped on a full receive ring, summed over the
+           rings of this instance.  */
+        count =  0;
+        for (ring_index = 0; ring_index < NX_MAX_RAM_INTERFACES; ring_index++)
+        {
+            count +=  nx_ram_driver[i].nx_ram_driver_receive_ring[ring_index].nx_ram_driver_ring_full;
+        }
+        *(driver_req_ptr -> nx_ip_driver_return_ptr) =  count;
+#else
         /* Return the link's line speed in the supplied return pointer. Unsupported feature.  */
         *(driver_req_ptr -> nx_ip_driver_return_ptr) = 0;
+#endif /* NX_ENABLE_RAM_DRIVER_RINGS */
         break;
     }
 
     case NX_LINK_GET_RX_COUNT:
     {
 
+#ifdef NX_ENABLE_RAM_DRIVER_RINGS
+        /* Return the number of frames received from the receive rings.  */
+        *(driver_req_ptr -> nx_ip_driver_return_ptr) =  nx_ram_driver[i].nx_ram_driver_receive_packets;
+#else
         /* Return the link's line speed in the supplied return pointer. Unsupported feature.  */
         *(driver_req_ptr -> nx_ip_driver_return_ptr) = 0;
+#endif /* NX_ENABLE_RAM_DRIVER_RINGS */
         break;
     }
 
     case NX_LINK_GET_TX_COUNT:
     {
 
+#ifdef NX_ENABLE_DRIVER_TRANSMIT_MORE
+        /* Return the number of frames transmitted.  */
+        *(driver_req_ptr -> nx_ip_driver_return_ptr) =  nx_ram_driver[i].nx_ram_driver_transmit_packets;
+#else
         /* Return the link's line speed in the supplied return pointer. Unsupported feature.  */
         *(driver_req_ptr -> nx_ip_driver_return_ptr) = 0;
+#endif /* NX_ENABLE_DRIVER_TRANSMIT_MORE */
         break;
     }
 
     case NX_LINK_GET_ALLOC_ERRORS:
     {
 
+#ifdef NX_ENABLE_RAM_DRIVER_RINGS
+        /* Return the number of frames dropped for lack of a receive packet, summed over
+           the rings of this instance.  */
+        count =  0;
+        for (ring_index = 0; ring_index < NX_MAX_RAM_INTERFACES; ring_index++)
+        {
+            count +=  nx_ram_driver[i].nx_ram_driver_receive_ring[ring_index].nx_ram_driver_ring_allocation_errors;
+        }
+        *(driver_req_ptr -> nx_ip_driver_return_ptr) =  count;
+#else
         /* Return the link's line speed in the supplied return pointer. Unsupported feature.  */
         *(driver_req_ptr -> nx_ip_driver_return_ptr) = 0;
+#endif /* NX_ENABLE_RAM_DRIVER_RINGS */
         break;
     }
 
     case NX_LINK_DEFERRED_PROCESSING:
     {
 
+#ifdef NX_ENABLE_RAM_DRIVER_RINGS
+        /* Receive the frames posted on the receive rings of this instance, as a real
+           device would after its receive interrupt.  */
+        _nx_ram_network_driver_ring_drain(ip_ptr, i);
+#else
         /* Driver defined deferred processing... this is typically used to defer interrupt
            processing to the thread level. In this driver, nothing is done here!  */
+#endif /* NX_ENABLE_RAM_DRIVER_RINGS */
         break;
     }
 
@@ -474,6 +649,7 @@ NX_INTERFACE *interface_ptr;
 /*    nx_packet_copy                        Copy a packet                 */
 /*    nx_packet_transmit_release            Release a packet              */
 /*    _nx_ram_network_driver_receive        RAM driver receive processing */
+/*    _nx_ram_network_driver_ring_post      Post frame on a receive ring  */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -489,11 +665,13 @@ NX_INTERFACE *interface_ptr;
 void  _nx_ram_network_driver_output(NX_IP *ip_ptr, NX_PACKET *packet_ptr, UINT device_instance_id)
 {
 
+#ifndef NX_ENABLE_RAM_DRIVER_RINGS
 NX_IP     *next_ip;
 NX_PACKET *packet_copy;
+#endif /* NX_ENABLE_RAM_DRIVER_RINGS */
+UINT       old_threshold;
 ULONG      destination_address_msw;
 ULONG      destination_address_lsw;
-UINT       old_threshold;
 UINT       i;
 
 #ifdef NX_DEBUG_PACKET
@@ -538,12 +716,14 @@ UINT   j;
     destination_address_lsw =  (destination_address_lsw << 8) | (ULONG)*(packet_ptr -> nx_packet_prepend_ptr + 4);
     destination_address_lsw =  (destination_address_lsw << 8) | (ULONG)*(packet_ptr -> nx_packet_prepend_ptr + 5);
 
-
-    /* Disable preemption.  */
+    /* Disable preemption.  With the receive rings, this keeps a receiving instance from
+       being uninitialized while a frame is posted on its ring.  */
     tx_thread_preemption_change(tx_thread_identify(), 0, &old_threshold);
 
+#ifndef NX_ENABLE_RAM_DRIVER_RINGS
     /* Loop through all instances of created IPs to see who gets the packet.  */
     next_ip =  ip_ptr -> nx_ip_created_next;
+#endif /* NX_ENABLE_RAM_DRIVER_RINGS */
 
     for (i = 0; i < NX_MAX_RAM_INTERFACES; i++)
     {
@@ -567,6 +747,11 @@ UINT   j;
             ((destination_address_msw == nx_ram_driver[i].nx_ram_driver_simulated_address_msw) &&
              (destination_address_lsw == nx_ram_driver[i].nx_ram_driver_simulated_address_lsw)))
         {
+#ifdef NX_ENABLE_RAM_DRIVER_RINGS
+            /* Post a copy of the packet on the receive ring for this link.  The receiving
+               instance picks it up in its own deferred processing.  */
+            _nx_ram_network_driver_ring_post(packet_ptr, device_instance_id, i);
+#else
             /* Make a copy of packet for the forwarding.  */
             if (nx_packet_copy(packet_ptr, &packet_copy, next_ip -> nx_ip_default_packet_pool, NX_NO_WAIT))
             {
@@ -583,6 +768,7 @@ UINT   j;
             }
 
             _nx_ram_network_driver_receive(next_ip, packet_copy, i);
+#endif /* NX_ENABLE_RAM_DRIVER_RINGS */
         }
     }
 
@@ -601,6 +787,336 @@ UINT   j;
 }
 
 
+#ifdef NX_ENABLE_DRIVER_TRANSMIT_MORE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ram_network_driver_doorbell                     PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function models the transmit doorbell of a real device.  All   */
+/*    frames posted on the transmit ring are sent with one doorbell, so   */
+/*    the number of doorbells per frame shows the effect of the transmit  */
+/*    more hint.                                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP protocol block  */
+/*    device_instance_id                    The device ID of the ring     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ram_network_driver_output         Send physical packet out      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ram_network_driver                RAM network driver            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+void  _nx_ram_network_driver_doorbell(NX_IP *ip_ptr, UINT device_instance_id)
+{
+
+NX_PACKET *packet_ptr;
+NX_PACKET *next_packet_ptr;
+
+
+    /* Pickup the posted frames.  */
+    packet_ptr =  nx_ram_driver[device_instance_id].nx_ram_driver_transmit_head;
+
+    /* Nothing to do if the transmit ring is empty.  */
+    if (packet_ptr == NX_NULL)
+    {
+        return;
+    }
+
+    /* Empty the transmit ring.  */
+    nx_ram_driver[device_instance_id].nx_ram_driver_transmit_head =  NX_NULL;
+    nx_ram_driver[device_instance_id].nx_ram_driver_transmit_tail =  NX_NULL;
+
+    /* Count the doorbell.  */
+    nx_ram_driver[device_instance_id].nx_ram_driver_transmit_doorbells++;
+
+    /* Send each frame in the order it was posted.  Frames posted while sending
+       belong to the next doorbell.  */
+    while (packet_ptr)
+    {
+
+        /* Unlink the frame before it is handed on.  */
+        next_packet_ptr =  packet_ptr -> nx_packet_queue_next;
+        packet_ptr -> nx_packet_queue_next =  NX_NULL;
+
+        /* Count and send the frame.  */
+        nx_ram_driver[device_instance_id].nx_ram_driver_transmit_packets++;
+        _nx_ram_network_driver_output(ip_ptr, packet_ptr, device_instance_id);
+
+        /* Move to the next frame.  */
+        packet_ptr =  next_packet_ptr;
+    }
+}
+#endif /* NX_ENABLE_DRIVER_TRANSMIT_MORE */
+
+
+#ifdef NX_ENABLE_RAM_DRIVER_RINGS
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ram_network_driver_ring_post                    PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function copies a frame into a packet from the default pool of */
+/*    the receiving instance and posts it on the receive ring for the     */
+/*    link from the sending instance, as a device would DMA a frame into  */
+/*    a receive descriptor.  The receiving IP thread is then woken to     */
+/*    process it.  The frame is dropped if no packet is available or the  */
+/*    ring is full.  The caller disables preemption, so the receiving     */
+/*    instance is not uninitialized while the frame is posted.            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    packet_ptr                            Packet pointer                */
+/*    source_id                             The device ID the packet was  */
+/*                                            sent from                   */
+/*    destination_id                        The device ID the packet is   */
+/*                                            destined for                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_packet_copy                        Copy a packet                 */
+/*    nx_packet_release                     Release a packet              */
+/*    _nx_ip_driver_deferred_processing     Wake the receiving IP thread  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ram_network_driver_output         RAM driver output routine     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+void  _nx_ram_network_driver_ring_post(NX_PACKET *packet_ptr, UINT source_id, UINT destination_id)
+{
+
+_nx_ram_network_driver_ring_type *ring_ptr;
+NX_IP                            *receive_ip;
+NX_PACKET                        *packet_copy;
+ULONG                             tail;
+
+
+    /* Pickup the receiving IP instance and the ring of this link.  */
+    receive_ip =  nx_ram_driver[destination_id].nx_ram_driver_ip_ptr;
+    ring_ptr =    &(nx_ram_driver[destination_id].nx_ram_driver_receive_ring[source_id]);
+
+    /* Pickup the producer index.  */
+    tail =  ring_ptr -> nx_ram_driver_ring_tail;
+
+    /* Determine if the ring is full.  */
+    if ((tail - ring_ptr -> nx_ram_driver_ring_head) >= NX_RAM_DRIVER_RING_SIZE)
+    {
+
+        /* Yes, drop the frame.  */
+        ring_ptr -> nx_ram_driver_ring_full++;
+        return;
+    }
+
+    /* Make a copy of the packet in the receiving pool.  */
+    if (nx_packet_copy(packet_ptr, &packet_copy, receive_ip -> nx_ip_default_packet_pool, NX_NO_WAIT))
+    {
+
+        /* No packet available, drop the frame.  */
+        ring_ptr -> nx_ram_driver_ring_allocation_errors++;
+        return;
+    }
+
+    /* Place the copy in the slot, then publish it to the receiving instance.  */
+    ring_ptr -> nx_ram_driver_ring_packet[tail & (NX_RAM_DRIVER_RING_SIZE - 1)] =  packet_copy;
+    NX_RAM_DRIVER_RING_BARRIER();
+    ring_ptr -> nx_ram_driver_ring_tail =  tail + 1;
+
+    /* Wake the receiving IP thread.  */
+    _nx_ip_driver_deferred_processing(receive_ip);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ram_network_driver_ring_drain                   PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function receives the frames posted on the receive rings of a  */
+/*    RAM driver instance, in the order they were posted on each link.    */
+/*    It is called from the deferred processing of the receiving IP       */
+/*    thread, as a real device would be serviced after its receive        */
+/*    interrupt.                                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP protocol block  */
+/*    device_instance_id                    The device ID of the rings    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ram_network_driver_receive        RAM driver receive processing */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ram_network_driver                RAM network driver            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+void  _nx_ram_network_driver_ring_drain(NX_IP *ip_ptr, UINT device_instance_id)
+{
+
+_nx_ram_network_driver_ring_type *ring_ptr;
+NX_PACKET                        *packet_ptr;
+ULONG                             head;
+UINT                              i;
+
+
+    /* Loop through the rings of each link into this instance.  */
+    for (i = 0; i < NX_MAX_RAM_INTERFACES; i++)
+    {
+
+        /* Pickup the ring and its consumer index.  */
+        ring_ptr =  &(nx_ram_driver[device_instance_id].nx_ram_driver_receive_ring[i]);
+        head =      ring_ptr -> nx_ram_driver_ring_head;
+
+        /* Loop to receive the frames published on the ring.  */
+        while (head != ring_ptr -> nx_ram_driver_ring_tail)
+        {
+
+            /* Take the frame out of the slot, then return the slot to the sending
+               instance.  */
+            NX_RAM_DRIVER_RING_BARRIER();
+            packet_ptr =  ring_ptr -> nx_ram_driver_ring_packet[head & (NX_RAM_DRIVER_RING_SIZE - 1)];
+            NX_RAM_DRIVER_RING_BARRIER();
+            head++;
+            ring_ptr -> nx_ram_driver_ring_head =  head;
+
+            /* Count and receive the frame.  */
+            nx_ram_driver[device_instance_id].nx_ram_driver_receive_packets++;
+            _nx_ram_network_driver_receive(ip_ptr, packet_ptr, device_instance_id);
+        }
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_ram_network_driver_ring_flush                   PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function releases the frames left on the receive rings of a    */
+/*    RAM driver instance that is being uninitialized.  The frames are    */
+/*    not passed to the IP instance, which is being deleted.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    device_instance_id                    The device ID of the rings    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_packet_release                     Release a packet              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_ram_network_driver                RAM network driver            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+void  _nx_ram_network_driver_ring_flush(UINT device_instance_id)
+{
+
+_nx_ram_network_driver_ring_type *ring_ptr;
+ULONG                             head;
+UINT                              i;
+
+
+    /* Loop through the rings of each link into this instance.  */
+    for (i = 0; i < NX_MAX_RAM_INTERFACES; i++)
+    {
+
+        /* Pickup the ring and its consumer index.  */
+        ring_ptr =  &(nx_ram_driver[device_instance_id].nx_ram_driver_receive_ring[i]);
+        head =      ring_ptr -> nx_ram_driver_ring_head;
+
+        /* Loop to release the frames published on the ring.  */
+        while (head != ring_ptr -> nx_ram_driver_ring_tail)
+        {
+
+            /* Release the frame in the slot.  */
+            NX_RAM_DRIVER_RING_BARRIER();
+            nx_packet_release(ring_ptr -> nx_ram_driver_ring_packet[head & (NX_RAM_DRIVER_RING_SIZE - 1)]);
+            head++;
+        }
+
+        /* Mark the ring empty.  */
+        ring_ptr -> nx_ram_driver_ring_head =  head;
+    }
+}
+#endif /* NX_ENABLE_RAM_DRIVER_RINGS */
+
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -634,6 +1150,8 @@ UINT   j;
 /*    _nx_ip_packet_receive                 IP receive packet processing  */
 /*    _nx_ip_packet_deferred_receive        IP deferred receive packet    */
 /*                                            processing                  */
+/*    _nx_ip_packet_flow_hash               Compute receive flow hash     */
+/*    _nx_ip_packet_flow_receive            IP flow steered receive       */
 /*    _nx_arp_packet_deferred_receive       ARP receive processing        */
 /*    _nx_rarp_packet_deferred_receive      RARP receive processing       */
 /*    nx_packet_release                     Packet release                */
@@ -641,6 +1159,7 @@ UINT   j;
 /*  CALLED BY                                                             */
 /*                                                                        */
 /*    NetX IP processing                                                  */
+/*    _nx_ram_network_driver_ring_drain     Receive frames from the rings */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -686,6 +1205,10 @@ UINT packet_type;
 
 #ifdef NX_DIRECT_ISR_CALL
         _nx_ip_packet_receive(ip_ptr, packet_ptr);
+#elif defined(NX_ENABLE_IP_RECEIVE_QUEUES)
+        /* Deliver the packet with its flow hash, as hardware with receive side
+           scaling would.  */
+        _nx_ip_packet_flow_receive(ip_ptr, packet_ptr, _nx_ip_packet_flow_hash(packet_ptr));
 #else
         _nx_ip_packet_deferred_receive(ip_ptr, packet_ptr);
 #endif
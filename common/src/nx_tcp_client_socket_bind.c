@@ -26,6 +26,7 @@
 /* Include necessary system files.  */
 
 #include "nx_api.h"
+#include "nx_ip.h"
 #include "nx_tcp.h"
 #include "tx_thread.h"
 
@@ -57,6 +58,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_ip_port_bitmap_set                Mark port in use              */
 /*    _nx_tcp_free_port_find                Find free TCP port            */
 /*    _nx_tcp_socket_thread_suspend         Suspend thread                */
 /*    tx_mutex_get                          Obtain protection mutex       */
@@ -191,6 +193,11 @@ NX_TCP_SOCKET *end_ptr;
         /* Restore interrupts.  */
         TX_RESTORE
 
+#ifdef NX_ENABLE_EPHEMERAL_PORT_BITMAP
+        /* Mark the port as in use in the ephemeral port bitmap.  */
+        _nx_ip_port_bitmap_set(&(ip_ptr -> nx_ip_tcp_port_bitmap), port);
+#endif /* NX_ENABLE_EPHEMERAL_PORT_BITMAP */
+
         /* Release the mutex protection.  */
         tx_mutex_put(&(ip_ptr -> nx_ip_protection));
 
@@ -57,6 +57,7 @@
 /*                                                                        */
 /*    _nx_tcp_client_bind_cleanup           Remove and cleanup bind req   */
 /*    _nx_tcp_disconnect_cleanup            Disconnect cleanup            */
+/*    _nx_tcp_port_bitmap_release           Release port in bitmap        */
 /*    _nx_tcp_socket_receive_queue_flush    Release all received packets  */
 /*    _nx_tcp_socket_thread_resume          Resume thread suspended on    */
 /*                                            port                        */
@@ -274,6 +275,11 @@ NX_TCP_SOCKET *new_socket_ptr;
         _nx_tcp_socket_thread_resume(&(new_socket_ptr -> nx_tcp_socket_bind_suspension_list), NX_SUCCESS);
     }
 
+#ifdef NX_ENABLE_EPHEMERAL_PORT_BITMAP
+    /* Mark the port as free in the ephemeral port bitmap, unless another socket is still bound to it.  */
+    _nx_tcp_port_bitmap_release(ip_ptr, port);
+#endif /* NX_ENABLE_EPHEMERAL_PORT_BITMAP */
+
     /* Release the protection mutex.  */
     tx_mutex_put(&(ip_ptr -> nx_ip_protection));
 
@@ -62,6 +62,7 @@
 /*    _nx_tcp_packet_send_syn               Send initial SYN again        */
 /*    _nx_tcp_socket_connection_reset       Reset connection on timeout   */
 /*    _nx_tcp_socket_retransmit             Retransmit packet             */
+/*    _nx_tcp_socket_tlp_send               Send tail loss probe          */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -121,6 +122,59 @@ ULONG          timer_rate;
         }
 
 
+#ifdef NX_ENABLE_TCP_RACK_TLP
+        /* Determine if a RACK reordering timeout is active.  */
+        if (socket_ptr -> nx_tcp_socket_rack_timeout)
+        {
+
+            /* Determine if it has expired.  */
+            if (socket_ptr -> nx_tcp_socket_rack_timeout > timer_rate)
+            {
+
+                /* No, just decrement it for now.  */
+                socket_ptr -> nx_tcp_socket_rack_timeout =  socket_ptr -> nx_tcp_socket_rack_timeout - timer_rate;
+            }
+            else
+            {
+
+                /* Yes, the reordering window has passed without the head being acknowledged.  */
+                socket_ptr -> nx_tcp_socket_rack_timeout =  0;
+
+                /* Determine if the head is still waiting for loss recovery.  */
+                if ((socket_ptr -> nx_tcp_socket_transmit_sent_head) &&
+                    (socket_ptr -> nx_tcp_socket_duplicated_ack_received) &&
+                    (socket_ptr -> nx_tcp_socket_duplicated_ack_received < 3) &&
+                    (socket_ptr -> nx_tcp_socket_fast_recovery == NX_FALSE))
+                {
+
+                    /* Retransmit the head and enter fast recovery.  */
+                    _nx_tcp_socket_retransmit(ip_ptr, socket_ptr, NX_TCP_RACK_RETRANSMIT);
+                    socket_ptr -> nx_tcp_socket_duplicated_ack_received =  3;
+                }
+            }
+        }
+
+        /* Determine if a tail loss probe timeout is active.  */
+        if (socket_ptr -> nx_tcp_socket_tlp_timeout)
+        {
+
+            /* Determine if it has expired.  */
+            if (socket_ptr -> nx_tcp_socket_tlp_timeout > timer_rate)
+            {
+
+                /* No, just decrement it for now.  */
+                socket_ptr -> nx_tcp_socket_tlp_timeout =  socket_ptr -> nx_tcp_socket_tlp_timeout - timer_rate;
+            }
+            else
+            {
+
+                /* Yes, send the tail loss probe.  */
+                socket_ptr -> nx_tcp_socket_tlp_timeout =  0;
+                _nx_tcp_socket_tlp_send(ip_ptr, socket_ptr);
+            }
+        }
+#endif /* NX_ENABLE_TCP_RACK_TLP */
+
         /* Determine if a timeout is active.  */
         if (socket_ptr -> nx_tcp_socket_timeout)
         {
@@ -165,6 +219,22 @@ ULONG          timer_rate;
                 /* Update the transmit sequence that entered fast transmit. */
                 socket_ptr -> nx_tcp_socket_tx_sequence_recover = socket_ptr -> nx_tcp_socket_tx_sequence - 1;
 
+#ifndef NX_DISABLE_TCP_INFO
+                /* Determine if the peer's window is open.  If it is closed, a zero window
+                   probe is sent instead and counted separately.  */
+                if (socket_ptr -> nx_tcp_socket_tx_window_advertised)
+                {
+
+                    /* Increment the retransmit timeout count for the socket.  */
+                    socket_ptr -> nx_tcp_socket_retransmit_timeouts++;
+                }
+#endif
+
+#ifdef NX_ENABLE_TCP_RACK_TLP
+                /* The retransmit timeout ends any tail loss probe episode.  */
+                socket_ptr -> nx_tcp_socket_tlp_in_progress =  NX_FALSE;
+#endif /* NX_ENABLE_TCP_RACK_TLP */
+
                 /* Retransmit the packet. */
                 _nx_tcp_socket_retransmit(ip_ptr, socket_ptr, NX_FALSE);
 
@@ -26,6 +26,7 @@
 /* Include necessary system files.  */
 
 #include "nx_api.h"
+#include "nx_ip.h"
 #include "nx_tcp.h"
 
 
@@ -57,6 +58,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_ip_port_bitmap_find               Find free port in bitmap      */
 /*    tx_mutex_get                          Obtain protection mutex       */
 /*    tx_mutex_put                          Release protection mutex      */
 /*                                                                        */
@@ -79,6 +81,9 @@ UINT           bound;
 UINT           starting_port;
 NX_TCP_SOCKET *search_ptr;
 NX_TCP_SOCKET *end_ptr;
+#ifdef NX_ENABLE_EPHEMERAL_PORT_BITMAP
+UINT           status;
+#endif /* NX_ENABLE_EPHEMERAL_PORT_BITMAP */
 
 #ifdef TX_ENABLE_EVENT_TRACE
 TX_TRACE_BUFFER_ENTRY *trace_event;
@@ -89,6 +94,33 @@ ULONG                  trace_timestamp;
     /* If trace is enabled, insert this event into the trace buffer.  */
     NX_TRACE_IN_LINE_INSERT(NX_TRACE_TCP_FREE_PORT_FIND, ip_ptr, port, 0, 0, NX_TRACE_TCP_EVENTS, &trace_event, &trace_timestamp)
 
+#ifdef NX_ENABLE_EPHEMERAL_PORT_BITMAP
+    /* Determine if the starting port is covered by the ephemeral port bitmap.  */
+    if ((port >= NX_SEARCH_PORT_START) && (((ULONG)port) <= (ULONG)NX_MAX_PORT))
+    {
+
+        /* Obtain the IP mutex so we can search the bitmap of bound ports.  */
+        tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+        /* Find the first free port at or after the starting port.  */
+        status =  _nx_ip_port_bitmap_find(&(ip_ptr -> nx_ip_tcp_port_bitmap), port, free_port_ptr);
+
+        /* Release protection.  */
+        tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+        /* Determine if a free port was found.  */
+        if (status == NX_SUCCESS)
+        {
+
+            /* Update the trace event with the status.  */
+            NX_TRACE_EVENT_UPDATE(trace_event, trace_timestamp, NX_TRACE_TCP_FREE_PORT_FIND, 0, 0, *free_port_ptr, 0)
+        }
+
+        /* Return the completion status.  */
+        return(status);
+    }
+#endif /* NX_ENABLE_EPHEMERAL_PORT_BITMAP */
+
     /* Save the original port.  */
     starting_port =  port;
 
@@ -62,11 +62,14 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_ip_port_bitmap_set                Mark port in use              */
 /*    _nx_packet_release                    Packet release function       */
 /*    _nx_tcp_checksum                      Calculate TCP packet checksum */
 /*    _nx_tcp_mss_option_get                Get peer MSS option           */
 /*    _nx_tcp_no_connection_reset           Reset on no connection        */
 /*    _nx_tcp_packet_send_syn               Send SYN message              */
+/*    _nx_tcp_server_socket_pool_arm        Arm listen from accept pool   */
+/*    _nx_tcp_socket_path_mtu_refresh       Refresh MSS from path MTU     */
 /*    _nx_tcp_socket_packet_process         Socket specific packet        */
 /*                                            processing routine          */
 /*    (nx_tcp_listen_callback)              Application listen callback   */
@@ -275,6 +278,11 @@ ULONG                        rwin_scale = 0xFF;
                     socket_ptr -> nx_tcp_socket_connect_mss2 =
                         socket_ptr -> nx_tcp_socket_connect_mss * socket_ptr -> nx_tcp_socket_connect_mss;
 
+#ifdef NX_ENABLE_IP_PATH_MTU_DISCOVERY
+                    /* Lower the connect MSS to fit the path MTU to the peer.  */
+                    _nx_tcp_socket_path_mtu_refresh(socket_ptr);
+#endif /* NX_ENABLE_IP_PATH_MTU_DISCOVERY */
+
 
 
 #ifdef NX_ENABLE_TCP_WINDOW_SCALING
@@ -506,6 +514,11 @@ ULONG                        rwin_scale = 0xFF;
                         ip_ptr -> nx_ip_tcp_port_table[index] =       socket_ptr;
                     }
 
+#ifdef NX_ENABLE_EPHEMERAL_PORT_BITMAP
+                    /* Mark the port as in use in the ephemeral port bitmap.  */
+                    _nx_ip_port_bitmap_set(&(ip_ptr -> nx_ip_tcp_port_bitmap), port);
+#endif /* NX_ENABLE_EPHEMERAL_PORT_BITMAP */
+
                     /* Pickup the listen callback function.  */
                     listen_callback =  listen_ptr -> nx_tcp_listen_callback;
 
@@ -541,6 +554,16 @@ ULONG                        rwin_scale = 0xFF;
                         _nx_tcp_packet_send_syn(socket_ptr, (socket_ptr -> nx_tcp_socket_tx_sequence - 1));
                     }
 
+#ifdef NX_ENABLE_TCP_ACCEPT_POOL
+                    /* Determine if this listen request is served by an accept pool.  */
+                    if (listen_ptr -> nx_tcp_listen_pool_sockets)
+                    {
+
+                        /* Yes, arm it with the next free socket for the next connection request.  */
+                        _nx_tcp_server_socket_pool_arm(ip_ptr, listen_ptr);
+                    }
+#endif /* NX_ENABLE_TCP_ACCEPT_POOL */
+
                     /* Determine if there is a listen callback function.  */
                     if (listen_callback)
                     {
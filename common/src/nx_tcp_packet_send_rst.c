@@ -98,6 +98,9 @@ ULONG          checksum;
     /* The outgoing interface should have been stored in the socket structure. */
     packet_ptr -> nx_packet_ip_interface = socket_ptr -> nx_tcp_socket_connect_interface;
     packet_ptr -> nx_packet_next_hop_address = socket_ptr -> nx_tcp_socket_next_hop_address;
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+    packet_ptr -> nx_packet_destination_cache = &(socket_ptr -> nx_tcp_socket_destination_cache);
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
 
 #ifndef NX_DISABLE_TCP_INFO
 
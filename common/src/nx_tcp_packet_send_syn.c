@@ -59,6 +59,7 @@
 /*    _nx_packet_allocate                   Allocate a packet             */
 /*    _nx_tcp_checksum                      Calculate TCP checksum        */
 /*    _nx_ip_packet_send                    Send IP packet                */
+/*    _nx_tcp_socket_path_mtu_refresh       Refresh MSS from path MTU     */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -106,6 +107,9 @@ UINT        scale_factor;
     /* The outgoing interface should have been stored in the socket structure. */
     packet_ptr -> nx_packet_ip_interface = socket_ptr -> nx_tcp_socket_connect_interface;
     packet_ptr -> nx_packet_next_hop_address = socket_ptr -> nx_tcp_socket_next_hop_address;
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+    packet_ptr -> nx_packet_destination_cache = &(socket_ptr -> nx_tcp_socket_destination_cache);
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
 
     /* Setup the packet payload pointers and length for a basic TCP packet.  */
     packet_ptr -> nx_packet_prepend_ptr -= sizeof(NX_TCP_SYN);
@@ -210,6 +214,11 @@ UINT        scale_factor;
         /* Compute the SMSS * SMSS value, so later TCP module doesn't need to redo the multiplication. */
         socket_ptr -> nx_tcp_socket_connect_mss2 =
             socket_ptr -> nx_tcp_socket_connect_mss * socket_ptr -> nx_tcp_socket_connect_mss;
+
+#ifdef NX_ENABLE_IP_PATH_MTU_DISCOVERY
+        /* Lower the connect MSS to fit the path MTU to the peer.  */
+        _nx_tcp_socket_path_mtu_refresh(socket_ptr);
+#endif /* NX_ENABLE_IP_PATH_MTU_DISCOVERY */
     }
 
     /* Build the remainder of the TCP header.  */
@@ -255,5 +264,18 @@ UINT        scale_factor;
 
     /* Reset fast recovery stage. */
     socket_ptr -> nx_tcp_socket_fast_recovery = NX_FALSE;
+
+    /* Reset the round trip time estimate for the new connection. */
+    socket_ptr -> nx_tcp_socket_rtt_timing = NX_FALSE;
+    socket_ptr -> nx_tcp_socket_rtt_smoothed = 0;
+    socket_ptr -> nx_tcp_socket_rtt_variance = 0;
+
+#ifdef NX_ENABLE_TCP_RACK_TLP
+    /* Reset the RACK-TLP loss detection state. */
+    socket_ptr -> nx_tcp_socket_rtt_minimum = 0;
+    socket_ptr -> nx_tcp_socket_rack_timeout = 0;
+    socket_ptr -> nx_tcp_socket_tlp_timeout = 0;
+    socket_ptr -> nx_tcp_socket_tlp_in_progress = NX_FALSE;
+#endif /* NX_ENABLE_TCP_RACK_TLP */
 }
 
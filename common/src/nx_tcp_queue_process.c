@@ -26,6 +26,7 @@
 /* Include necessary system files.  */
 
 #include "nx_api.h"
+#include "nx_ip.h"
 #include "nx_tcp.h"
 
 
@@ -54,6 +55,8 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_tcp_packet_process                Process TCP packet            */
+/*    tx_event_flags_set                    Repost the TCP event when the */
+/*                                            budget is spent             */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -73,6 +76,11 @@ TX_INTERRUPT_SAVE_AREA
 
 NX_PACKET *queue_head;
 NX_PACKET *packet_ptr;
+#ifdef NX_ENABLE_IP_EVENT_BUDGET
+NX_PACKET *queue_tail;
+ULONG      queue_count;
+UINT       budget;
+#endif /* NX_ENABLE_IP_EVENT_BUDGET */
 
 
     /* Disable interrupts.  */
@@ -80,6 +88,10 @@ NX_PACKET *packet_ptr;
 
     /* Remove the TCP message queue from the IP structure.  */
     queue_head =  ip_ptr -> nx_ip_tcp_queue_head;
+#ifdef NX_ENABLE_IP_EVENT_BUDGET
+    queue_tail =   ip_ptr -> nx_ip_tcp_queue_tail;
+    queue_count =  ip_ptr -> nx_ip_tcp_received_packet_count;
+#endif /* NX_ENABLE_IP_EVENT_BUDGET */
     ip_ptr -> nx_ip_tcp_queue_head =  NX_NULL;
     ip_ptr -> nx_ip_tcp_queue_tail =  NX_NULL;
     ip_ptr -> nx_ip_tcp_received_packet_count =  0;
@@ -87,10 +99,46 @@ NX_PACKET *packet_ptr;
     /* Restore interrupts.  */
     TX_RESTORE
 
+#ifdef NX_ENABLE_IP_EVENT_BUDGET
+    /* Setup the number of packets that may be processed in this pass.  */
+    budget =  NX_IP_TCP_BUDGET;
+#endif /* NX_ENABLE_IP_EVENT_BUDGET */
+
     /* Walk through the entire TCP message queue and process packets
        one by one.  */
     while (queue_head)
     {
+#ifdef NX_ENABLE_IP_EVENT_BUDGET
+
+        /* Determine if the budget for this pass is spent.  */
+        if (budget == 0)
+        {
+
+            /* Disable interrupts.  */
+            TX_DISABLE
+
+            /* Return the unprocessed packets to the front of the TCP message queue,
+               ahead of any packets queued in the meantime.  */
+            queue_tail -> nx_packet_queue_next =  ip_ptr -> nx_ip_tcp_queue_head;
+            if (ip_ptr -> nx_ip_tcp_queue_head == NX_NULL)
+            {
+                ip_ptr -> nx_ip_tcp_queue_tail =  queue_tail;
+            }
+            ip_ptr -> nx_ip_tcp_queue_head =  queue_head;
+            ip_ptr -> nx_ip_tcp_received_packet_count +=  queue_count;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Post the TCP event again so the other pending events are serviced first.  */
+            tx_event_flags_set(&(ip_ptr -> nx_ip_events), NX_IP_TCP_EVENT, TX_OR);
+            return;
+        }
+
+        /* Account for this packet.  */
+        budget--;
+        queue_count--;
+#endif /* NX_ENABLE_IP_EVENT_BUDGET */
 
         /* Pickup the first queue TCP message and remove it from the
            TCP queue.  */
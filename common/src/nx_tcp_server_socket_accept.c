@@ -156,6 +156,11 @@ NX_IP *ip_ptr;
             socket_ptr -> nx_tcp_socket_bytes_received = 0;
             socket_ptr -> nx_tcp_socket_retransmit_packets = 0;
             socket_ptr -> nx_tcp_socket_checksum_errors = 0;
+            socket_ptr -> nx_tcp_socket_retransmit_timeouts = 0;
+            socket_ptr -> nx_tcp_socket_fast_retransmits = 0;
+            socket_ptr -> nx_tcp_socket_duplicated_acks = 0;
+            socket_ptr -> nx_tcp_socket_zero_window_probes = 0;
+            socket_ptr -> nx_tcp_socket_zero_window_received = 0;
             socket_ptr -> nx_tcp_socket_transmit_sent_head  =  NX_NULL;
             socket_ptr -> nx_tcp_socket_transmit_sent_tail  =  NX_NULL;
             socket_ptr -> nx_tcp_socket_transmit_sent_count =  0;
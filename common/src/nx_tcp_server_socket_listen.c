@@ -171,6 +171,16 @@ struct NX_TCP_LISTEN_STRUCT *tail_ptr;
     listen_ptr -> nx_tcp_listen_queue_head =     NX_NULL;
     listen_ptr -> nx_tcp_listen_queue_tail =     NX_NULL;
 
+#ifdef NX_ENABLE_TCP_ACCEPT_POOL
+    /* A plain listen request has no accept pool.  */
+    listen_ptr -> nx_tcp_listen_pool_sockets =     NX_NULL;
+    listen_ptr -> nx_tcp_listen_pool_count =       0;
+    listen_ptr -> nx_tcp_listen_pool_free_head =   NX_NULL;
+    listen_ptr -> nx_tcp_listen_pool_ready_head =  NX_NULL;
+    listen_ptr -> nx_tcp_listen_pool_ready_tail =  NX_NULL;
+    listen_ptr -> nx_tcp_listen_pool_ready_count = 0;
+#endif /* NX_ENABLE_TCP_ACCEPT_POOL */
+
     /* Indicate this socket is a server socket.  */
     socket_ptr -> nx_tcp_socket_client_type =  NX_FALSE;
 
@@ -0,0 +1,267 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "tx_thread.h"
+#include "nx_tcp.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_server_socket_pool_accept                   PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns up to the specified number of established     */
+/*    connections from the accept pool of the specified port.  Pool       */
+/*    sockets whose connection is reset before they are accepted are      */
+/*    returned to the free list by the reset processing.  If no           */
+/*    connection is ready, the calling thread is suspended on the listen  */
+/*    request until a connection completes, the port is unlistened, or    */
+/*    the wait option expires.                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    port                                  TCP port number               */
+/*    socket_array                          Destination for accepted      */
+/*                                            sockets                     */
+/*    array_size                            Size of socket array          */
+/*    accepted_count                        Destination for the number of */
+/*                                            sockets accepted            */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Obtain protection mutex       */
+/*    tx_mutex_put                          Release protection mutex      */
+/*    _tx_thread_system_suspend             Suspend thread for connection */
+/*    _nx_tcp_server_socket_pool_arm        Arm listen request from pool  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tcp_server_socket_pool_accept(NX_IP *ip_ptr, UINT port, NX_TCP_SOCKET **socket_array, UINT array_size,
+                                        UINT *accepted_count, ULONG wait_option)
+{
+#ifdef NX_ENABLE_TCP_ACCEPT_POOL
+
+TX_INTERRUPT_SAVE_AREA
+
+struct NX_TCP_LISTEN_STRUCT *listen_ptr;
+NX_TCP_SOCKET               *socket_ptr;
+TX_THREAD                   *thread_ptr;
+UINT                         count;
+
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_TCP_SERVER_SOCKET_POOL_ACCEPT, ip_ptr, port, array_size, wait_option, NX_TRACE_TCP_EVENTS, 0, 0)
+
+    /* Set the accepted count to zero.  */
+    *accepted_count =  0;
+
+    /* Loop to wait for established connections.  */
+    do
+    {
+
+        /* Obtain the IP protection.  */
+        tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+        /* Search the active listen requests for this port.  */
+        listen_ptr =  ip_ptr -> nx_ip_tcp_active_listen_requests;
+        if (listen_ptr)
+        {
+            do
+            {
+
+                /* Determine if this is the listen request for the port.  */
+                if (listen_ptr -> nx_tcp_listen_port == port)
+                {
+                    break;
+                }
+
+                /* Move to the next listen request.  */
+                listen_ptr =  listen_ptr -> nx_tcp_listen_next;
+            } while (listen_ptr != ip_ptr -> nx_ip_tcp_active_listen_requests);
+        }
+
+        /* Determine if a listen request with an accept pool was found.  */
+        if ((listen_ptr == NX_NULL) || (listen_ptr -> nx_tcp_listen_port != port) ||
+            (listen_ptr -> nx_tcp_listen_pool_sockets == NX_NULL))
+        {
+
+            /* Release the protection.  */
+            tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+            /* Return the error code.  */
+            return(NX_ENTRY_NOT_FOUND);
+        }
+
+        /* Make sure the listen request has a socket, if one is free.  */
+        _nx_tcp_server_socket_pool_arm(ip_ptr, listen_ptr);
+
+        /* Remove established connections from the ready list.  */
+        count =  0;
+        while ((count < array_size) && (listen_ptr -> nx_tcp_listen_pool_ready_head))
+        {
+
+            /* Remove the socket at the head of the ready list.  */
+            socket_ptr =  listen_ptr -> nx_tcp_listen_pool_ready_head;
+            listen_ptr -> nx_tcp_listen_pool_ready_head =  socket_ptr -> nx_tcp_socket_pool_next;
+            listen_ptr -> nx_tcp_listen_pool_ready_count--;
+
+            /* Determine if the tail needs to be adjusted.  */
+            if (listen_ptr -> nx_tcp_listen_pool_ready_head == NX_NULL)
+            {
+                listen_ptr -> nx_tcp_listen_pool_ready_tail =  NX_NULL;
+            }
+
+            /* The socket is now owned by the application.  */
+            socket_ptr -> nx_tcp_socket_pool_next =   NX_NULL;
+            socket_ptr -> nx_tcp_socket_pool_state =  NX_TCP_POOL_SOCKET_ACCEPTED;
+
+            /* Return the socket to the caller.  */
+            socket_array[count++] =  socket_ptr;
+        }
+
+        /* Determine if any connections were accepted.  */
+        if (count)
+        {
+
+            /* Release the protection.  */
+            tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+            /* Yes, return them.  */
+            *accepted_count =  count;
+            return(NX_SUCCESS);
+        }
+
+        /* Determine if the caller is willing to wait.  */
+        if ((wait_option == NX_NO_WAIT) || (_tx_thread_current_ptr == NX_NULL))
+        {
+
+            /* Release the protection.  */
+            tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+            /* No connection is ready.  */
+            return(NX_IN_PROGRESS);
+        }
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Pickup thread pointer.  */
+        thread_ptr =  _tx_thread_current_ptr;
+
+        /* Place the thread at the end of the accept suspension list of the listen request.  */
+        if (listen_ptr -> nx_tcp_listen_pool_suspension_list)
+        {
+
+            /* This list is not NULL, add current thread to the end. */
+            thread_ptr -> tx_thread_suspended_next =      listen_ptr -> nx_tcp_listen_pool_suspension_list;
+            thread_ptr -> tx_thread_suspended_previous =  (listen_ptr -> nx_tcp_listen_pool_suspension_list) -> tx_thread_suspended_previous;
+            ((listen_ptr -> nx_tcp_listen_pool_suspension_list) -> tx_thread_suspended_previous) -> tx_thread_suspended_next =  thread_ptr;
+            (listen_ptr -> nx_tcp_listen_pool_suspension_list) -> tx_thread_suspended_previous =   thread_ptr;
+        }
+        else
+        {
+
+            /* No other threads are suspended.  Setup the head pointer and
+               just setup this threads pointers to itself.  */
+            listen_ptr -> nx_tcp_listen_pool_suspension_list =  thread_ptr;
+            thread_ptr -> tx_thread_suspended_next =            thread_ptr;
+            thread_ptr -> tx_thread_suspended_previous =        thread_ptr;
+        }
+
+        /* Setup cleanup routine pointer.  */
+        thread_ptr -> tx_thread_suspend_cleanup =  _nx_tcp_server_socket_pool_cleanup;
+
+        /* Setup cleanup information, i.e. this listen request.  */
+        thread_ptr -> tx_thread_suspend_control_block =  (void *)listen_ptr;
+
+        /* Set the state to suspended.  */
+        thread_ptr -> tx_thread_state =  TX_TCP_IP;
+
+        /* Set the suspending flag.  */
+        thread_ptr -> tx_thread_suspending =  TX_TRUE;
+
+        /* Temporarily disable preemption.  */
+        _tx_thread_preempt_disable++;
+
+        /* Save the timeout value.  */
+        thread_ptr -> tx_thread_timer.tx_timer_internal_remaining_ticks =  wait_option;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Release the protection.  */
+        tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+        /* Call actual thread suspension routine.  */
+        _tx_thread_system_suspend(thread_ptr);
+
+        /* The thread is resumed with success when a connection was placed on the
+           ready list or a pool socket was reclaimed, so check the pool again.
+           Otherwise the wait timed out, was aborted, or the port was unlistened.  */
+        if (thread_ptr -> tx_thread_suspend_status != NX_SUCCESS)
+        {
+
+            /* Return the error code.  */
+            return(thread_ptr -> tx_thread_suspend_status);
+        }
+    } while (NX_FOREVER);
+
+#else /* !NX_ENABLE_TCP_ACCEPT_POOL */
+    NX_PARAMETER_NOT_USED(ip_ptr);
+    NX_PARAMETER_NOT_USED(port);
+    NX_PARAMETER_NOT_USED(socket_array);
+    NX_PARAMETER_NOT_USED(array_size);
+    NX_PARAMETER_NOT_USED(accepted_count);
+    NX_PARAMETER_NOT_USED(wait_option);
+
+    return(NX_NOT_SUPPORTED);
+#endif /* NX_ENABLE_TCP_ACCEPT_POOL */
+}
+
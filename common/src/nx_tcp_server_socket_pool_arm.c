@@ -0,0 +1,123 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+
+#ifdef NX_ENABLE_TCP_ACCEPT_POOL
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_server_socket_pool_arm                      PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places the next free socket of an accept pool in the  */
+/*    listen request and issues the accept on its behalf, so the SYN+ACK  */
+/*    for the next connection request is sent without involving the       */
+/*    application.  If the socket picks up a connection request that was  */
+/*    already queued, the listen request is still empty and the next free */
+/*    socket is armed as well, until either the pool or the listen queue  */
+/*    is exhausted.                                                       */
+/*                                                                        */
+/*    This function must be called with the IP protection mutex held.     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    listen_ptr                            Pointer to listen request     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_server_socket_relisten        Place socket in listen request*/
+/*    _nx_tcp_server_socket_accept          Accept connection on socket   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_packet_process                Process incoming TCP packet   */
+/*    _nx_tcp_server_socket_pool_accept     Accept pool connections       */
+/*    _nx_tcp_server_socket_pool_reclaim    Reclaim reset pool socket     */
+/*    _nx_tcp_server_socket_pool_release    Return socket to accept pool  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_server_socket_pool_arm(NX_IP *ip_ptr, struct NX_TCP_LISTEN_STRUCT *listen_ptr)
+{
+
+NX_TCP_SOCKET *socket_ptr;
+UINT           status;
+
+
+    /* Loop while the listen request has no socket and the pool has a free one.  */
+    while ((listen_ptr -> nx_tcp_listen_socket_ptr == NX_NULL) &&
+           (listen_ptr -> nx_tcp_listen_pool_free_head))
+    {
+
+        /* Remove the first socket from the free list.  */
+        socket_ptr =  listen_ptr -> nx_tcp_listen_pool_free_head;
+        listen_ptr -> nx_tcp_listen_pool_free_head =  socket_ptr -> nx_tcp_socket_pool_next;
+        socket_ptr -> nx_tcp_socket_pool_next =  NX_NULL;
+
+        /* Place the socket in the listen request.  If a connection request is queued,
+           the socket is bound to it instead.  */
+        status =  _nx_tcp_server_socket_relisten(ip_ptr, listen_ptr -> nx_tcp_listen_port, socket_ptr);
+
+        /* Determine if the relisten failed.  */
+        if ((status != NX_SUCCESS) && (status != NX_CONNECTION_PENDING))
+        {
+
+            /* Put the socket back on the free list and stop.  */
+            socket_ptr -> nx_tcp_socket_pool_next =  listen_ptr -> nx_tcp_listen_pool_free_head;
+            listen_ptr -> nx_tcp_listen_pool_free_head =  socket_ptr;
+            break;
+        }
+
+        /* The socket is now waiting for its connection to complete.  */
+        socket_ptr -> nx_tcp_socket_pool_state =  NX_TCP_POOL_SOCKET_PENDING;
+
+        /* Accept on behalf of the application.  For a bound socket this sends the SYN+ACK
+           now, otherwise it is sent as soon as the SYN arrives.  */
+        _nx_tcp_server_socket_accept(socket_ptr, NX_NO_WAIT);
+    }
+}
+#endif /* NX_ENABLE_TCP_ACCEPT_POOL */
+
@@ -0,0 +1,165 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "tx_thread.h"
+#include "nx_tcp.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_server_socket_pool_cleanup                  PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function processes accept pool timeout and thread terminate    */
+/*    actions that require the suspended thread to be removed from the    */
+/*    accept suspension list of a TCP listen request.                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                            Pointer to suspended thread's */
+/*                                            control block               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_system_resume              Resume thread service         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_thread_timeout                    Thread timeout processing     */
+/*    tx_thread_terminate                   Thread terminate processing   */
+/*    tx_thread_wait_abort                  Thread wait abort processing  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_server_socket_pool_cleanup(TX_THREAD *thread_ptr NX_CLEANUP_PARAMETER)
+{
+#ifdef NX_ENABLE_TCP_ACCEPT_POOL
+
+TX_INTERRUPT_SAVE_AREA
+
+struct NX_TCP_LISTEN_STRUCT *listen_ptr;    /* Working listen pointer  */
+
+    NX_CLEANUP_EXTENSION
+
+    /* Setup pointer to the listen request.  */
+    listen_ptr =  (struct NX_TCP_LISTEN_STRUCT *)thread_ptr -> tx_thread_suspend_control_block;
+
+    /* Disable interrupts to remove the suspended thread from the listen request.  */
+    TX_DISABLE
+
+    /* Determine if the cleanup is still required.  An unlisten resumes every waiting
+       thread and clears its cleanup before the listen request is reused.  */
+    if ((thread_ptr -> tx_thread_suspend_cleanup) && (listen_ptr))
+    {
+
+        /* Yes, we still have thread suspension!  */
+
+        /* Clear the suspension cleanup flag.  */
+        thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+        /* Remove the suspended thread from the list.  */
+
+        /* See if this is the only suspended thread on the list.  */
+        if (thread_ptr == thread_ptr -> tx_thread_suspended_next)
+        {
+
+            /* Yes, the only suspended thread.  */
+
+            /* Update the head pointer.  */
+            listen_ptr -> nx_tcp_listen_pool_suspension_list =  NX_NULL;
+        }
+        else
+        {
+
+            /* At least one more thread is on the same suspension list.  */
+
+            /* Update the list head pointer.  */
+            if (listen_ptr -> nx_tcp_listen_pool_suspension_list == thread_ptr)
+            {
+                listen_ptr -> nx_tcp_listen_pool_suspension_list =  thread_ptr -> tx_thread_suspended_next;
+            }
+
+            /* Update the links of the adjacent threads.  */
+            (thread_ptr -> tx_thread_suspended_next) -> tx_thread_suspended_previous =
+                thread_ptr -> tx_thread_suspended_previous;
+            (thread_ptr -> tx_thread_suspended_previous) -> tx_thread_suspended_next =
+                thread_ptr -> tx_thread_suspended_next;
+        }
+
+        /* Now we need to determine if this cleanup is from a terminate, timeout,
+           or from a wait abort.  */
+        if (thread_ptr -> tx_thread_state == TX_TCP_IP)
+        {
+
+            /* Thread still suspended on the listen request.  Setup return error status and
+               resume the thread.  */
+
+            /* Setup return status.  */
+            thread_ptr -> tx_thread_suspend_status =  NX_IN_PROGRESS;
+
+            /* Temporarily disable preemption.  */
+            _tx_thread_preempt_disable++;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Resume the thread!  Check for preemption even though we are executing
+               from the system timer thread right now which normally executes at the
+               highest priority.  */
+            _tx_thread_system_resume(thread_ptr);
+
+            /* Finished, just return.  */
+            return;
+        }
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+#else /* !NX_ENABLE_TCP_ACCEPT_POOL */
+    NX_PARAMETER_NOT_USED(thread_ptr);
+    NX_CLEANUP_EXTENSION
+#endif /* NX_ENABLE_TCP_ACCEPT_POOL */
+}
+
@@ -0,0 +1,202 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_server_socket_pool_listen                   PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function registers a listen request for the specified port that*/
+/*    is served by a pool of previously created sockets.  The first socket*/
+/*    of the pool is placed in the listen request and the remaining       */
+/*    sockets are kept on the free list of the pool.  Connection requests */
+/*    are accepted into free pool sockets by the IP thread, and           */
+/*    established connections are retrieved with                          */
+/*    nx_tcp_server_socket_pool_accept.  The socket array must remain     */
+/*    valid until the port is unlistened.                                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    port                                  TCP port number               */
+/*    socket_array                          Array of server sockets       */
+/*    socket_count                          Number of sockets in array    */
+/*    listen_queue_size                     Maximum number of connections */
+/*                                            that can be queued          */
+/*    tcp_listen_callback                   Application function to call  */
+/*                                            when the connection is      */
+/*                                            received                    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Obtain protection mutex       */
+/*    tx_mutex_put                          Release protection mutex      */
+/*    _nx_tcp_server_socket_listen          Register listen request       */
+/*    _nx_tcp_server_socket_accept          Accept connection on socket   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tcp_server_socket_pool_listen(NX_IP *ip_ptr, UINT port, NX_TCP_SOCKET **socket_array, UINT socket_count,
+                                        UINT listen_queue_size, VOID (*tcp_listen_callback)(NX_TCP_SOCKET *socket_ptr, UINT port))
+{
+#ifdef NX_ENABLE_TCP_ACCEPT_POOL
+
+struct NX_TCP_LISTEN_STRUCT *listen_ptr;
+NX_TCP_SOCKET               *socket_ptr;
+UINT                         i;
+UINT                         status;
+
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_TCP_SERVER_SOCKET_POOL_LISTEN, ip_ptr, port, socket_count, listen_queue_size, NX_TRACE_TCP_EVENTS, 0, 0)
+
+    /* Obtain the IP protection.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Make sure every socket of the pool is closed and unbound.  */
+    for (i = 0; i < socket_count; i++)
+    {
+
+        /* Pickup the socket.  */
+        socket_ptr =  socket_array[i];
+
+        /* Determine if the socket is in a proper state.  */
+        if (socket_ptr -> nx_tcp_socket_state != NX_TCP_CLOSED)
+        {
+
+            /* Release the protection mutex.  */
+            tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+            /* Return the not closed error code.  */
+            return(NX_NOT_CLOSED);
+        }
+
+        /* Determine if the socket is bound, has a bind pending or is already part of a pool.  */
+        if ((socket_ptr -> nx_tcp_socket_bound_next) ||
+            (socket_ptr -> nx_tcp_socket_bind_in_progress) ||
+            (socket_ptr -> nx_tcp_socket_pool_listen))
+        {
+
+            /* Release the protection mutex.  */
+            tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+            /* Return an already bound error code.  */
+            return(NX_ALREADY_BOUND);
+        }
+    }
+
+    /* Register the listen request with the first socket of the pool.  */
+    status =  _nx_tcp_server_socket_listen(ip_ptr, port, socket_array[0], listen_queue_size, tcp_listen_callback);
+
+    /* Determine if the listen request was successful.  */
+    if (status != NX_SUCCESS)
+    {
+
+        /* Release the protection mutex.  */
+        tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+        /* Return the error code.  */
+        return(status);
+    }
+
+    /* The new listen request was placed at the end of the active list.  */
+    listen_ptr =  (ip_ptr -> nx_ip_tcp_active_listen_requests) -> nx_tcp_listen_previous;
+
+    /* Setup the accept pool of the listen request.  */
+    listen_ptr -> nx_tcp_listen_pool_sockets =     socket_array;
+    listen_ptr -> nx_tcp_listen_pool_count =       socket_count;
+    listen_ptr -> nx_tcp_listen_pool_free_head =   NX_NULL;
+    listen_ptr -> nx_tcp_listen_pool_ready_head =  NX_NULL;
+    listen_ptr -> nx_tcp_listen_pool_ready_tail =  NX_NULL;
+    listen_ptr -> nx_tcp_listen_pool_ready_count = 0;
+    listen_ptr -> nx_tcp_listen_pool_suspension_list =  NX_NULL;
+
+    /* Place the remaining sockets on the free list, in array order.  */
+    for (i = socket_count - 1; i > 0; i--)
+    {
+
+        /* Pickup the socket.  */
+        socket_ptr =  socket_array[i];
+
+        /* Link the socket at the front of the free list.  */
+        socket_ptr -> nx_tcp_socket_pool_listen =  listen_ptr;
+        socket_ptr -> nx_tcp_socket_pool_state =   NX_TCP_POOL_SOCKET_FREE;
+        socket_ptr -> nx_tcp_socket_pool_next =    listen_ptr -> nx_tcp_listen_pool_free_head;
+        listen_ptr -> nx_tcp_listen_pool_free_head =  socket_ptr;
+    }
+
+    /* The first socket is already in the listen request.  */
+    socket_ptr =  socket_array[0];
+    socket_ptr -> nx_tcp_socket_pool_listen =  listen_ptr;
+    socket_ptr -> nx_tcp_socket_pool_state =   NX_TCP_POOL_SOCKET_PENDING;
+    socket_ptr -> nx_tcp_socket_pool_next =    NX_NULL;
+
+    /* Accept on its behalf, so the SYN+ACK is sent as soon as a SYN arrives.  */
+    _nx_tcp_server_socket_accept(socket_ptr, NX_NO_WAIT);
+
+    /* Release the protection.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Return success.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_TCP_ACCEPT_POOL */
+    NX_PARAMETER_NOT_USED(ip_ptr);
+    NX_PARAMETER_NOT_USED(port);
+    NX_PARAMETER_NOT_USED(socket_array);
+    NX_PARAMETER_NOT_USED(socket_count);
+    NX_PARAMETER_NOT_USED(listen_queue_size);
+    NX_PARAMETER_NOT_USED(tcp_listen_callback);
+
+    return(NX_NOT_SUPPORTED);
+#endif /* NX_ENABLE_TCP_ACCEPT_POOL */
+}
+
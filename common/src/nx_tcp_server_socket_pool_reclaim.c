@@ -0,0 +1,158 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+
+#ifdef NX_ENABLE_TCP_ACCEPT_POOL
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_server_socket_pool_reclaim                  PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns a socket of an accept pool to the free list   */
+/*    when its connection is reset or closed before the application       */
+/*    accepted it, either during the handshake or while it waited on the  */
+/*    ready list. The socket is removed from its port, the listen request */
+/*    is armed again if it was waiting for a socket, and a thread waiting */
+/*    in nx_tcp_server_socket_pool_accept is resumed to check the pool    */
+/*    again. Sockets that are not part of a pool, or that are owned by    */
+/*    the application, are left untouched.                                */
+/*                                                                        */
+/*    This function must be called with the IP protection mutex held.     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to TCP socket         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_server_socket_unaccept        Remove socket from port       */
+/*    _nx_tcp_server_socket_pool_arm        Arm listen request            */
+/*    _nx_tcp_socket_thread_resume          Resume pool accept thread     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_connection_reset       Reset connection              */
+/*    _nx_tcp_socket_state_syn_received     Process SYN RECEIVED state    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_server_socket_pool_reclaim(NX_TCP_SOCKET *socket_ptr)
+{
+
+struct NX_TCP_LISTEN_STRUCT *listen_ptr;
+NX_TCP_SOCKET               *previous_ptr;
+NX_TCP_SOCKET               *current_ptr;
+
+
+    /* Pickup the listen request of the pool.  */
+    listen_ptr =  socket_ptr -> nx_tcp_socket_pool_listen;
+
+    /* Determine if the socket belongs to the pool rather than to the application.  */
+    if ((listen_ptr == NX_NULL) ||
+        ((socket_ptr -> nx_tcp_socket_pool_state != NX_TCP_POOL_SOCKET_PENDING) &&
+         (socket_ptr -> nx_tcp_socket_pool_state != NX_TCP_POOL_SOCKET_READY)))
+    {
+
+        /* No, nothing to reclaim.  */
+        return;
+    }
+
+    /* Determine if the connection was already established.  */
+    if (socket_ptr -> nx_tcp_socket_pool_state == NX_TCP_POOL_SOCKET_READY)
+    {
+
+        /* Yes, remove the socket from the ready list.  */
+        previous_ptr =  NX_NULL;
+        current_ptr =   listen_ptr -> nx_tcp_listen_pool_ready_head;
+        while ((current_ptr) && (current_ptr != socket_ptr))
+        {
+            previous_ptr =  current_ptr;
+            current_ptr =   current_ptr -> nx_tcp_socket_pool_next;
+        }
+
+        /* Determine if the socket was found.  */
+        if (current_ptr)
+        {
+
+            /* Unlink the socket.  */
+            if (previous_ptr)
+            {
+                previous_ptr -> nx_tcp_socket_pool_next =  socket_ptr -> nx_tcp_socket_pool_next;
+            }
+            else
+            {
+                listen_ptr -> nx_tcp_listen_pool_ready_head =  socket_ptr -> nx_tcp_socket_pool_next;
+            }
+
+            /* Determine if the tail needs to be adjusted.  */
+            if (listen_ptr -> nx_tcp_listen_pool_ready_tail == socket_ptr)
+            {
+                listen_ptr -> nx_tcp_listen_pool_ready_tail =  previous_ptr;
+            }
+            listen_ptr -> nx_tcp_listen_pool_ready_count--;
+        }
+    }
+
+    /* Remove the socket from the port, if it is still bound.  */
+    if (socket_ptr -> nx_tcp_socket_bound_next)
+    {
+        _nx_tcp_server_socket_unaccept(socket_ptr);
+    }
+
+    /* Place the socket back on the free list.  */
+    socket_ptr -> nx_tcp_socket_pool_state =  NX_TCP_POOL_SOCKET_FREE;
+    socket_ptr -> nx_tcp_socket_pool_next =   listen_ptr -> nx_tcp_listen_pool_free_head;
+    listen_ptr -> nx_tcp_listen_pool_free_head =  socket_ptr;
+
+    /* Arm the listen request if it is waiting for a socket.  */
+    _nx_tcp_server_socket_pool_arm(socket_ptr -> nx_tcp_socket_ip_ptr, listen_ptr);
+
+    /* Wake a thread waiting in nx_tcp_server_socket_pool_accept, if any, so it checks
+       the pool again.  */
+    _nx_tcp_socket_thread_resume(&(listen_ptr -> nx_tcp_listen_pool_suspension_list), NX_SUCCESS);
+}
+#endif /* NX_ENABLE_TCP_ACCEPT_POOL */
+
@@ -0,0 +1,148 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_server_socket_pool_release                  PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns a socket that was accepted from an accept pool*/
+/*    to the free list of the pool, after its connection has been         */
+/*    disconnected.  The socket is removed from the port, and the listen  */
+/*    request is armed with it if it is waiting for a socket.             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to server socket      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Obtain protection mutex       */
+/*    tx_mutex_put                          Release protection mutex      */
+/*    _nx_tcp_server_socket_unaccept        Remove socket from port       */
+/*    _nx_tcp_server_socket_pool_arm        Arm listen request from pool  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tcp_server_socket_pool_release(NX_TCP_SOCKET *socket_ptr)
+{
+#ifdef NX_ENABLE_TCP_ACCEPT_POOL
+
+struct NX_TCP_LISTEN_STRUCT *listen_ptr;
+NX_IP                       *ip_ptr;
+UINT                         status;
+
+
+    /* Pickup the associated IP structure.  */
+    ip_ptr =  socket_ptr -> nx_tcp_socket_ip_ptr;
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_TCP_SERVER_SOCKET_POOL_RELEASE, ip_ptr, socket_ptr, socket_ptr -> nx_tcp_socket_state, 0, NX_TRACE_TCP_EVENTS, 0, 0)
+
+    /* Obtain the IP protection.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Pickup the listen request of the pool.  */
+    listen_ptr =  socket_ptr -> nx_tcp_socket_pool_listen;
+
+    /* Determine if the socket was accepted from a pool.  */
+    if ((listen_ptr == NX_NULL) ||
+        (socket_ptr -> nx_tcp_socket_pool_state != NX_TCP_POOL_SOCKET_ACCEPTED))
+    {
+
+        /* Release the protection.  */
+        tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+        /* Return an invalid socket error.  */
+        return(NX_INVALID_SOCKET);
+    }
+
+    /* Determine if the socket still has to be removed from the port.  */
+    if ((socket_ptr -> nx_tcp_socket_state != NX_TCP_CLOSED) ||
+        (socket_ptr -> nx_tcp_socket_bound_next))
+    {
+
+        /* Remove the socket from the port.  This fails if the connection is still active.  */
+        status =  _nx_tcp_server_socket_unaccept(socket_ptr);
+
+        /* Determine if the socket was removed.  */
+        if (status != NX_SUCCESS)
+        {
+
+            /* Release the protection.  */
+            tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+            /* Return the error code.  */
+            return(status);
+        }
+    }
+
+    /* Place the socket back on the free list.  */
+    socket_ptr -> nx_tcp_socket_pool_state =  NX_TCP_POOL_SOCKET_FREE;
+    socket_ptr -> nx_tcp_socket_pool_next =   listen_ptr -> nx_tcp_listen_pool_free_head;
+    listen_ptr -> nx_tcp_listen_pool_free_head =  socket_ptr;
+
+    /* Arm the listen request if it is waiting for a socket.  */
+    _nx_tcp_server_socket_pool_arm(ip_ptr, listen_ptr);
+
+    /* Release the protection.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Return success.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_TCP_ACCEPT_POOL */
+    NX_PARAMETER_NOT_USED(socket_ptr);
+
+    return(NX_NOT_SUPPORTED);
+#endif /* NX_ENABLE_TCP_ACCEPT_POOL */
+}
+
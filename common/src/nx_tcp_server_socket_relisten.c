@@ -58,6 +58,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_ip_port_bitmap_set                Mark port in use              */
 /*    _nx_packet_release                    Release packet                */
 /*    tx_mutex_get                          Obtain protection mutex       */
 /*    tx_mutex_put                          Release protection mutex      */
@@ -298,6 +299,11 @@ VOID                       (*listen_callback)(NX_TCP_SOCKET *socket_ptr, UINT po
                         ip_ptr -> nx_ip_tcp_port_table[index] =       socket_ptr;
                     }
 
+#ifdef NX_ENABLE_EPHEMERAL_PORT_BITMAP
+                    /* Mark the port as in use in the ephemeral port bitmap.  */
+                    _nx_ip_port_bitmap_set(&(ip_ptr -> nx_ip_tcp_port_bitmap), port);
+#endif /* NX_ENABLE_EPHEMERAL_PORT_BITMAP */
+
                     /* Pickup the listen callback routine.  */
                     listen_callback =  listen_ptr -> nx_tcp_listen_callback;
 
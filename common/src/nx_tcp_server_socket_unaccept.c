@@ -55,6 +55,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_tcp_port_bitmap_release           Release port in bitmap        */
 /*    _nx_tcp_socket_receive_queue_flush    Release all receive packets   */
 /*    tx_mutex_get                          Obtain a protection mutex     */
 /*    tx_mutex_put                          Release a protection mutex    */
@@ -196,6 +197,11 @@ UINT                         port;
         }
     }
 
+#ifdef NX_ENABLE_EPHEMERAL_PORT_BITMAP
+    /* Mark the port as free in the ephemeral port bitmap, unless another socket is still bound to it.  */
+    _nx_tcp_port_bitmap_release(ip_ptr, port);
+#endif /* NX_ENABLE_EPHEMERAL_PORT_BITMAP */
+
     /* If trace is enabled, insert this event into the trace buffer.  */
     NX_TRACE_IN_LINE_INSERT(NX_TRACE_INTERNAL_TCP_STATE_CHANGE, ip_ptr, socket_ptr, socket_ptr -> nx_tcp_socket_state, NX_TCP_CLOSED, NX_TRACE_INTERNAL_EVENTS, 0, 0)
 
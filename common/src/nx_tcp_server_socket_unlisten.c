@@ -59,6 +59,9 @@
 /*    _nx_packet_release                    Release queued connection     */
 /*    tx_mutex_get                          Obtain protection mutex       */
 /*    tx_mutex_put                          Release protection mutex      */
+/*    _nx_tcp_socket_thread_resume          Resume accept pool waiters    */
+/*    _nx_tcp_socket_disconnect             Reset unaccepted pool socket  */
+/*    _nx_tcp_server_socket_unaccept        Unbind unaccepted pool socket */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -79,6 +82,10 @@ NX_PACKET                   *packet_ptr;
 NX_PACKET                   *next_packet_ptr;
 ULONG                        queue_count;
 struct NX_TCP_LISTEN_STRUCT *listen_ptr;
+#ifdef NX_ENABLE_TCP_ACCEPT_POOL
+UINT                         i;
+UINT                         pool_state;
+#endif /* NX_ENABLE_TCP_ACCEPT_POOL */
 
 
     /* If trace is enabled, insert this event into the trace buffer.  */
@@ -128,6 +135,53 @@ struct NX_TCP_LISTEN_STRUCT *listen_ptr;
                     }
                 }
 
+#ifdef NX_ENABLE_TCP_ACCEPT_POOL
+                /* Detach the sockets of the accept pool, if any.  Sockets the application
+                   accepted are left to it.  The connections of sockets still in the handshake
+                   or waiting to be accepted have no owner once the pool is gone, so they are
+                   reset and the sockets removed from the port, leaving every socket the
+                   application did not accept closed and unbound.  */
+                for (i = 0; i < listen_ptr -> nx_tcp_listen_pool_count; i++)
+                {
+
+                    socket_ptr =  listen_ptr -> nx_tcp_listen_pool_sockets[i];
+                    pool_state =  socket_ptr -> nx_tcp_socket_pool_state;
+                    socket_ptr -> nx_tcp_socket_pool_listen =  NX_NULL;
+                    socket_ptr -> nx_tcp_socket_pool_next =    NX_NULL;
+                    socket_ptr -> nx_tcp_socket_pool_state =   0;
+
+                    /* Determine if the socket is bound to a connection the application
+                       has not accepted.  */
+                    if (((pool_state == NX_TCP_POOL_SOCKET_PENDING) || (pool_state == NX_TCP_POOL_SOCKET_READY)) &&
+                        (socket_ptr -> nx_tcp_socket_bound_next))
+                    {
+
+                        /* Reset the connection, if it is still active.  */
+                        if (socket_ptr -> nx_tcp_socket_state > NX_TCP_LISTEN_STATE)
+                        {
+                            _nx_tcp_socket_disconnect(socket_ptr, NX_NO_WAIT);
+                        }
+
+                        /* Remove the socket from the port.  */
+                        _nx_tcp_server_socket_unaccept(socket_ptr);
+                    }
+                }
+
+                /* Clear the accept pool.  */
+                listen_ptr -> nx_tcp_listen_pool_sockets =     NX_NULL;
+                listen_ptr -> nx_tcp_listen_pool_count =       0;
+                listen_ptr -> nx_tcp_listen_pool_free_head =   NX_NULL;
+                listen_ptr -> nx_tcp_listen_pool_ready_head =  NX_NULL;
+                listen_ptr -> nx_tcp_listen_pool_ready_tail =  NX_NULL;
+                listen_ptr -> nx_tcp_listen_pool_ready_count = 0;
+
+                /* Wake all threads waiting for a connection on the accept pool.  */
+                while (listen_ptr -> nx_tcp_listen_pool_suspension_list)
+                {
+                    _nx_tcp_socket_thread_resume(&(listen_ptr -> nx_tcp_listen_pool_suspension_list), NX_ENTRY_NOT_FOUND);
+                }
+#endif /* NX_ENABLE_TCP_ACCEPT_POOL */
+
                 /* Add the listen request back to the available list.  */
                 listen_ptr -> nx_tcp_listen_next =  ip_ptr -> nx_ip_tcp_available_listen_requests;
                 ip_ptr -> nx_ip_tcp_available_listen_requests =  listen_ptr;
@@ -65,6 +65,7 @@
 /*                                            the receive queue           */
 /*    _nx_tcp_transmit_cleanup              Resume threads suspended on   */
 /*                                            the transmit queue          */
+/*    _nx_tcp_server_socket_pool_reclaim    Reclaim accept pool socket    */
 /*    (application disconnect callback)                                   */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -176,5 +177,11 @@ UINT saved_state;
         (socket_ptr -> nx_tcp_disconnect_complete_notify)(socket_ptr);
     }
 #endif
+
+#ifdef NX_ENABLE_TCP_ACCEPT_POOL
+
+    /* Return the socket to its accept pool if the application had not accepted it yet.  */
+    _nx_tcp_server_socket_pool_reclaim(socket_ptr);
+#endif /* NX_ENABLE_TCP_ACCEPT_POOL */
 }
 
@@ -114,7 +114,8 @@ NX_TCP_SOCKET *tail_ptr;
     /* Save the type of service input parameter.  */
     socket_ptr -> nx_tcp_socket_type_of_service =  type_of_service;
 
-    /* Save the fragment input parameter.  */
+    /* Save the fragment input parameter.  Path MTU discovery only probes the path of
+       sockets created with NX_DONT_FRAGMENT.  */
     socket_ptr -> nx_tcp_socket_fragment_enable =  fragment & NX_DONT_FRAGMENT;
 
     /* Save the time-to-live input parameter.  */
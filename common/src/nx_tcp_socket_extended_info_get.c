@@ -0,0 +1,188 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+#include "nx_tcp.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_extended_info_get                    PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function fills in a snapshot of the TCP socket's connection,   */
+/*    congestion control, round trip time and queue state.  The whole     */
+/*    snapshot is taken under IP protection so the values are consistent  */
+/*    with each other.  The cost is bounded by the depth of the socket's  */
+/*    receive queue, which is walked to separate in-order data from       */
+/*    out-of-order segments.                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to the TCP socket     */
+/*    info_ptr                              Destination for the socket    */
+/*                                            information snapshot        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Obtain protection             */
+/*    tx_mutex_put                          Release protection            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tcp_socket_extended_info_get(NX_TCP_SOCKET *socket_ptr, NX_TCP_SOCKET_INFO *info_ptr)
+{
+
+NX_IP         *ip_ptr;
+NX_PACKET     *packet_ptr;
+NX_TCP_HEADER *tcp_header_ptr;
+ULONG          header_length;
+ULONG          count;
+
+
+    /* Setup IP pointer.  */
+    ip_ptr =  socket_ptr -> nx_tcp_socket_ip_ptr;
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_TCP_SOCKET_EXTENDED_INFO_GET, ip_ptr, socket_ptr, socket_ptr -> nx_tcp_socket_tx_window_congestion, socket_ptr -> nx_tcp_socket_rtt_smoothed >> 3, NX_TRACE_TCP_EVENTS, 0, 0)
+
+    /* Obtain the IP mutex so we can examine the socket.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Pickup the connection state and segment sizes.  */
+    info_ptr -> nx_tcp_socket_info_state =                  socket_ptr -> nx_tcp_socket_state;
+    info_ptr -> nx_tcp_socket_info_mss =                    socket_ptr -> nx_tcp_socket_connect_mss;
+    info_ptr -> nx_tcp_socket_info_peer_mss =               socket_ptr -> nx_tcp_socket_peer_mss;
+
+    /* Pickup the congestion control and window state.  */
+    info_ptr -> nx_tcp_socket_info_congestion_window =      socket_ptr -> nx_tcp_socket_tx_window_congestion;
+    info_ptr -> nx_tcp_socket_info_slow_start_threshold =   socket_ptr -> nx_tcp_socket_tx_slow_start_threshold;
+    info_ptr -> nx_tcp_socket_info_transmit_window =        socket_ptr -> nx_tcp_socket_tx_window_advertised;
+    info_ptr -> nx_tcp_socket_info_receive_window =         socket_ptr -> nx_tcp_socket_rx_window_current;
+    info_ptr -> nx_tcp_socket_info_fast_recovery =          socket_ptr -> nx_tcp_socket_fast_recovery;
+
+    /* Pickup the round trip time estimate, removing the scaling.  */
+    info_ptr -> nx_tcp_socket_info_smoothed_rtt =           socket_ptr -> nx_tcp_socket_rtt_smoothed >> 3;
+    info_ptr -> nx_tcp_socket_info_rtt_variance =           socket_ptr -> nx_tcp_socket_rtt_variance >> 2;
+
+    /* Return the retransmit timeout the stack arms, the configured timeout rate shifted
+       by the backoff of the retries so far.  */
+    info_ptr -> nx_tcp_socket_info_retransmit_timeout =     socket_ptr -> nx_tcp_socket_timeout_rate <<
+        (socket_ptr -> nx_tcp_socket_timeout_retries * socket_ptr -> nx_tcp_socket_timeout_shift);
+
+    /* Pickup the traffic counters.  */
+    info_ptr -> nx_tcp_socket_info_packets_sent =           socket_ptr -> nx_tcp_socket_packets_sent;
+    info_ptr -> nx_tcp_socket_info_bytes_sent =             socket_ptr -> nx_tcp_socket_bytes_sent;
+    info_ptr -> nx_tcp_socket_info_packets_received =       socket_ptr -> nx_tcp_socket_packets_received;
+    info_ptr -> nx_tcp_socket_info_bytes_received =         socket_ptr -> nx_tcp_socket_bytes_received;
+    info_ptr -> nx_tcp_socket_info_checksum_errors =        socket_ptr -> nx_tcp_socket_checksum_errors;
+
+    /* Pickup the retransmission counters.  */
+    info_ptr -> nx_tcp_socket_info_retransmit_packets =     socket_ptr -> nx_tcp_socket_retransmit_packets;
+    info_ptr -> nx_tcp_socket_info_retransmit_timeouts =    socket_ptr -> nx_tcp_socket_retransmit_timeouts;
+    info_ptr -> nx_tcp_socket_info_fast_retransmits =       socket_ptr -> nx_tcp_socket_fast_retransmits;
+    info_ptr -> nx_tcp_socket_info_rack_retransmits =       socket_ptr -> nx_tcp_socket_rack_retransmits;
+    info_ptr -> nx_tcp_socket_info_tail_loss_probes =       socket_ptr -> nx_tcp_socket_tail_loss_probes;
+
+    /* Pickup the duplicate ACK counters.  */
+    info_ptr -> nx_tcp_socket_info_duplicated_acks_current = socket_ptr -> nx_tcp_socket_duplicated_ack_received;
+    info_ptr -> nx_tcp_socket_info_duplicated_acks =        socket_ptr -> nx_tcp_socket_duplicated_acks;
+
+    /* Pickup the zero window counters.  */
+    info_ptr -> nx_tcp_socket_info_zero_window_probes =     socket_ptr -> nx_tcp_socket_zero_window_probes;
+    info_ptr -> nx_tcp_socket_info_zero_window_received =   socket_ptr -> nx_tcp_socket_zero_window_received;
+
+    /* Pickup the transmit queue state.  */
+    info_ptr -> nx_tcp_socket_info_transmit_queue_packets = socket_ptr -> nx_tcp_socket_transmit_sent_count;
+    info_ptr -> nx_tcp_socket_info_transmit_queue_bytes =   socket_ptr -> nx_tcp_socket_tx_outstanding_bytes;
+
+    /* Clear the receive queue state.  */
+    info_ptr -> nx_tcp_socket_info_receive_queue_packets =  0;
+    info_ptr -> nx_tcp_socket_info_receive_queue_bytes =    0;
+    info_ptr -> nx_tcp_socket_info_out_of_order_packets =   0;
+    info_ptr -> nx_tcp_socket_info_out_of_order_bytes =     0;
+
+    /* Walk the receive queue.  Packets carry their TCP header, which has already been
+       converted to host byte order.  Packets that are ready for retrieval are in order, anything else is
+       waiting for a hole in the sequence space to be filled.  */
+    packet_ptr =  socket_ptr -> nx_tcp_socket_receive_queue_head;
+    count =       socket_ptr -> nx_tcp_socket_receive_queue_count;
+    while ((packet_ptr) && (count--))
+    {
+
+        /* Compute the size of the TCP header.  */
+        tcp_header_ptr =  (NX_TCP_HEADER *)packet_ptr -> nx_packet_prepend_ptr;
+        header_length =  (tcp_header_ptr -> nx_tcp_header_word_3 >> NX_TCP_HEADER_SHIFT) * sizeof(ULONG);
+
+        /* Determine if this packet is in order.  */
+        if (packet_ptr -> nx_packet_queue_next == (NX_PACKET *)NX_PACKET_READY)
+        {
+
+            /* Yes, account for it as receive data available to the application.  */
+            info_ptr -> nx_tcp_socket_info_receive_queue_packets++;
+            info_ptr -> nx_tcp_socket_info_receive_queue_bytes +=  packet_ptr -> nx_packet_length - header_length;
+        }
+        else
+        {
+
+            /* No, the packet is held out of order.  */
+            info_ptr -> nx_tcp_socket_info_out_of_order_packets++;
+            info_ptr -> nx_tcp_socket_info_out_of_order_bytes +=  packet_ptr -> nx_packet_length - header_length;
+        }
+
+        /* Move to the next packet.  */
+        packet_ptr =  packet_ptr -> nx_packet_tcp_queue_next;
+    }
+
+    /* Release protection.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Return successful completion status.  */
+    return(NX_SUCCESS);
+}
+
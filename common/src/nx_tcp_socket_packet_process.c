@@ -96,6 +96,9 @@ ULONG         rx_sequence;
 ULONG         rx_window;
 UINT          outside_of_window;
 ULONG         mss = 0;
+#ifndef NX_DISABLE_TCP_INFO
+ULONG         tx_window_previous;
+#endif
 
     /* Copy the TCP header, since the actual packet can be delivered to
        a waiting socket/thread during this routine and before we are done
@@ -248,6 +251,11 @@ ULONG         mss = 0;
         }
     }
 
+#ifndef NX_DISABLE_TCP_INFO
+    /* Remember the peer's advertised window so a window closing can be detected.  */
+    tx_window_previous =  socket_ptr -> nx_tcp_socket_tx_window_advertised;
+#endif
+
     /* Process relative to the state of the socket.  */
     switch (socket_ptr -> nx_tcp_socket_state)
     {
@@ -397,6 +405,17 @@ ULONG         mss = 0;
         break;
     }
 
+#ifndef NX_DISABLE_TCP_INFO
+    /* Determine if the peer has just closed its receive window.  */
+    if ((tx_window_previous) && (socket_ptr -> nx_tcp_socket_tx_window_advertised == 0) &&
+        (socket_ptr -> nx_tcp_socket_state >= NX_TCP_ESTABLISHED))
+    {
+
+        /* Increment the zero window received count for the socket.  */
+        socket_ptr -> nx_tcp_socket_zero_window_received++;
+    }
+#endif
+
     /* Check for an URG (urgent) bit set.  */
     if (tcp_header_copy.nx_tcp_header_word_3 & NX_TCP_URG_BIT)
     {
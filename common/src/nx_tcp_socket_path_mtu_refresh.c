@@ -0,0 +1,124 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+#include "nx_tcp.h"
+
+
+#ifdef NX_ENABLE_IP_PATH_MTU_DISCOVERY
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_path_mtu_refresh                     PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function recomputes the path MTU to the peer of a connected TCP*/
+/*    socket and its connect MSS, which is the smallest of the MSS allowed*/
+/*    by the path MTU, the MSS advertised by the peer and the MSS         */
+/*    configured for the socket. It is called when the connection is      */
+/*    established and whenever the path MTU cache generation changes.     */
+/*                                                                        */
+/*    The caller must hold the IP protection mutex.                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to TCP socket         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_path_mtu_get                   Get path MTU to destination   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_packet_process                Process incoming packet       */
+/*    _nx_tcp_packet_send_syn               Send SYN packet               */
+/*    _nx_tcp_socket_retransmit             Retransmit packets            */
+/*    _nx_tcp_socket_send                   Send data packet              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_socket_path_mtu_refresh(NX_TCP_SOCKET *socket_ptr)
+{
+
+NX_IP *ip_ptr;
+ULONG  mss;
+
+
+    /* Setup the pointer to the associated IP instance.  */
+    ip_ptr =  socket_ptr -> nx_tcp_socket_ip_ptr;
+
+    /* Record the generation of the path MTU cache being used.  */
+    socket_ptr -> nx_tcp_socket_path_mtu_generation =  ip_ptr -> nx_ip_path_mtu_generation;
+
+    /* Determine if the socket has an outgoing interface.  */
+    if (socket_ptr -> nx_tcp_socket_connect_interface == NX_NULL)
+    {
+        return;
+    }
+
+    /* Pickup the path MTU to the peer.  */
+    socket_ptr -> nx_tcp_socket_path_mtu =
+        _nx_ip_path_mtu_get(ip_ptr, socket_ptr -> nx_tcp_socket_connect_ip,
+                            socket_ptr -> nx_tcp_socket_connect_interface -> nx_interface_ip_mtu_size);
+
+    /* Compute the MSS the path MTU allows.  */
+    mss =  socket_ptr -> nx_tcp_socket_path_mtu - sizeof(NX_IP_HEADER) - sizeof(NX_TCP_HEADER);
+
+    /* The MSS can not be larger than the one advertised by the peer.  */
+    if (mss > socket_ptr -> nx_tcp_socket_peer_mss)
+    {
+        mss =  socket_ptr -> nx_tcp_socket_peer_mss;
+    }
+
+    /* Nor larger than the custom MSS of the socket.  */
+    if ((mss > socket_ptr -> nx_tcp_socket_mss) && socket_ptr -> nx_tcp_socket_mss)
+    {
+        mss =  socket_ptr -> nx_tcp_socket_mss;
+    }
+
+    /* Update the connect MSS and the SMSS * SMSS value.  */
+    socket_ptr -> nx_tcp_socket_connect_mss =   mss;
+    socket_ptr -> nx_tcp_socket_connect_mss2 =  mss * mss;
+}
+#endif /* NX_ENABLE_IP_PATH_MTU_DISCOVERY */
+
@@ -0,0 +1,161 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+#include "nx_tcp.h"
+
+
+#ifdef NX_ENABLE_TCP_RACK_TLP
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_rack_loss_detect                     PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function applies RACK time based loss detection (RFC 8985) to  */
+/*    the segment at the head of the transmit sent queue when a duplicate */
+/*    ACK is received.  Without SACK, the n-th duplicate ACK is taken as  */
+/*    delivery of the n-th segment sent after the head.  The head is lost */
+/*    once a segment sent after it has been delivered and a reordering    */
+/*    window of a quarter of the minimum RTT has passed.  If the head is  */
+/*    not yet lost, the reordering timeout is started so the check        */
+/*    completes without waiting for another ACK.                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to owning socket      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                NX_TRUE if the head segment is*/
+/*                                            lost                        */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_time_get                           Get current time              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_state_ack_check        Process ACK number            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_tcp_socket_rack_loss_detect(NX_TCP_SOCKET *socket_ptr)
+{
+
+NX_PACKET *head_ptr;
+NX_PACKET *delivered_ptr;
+UINT       count;
+ULONG      current_time;
+ULONG      rack_rtt;
+ULONG      reordering_window;
+ULONG      elapsed;
+
+
+    /* Pickup the head of the transmit queue.  */
+    head_ptr =  socket_ptr -> nx_tcp_socket_transmit_sent_head;
+
+    /* Determine if the head has been transmitted.  */
+    if ((head_ptr == NX_NULL) || (head_ptr -> nx_packet_queue_next != (NX_PACKET *)NX_DRIVER_TX_DONE))
+    {
+
+        /* No, nothing can be lost.  */
+        return(NX_FALSE);
+    }
+
+    /* Find the segment whose delivery is reported by the duplicate ACKs.  */
+    delivered_ptr =  head_ptr;
+    for (count = 0; count < socket_ptr -> nx_tcp_socket_duplicated_ack_received; count++)
+    {
+
+        /* Move to the next segment.  */
+        delivered_ptr =  delivered_ptr -> nx_packet_tcp_queue_next;
+
+        /* Determine if there are more duplicate ACKs than segments after the head.  */
+        if (delivered_ptr == (NX_PACKET *)NX_PACKET_ENQUEUED)
+        {
+
+            /* Yes, these ACKs do not report delivery of new data.  */
+            return(NX_FALSE);
+        }
+    }
+
+    /* Determine if the head was transmitted after the delivered segment, which happens
+       when the head itself has been retransmitted.  */
+    if ((LONG)(delivered_ptr -> nx_packet_tcp_transmit_time - head_ptr -> nx_packet_tcp_transmit_time) < 0)
+    {
+
+        /* Yes, wait for the retransmission to be acknowledged.  */
+        return(NX_FALSE);
+    }
+
+    /* Pickup the current time.  */
+    current_time =  tx_time_get();
+
+    /* The RTT of the delivered segment.  */
+    rack_rtt =  current_time - delivered_ptr -> nx_packet_tcp_transmit_time;
+
+    /* The reordering window is a quarter of the minimum RTT, but at least one tick.  */
+    reordering_window =  socket_ptr -> nx_tcp_socket_rtt_minimum >> 2;
+    if (reordering_window == 0)
+    {
+        reordering_window =  1;
+    }
+
+    /* Compute how long the head has been outstanding.  */
+    elapsed =  current_time - head_ptr -> nx_packet_tcp_transmit_time;
+
+    /* Determine if the head has been outstanding longer than the RTT of the delivered
+       segment plus the reordering window.  */
+    if (elapsed >= (rack_rtt + reordering_window))
+    {
+
+        /* Yes, the head is lost.  */
+        socket_ptr -> nx_tcp_socket_rack_timeout =  0;
+        return(NX_TRUE);
+    }
+
+    /* Not yet.  Start the reordering timeout for the remainder of the window.  */
+    socket_ptr -> nx_tcp_socket_rack_timeout =  rack_rtt + reordering_window - elapsed;
+
+    /* Return to caller.  */
+    return(NX_FALSE);
+}
+#endif /* NX_ENABLE_TCP_RACK_TLP */
+
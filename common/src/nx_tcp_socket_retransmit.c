@@ -49,7 +49,8 @@
 /*                                                                        */
 /*    ip_ptr                                IP instance pointer           */
 /*    socket_ptr                            Pointer to owning socket      */
-/*    need_fast_retransmit                  Need fast retransmit or not   */
+/*    need_fast_retransmit                  Need fast retransmit or not,  */
+/*                                            or NX_TCP_RACK_RETRANSMIT   */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -58,6 +59,9 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_ip_packet_send                    Resend the transmit packet    */
+/*    _nx_ip_transmit_burst_end             End transmit burst            */
+/*    _nx_tcp_socket_path_mtu_refresh       Refresh MSS from path MTU     */
+/*    tx_time_get                           Get current time              */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -98,6 +102,11 @@ ULONG      available;
             (socket_ptr -> nx_tcp_socket_timeout_retries *
              socket_ptr -> nx_tcp_socket_timeout_shift);
 
+#ifndef NX_DISABLE_TCP_INFO
+        /* Increment the zero window probe count for the socket.  */
+        socket_ptr -> nx_tcp_socket_zero_window_probes++;
+#endif
+
         /* Send the zero window probe.  */
         _nx_tcp_packet_send_ack(socket_ptr, socket_ptr -> nx_tcp_socket_tx_sequence);
 
@@ -108,6 +117,38 @@ ULONG      available;
     /* Increment the retry counter.  */
     socket_ptr -> nx_tcp_socket_timeout_retries++;
 
+    /* Determine if this retransmission is triggered by RACK-TLP loss detection.  */
+    if (need_fast_retransmit == NX_TCP_RACK_RETRANSMIT)
+    {
+
+#ifndef NX_DISABLE_TCP_INFO
+        /* Increment the RACK retransmit count for the socket.  */
+        socket_ptr -> nx_tcp_socket_rack_retransmits++;
+#endif
+
+        /* From here on, it is handled like a fast retransmit.  */
+        need_fast_retransmit =  NX_TRUE;
+    }
+#ifndef NX_DISABLE_TCP_INFO
+    else if (need_fast_retransmit == NX_TRUE)
+    {
+
+        /* Retransmission triggered by duplicate ACKs, increment the fast retransmit
+           count for the socket.  */
+        socket_ptr -> nx_tcp_socket_fast_retransmits++;
+    }
+#endif
+
+    /* Retransmitted data can not be used for round trip time measurement, since the
+       ACK is ambiguous.  Karn's algorithm.  */
+    socket_ptr -> nx_tcp_socket_rtt_timing =  NX_FALSE;
+
+#ifdef NX_ENABLE_TCP_RACK_TLP
+    /* The retransmission supersedes any pending reordering or probe timeout.  */
+    socket_ptr -> nx_tcp_socket_rack_timeout =  0;
+    socket_ptr -> nx_tcp_socket_tlp_timeout =   0;
+#endif /* NX_ENABLE_TCP_RACK_TLP */
+
     if ((need_fast_retransmit == NX_TRUE) || (socket_ptr -> nx_tcp_socket_fast_recovery == NX_FALSE))
     {
 
@@ -150,9 +191,22 @@ ULONG      available;
     /* Get available size of packet that can be sent. */
     available = socket_ptr -> nx_tcp_socket_tx_window_congestion;
 
+#ifdef NX_ENABLE_IP_PATH_MTU_DISCOVERY
+    /* Determine if the path MTU cache has changed since the connect MSS was computed.  */
+    if (socket_ptr -> nx_tcp_socket_path_mtu_generation != ip_ptr -> nx_ip_path_mtu_generation)
+    {
+
+        /* Yes, refresh the path MTU so oversized segments are sent fragmentable.  */
+        _nx_tcp_socket_path_mtu_refresh(socket_ptr);
+    }
+#endif /* NX_ENABLE_IP_PATH_MTU_DISCOVERY */
+
     /* Pickup the head of the transmit queue.  */
     packet_ptr =  socket_ptr -> nx_tcp_socket_transmit_sent_head;
 
+    /* Hand the retransmitted packets to the driver as one burst.  */
+    NX_IP_TRANSMIT_BURST_START(ip_ptr);
+
     /* Determine if the packet has been released by the
        application I/O driver.  */
     while (packet_ptr && (packet_ptr -> nx_packet_queue_next == (NX_PACKET *)NX_DRIVER_TX_DONE))
@@ -184,6 +238,11 @@ ULONG      available;
         /* Clear the queue next pointer.  */
         packet_ptr -> nx_packet_queue_next =  NX_NULL;
 
+#ifdef NX_ENABLE_TCP_RACK_TLP
+        /* Record the transmit time.  */
+        packet_ptr -> nx_packet_tcp_transmit_time =  tx_time_get();
+#endif /* NX_ENABLE_TCP_RACK_TLP */
+
         /* Yes, the driver has finished with the packet at the head of the
            transmit sent list... so it can be sent again!  */
 
@@ -191,7 +250,7 @@ ULONG      available;
            transmit sent list... so it can be sent again!  */
         _nx_ip_packet_send(ip_ptr, packet_ptr,  socket_ptr -> nx_tcp_socket_connect_ip,
                            socket_ptr -> nx_tcp_socket_type_of_service, socket_ptr -> nx_tcp_socket_time_to_live, NX_IP_TCP,
-                           socket_ptr -> nx_tcp_socket_fragment_enable);
+                           NX_TCP_SOCKET_FRAGMENT(socket_ptr, packet_ptr));
 
         /* Move to next packet. */
         /* During fast recovery, only one packet is retransmitted at once. */
@@ -206,5 +265,8 @@ ULONG      available;
             packet_ptr = next_ptr;
         }
     }
+
+    /* End the burst, flushing the driver.  */
+    NX_IP_TRANSMIT_BURST_END(ip_ptr);
 }
 
@@ -0,0 +1,121 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_rtt_update                           PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function folds a new round trip time sample into the socket's  */
+/*    smoothed RTT and RTT variance, RFC 6298 Section 2.  The smoothed    */
+/*    RTT is kept scaled by 8 and the variance scaled by 4 so the update  */
+/*    only needs shifts.                                                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to owning socket      */
+/*    rtt                                   RTT sample in timer ticks     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_state_ack_check        Process ACK number            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_socket_rtt_update(NX_TCP_SOCKET *socket_ptr, ULONG rtt)
+{
+
+LONG delta;
+
+
+    /* Samples shorter than the timer resolution are counted as one tick, so that a
+       zero smoothed RTT always means no sample has been taken.  */
+    if (rtt == 0)
+    {
+        rtt =  1;
+    }
+
+    /* Determine if this is the first sample.  */
+    if (socket_ptr -> nx_tcp_socket_rtt_smoothed == 0)
+    {
+
+        /* Yes, SRTT = R, RTTVAR = R/2.  */
+        socket_ptr -> nx_tcp_socket_rtt_smoothed =  rtt << 3;
+        socket_ptr -> nx_tcp_socket_rtt_variance =  rtt << 1;
+    }
+    else
+    {
+
+        /* SRTT = 7/8 SRTT + 1/8 R.  */
+        delta =  (LONG)rtt - (LONG)(socket_ptr -> nx_tcp_socket_rtt_smoothed >> 3);
+        socket_ptr -> nx_tcp_socket_rtt_smoothed =  (ULONG)((LONG)socket_ptr -> nx_tcp_socket_rtt_smoothed + delta);
+
+        /* RTTVAR = 3/4 RTTVAR + 1/4 |SRTT - R|.  */
+        if (delta < 0)
+        {
+            delta =  -delta;
+        }
+        socket_ptr -> nx_tcp_socket_rtt_variance =  socket_ptr -> nx_tcp_socket_rtt_variance + (ULONG)delta -
+            (socket_ptr -> nx_tcp_socket_rtt_variance >> 2);
+    }
+
+#ifdef NX_ENABLE_TCP_RACK_TLP
+    /* Track the minimum RTT, which sizes the RACK reordering window.  */
+    if ((socket_ptr -> nx_tcp_socket_rtt_minimum == 0) || (rtt < socket_ptr -> nx_tcp_socket_rtt_minimum))
+    {
+        socket_ptr -> nx_tcp_socket_rtt_minimum =  rtt;
+    }
+#endif /* NX_ENABLE_TCP_RACK_TLP */
+
+    /* The timed segment has been sampled.  */
+    socket_ptr -> nx_tcp_socket_rtt_timing =  NX_FALSE;
+}
+
@@ -61,8 +61,11 @@
 /*    _nx_ip_packet_send                    Packet send function          */
 /*    _nx_tcp_checksum                      Calculate TCP checksum        */
 /*    _nx_tcp_socket_thread_suspend         Suspend calling thread        */
+/*    _nx_tcp_socket_tlp_timeout_set        Schedule tail loss probe      */
+/*    _nx_tcp_socket_transmit_index_append  Record packet in queue index  */
 /*    tx_mutex_get                          Get protection mutex          */
 /*    tx_mutex_put                          Put protection mutex          */
+/*    tx_time_get                           Get current time              */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -140,6 +143,9 @@ ULONG          tx_window_current;
     /* Set the outgoing interface.  It should have been set for this socket. */
     packet_ptr -> nx_packet_ip_interface = socket_ptr -> nx_tcp_socket_connect_interface;
     packet_ptr -> nx_packet_next_hop_address = socket_ptr -> nx_tcp_socket_next_hop_address;
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+    packet_ptr -> nx_packet_destination_cache = &(socket_ptr -> nx_tcp_socket_destination_cache);
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
 
     /* Prepend the TCP header to the packet.  First, make room for the TCP header.  */
     packet_ptr -> nx_packet_prepend_ptr =  packet_ptr -> nx_packet_prepend_ptr - sizeof(NX_TCP_HEADER);
@@ -301,9 +307,29 @@ ULONG          tx_window_current;
         /* Increment the packet sent count.  */
         socket_ptr -> nx_tcp_socket_transmit_sent_count++;
 
+#ifdef NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX
+        /* Record the packet in the transmit queue index.  */
+        _nx_tcp_socket_transmit_index_append(socket_ptr, packet_ptr -> nx_packet_length - sizeof(NX_TCP_HEADER));
+#endif /* NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX */
+
         /* Increase the transmit outstanding byte count. */
         socket_ptr -> nx_tcp_socket_tx_outstanding_bytes +=
             (packet_ptr -> nx_packet_length - sizeof(NX_TCP_HEADER));
+
+        /* Start timing this segment if no other segment is being timed.  */
+        if (socket_ptr -> nx_tcp_socket_rtt_timing == NX_FALSE)
+        {
+            socket_ptr -> nx_tcp_socket_rtt_timing =      NX_TRUE;
+            socket_ptr -> nx_tcp_socket_rtt_sequence =    socket_ptr -> nx_tcp_socket_tx_sequence;
+            socket_ptr -> nx_tcp_socket_rtt_start_time =  tx_time_get();
+        }
+
+#ifdef NX_ENABLE_TCP_RACK_TLP
+        /* Record the transmit time and schedule a tail loss probe.  */
+        packet_ptr -> nx_packet_tcp_transmit_time =  tx_time_get();
+        _nx_tcp_socket_tlp_timeout_set(socket_ptr);
+#endif /* NX_ENABLE_TCP_RACK_TLP */
+
 #ifndef NX_DISABLE_TCP_INFO
         /* Increment the TCP packet sent count and bytes sent count.  */
         ip_ptr -> nx_ip_tcp_packets_sent++;
@@ -319,7 +345,7 @@ ULONG          tx_window_current;
 
         /* Send the TCP packet to the IP component.  */
         _nx_ip_packet_send(ip_ptr, packet_ptr,  socket_ptr -> nx_tcp_socket_connect_ip,
-                           socket_ptr -> nx_tcp_socket_type_of_service, socket_ptr -> nx_tcp_socket_time_to_live, NX_IP_TCP, socket_ptr -> nx_tcp_socket_fragment_enable);
+                           socket_ptr -> nx_tcp_socket_type_of_service, socket_ptr -> nx_tcp_socket_time_to_live, NX_IP_TCP, NX_TCP_SOCKET_FRAGMENT(socket_ptr, packet_ptr));
 
         /* Release the protection.  */
         tx_mutex_put(&(ip_ptr -> nx_ip_protection));
@@ -429,6 +455,9 @@ ULONG          tx_window_current;
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_tcp_socket_send_internal          Transmit TCP payload          */
+/*    _nx_tcp_socket_path_mtu_refresh       Refresh MSS from path MTU     */
+/*    tx_mutex_get                          Obtain protection mutex       */
+/*    tx_mutex_put                          Release protection mutex      */
 /*    _nx_packet_allocate                   Packet allocation for         */
 /*                                            fragmentation               */
 /*    _nx_packet_release                    Packet release                */
@@ -463,6 +492,23 @@ ULONG      fragment_length;
     /* Initialize outcome to successful completion. */
     ret = NX_SUCCESS;
 
+#ifdef NX_ENABLE_IP_PATH_MTU_DISCOVERY
+    /* Setup the pointer to the associated IP instance.  */
+    ip_ptr =  socket_ptr -> nx_tcp_socket_ip_ptr;
+
+    /* Determine if the path MTU cache has changed since the connect MSS of this connection
+       was computed.  */
+    if ((socket_ptr -> nx_tcp_socket_path_mtu_generation != ip_ptr -> nx_ip_path_mtu_generation) &&
+        ((socket_ptr -> nx_tcp_socket_state == NX_TCP_ESTABLISHED) || (socket_ptr -> nx_tcp_socket_state == NX_TCP_CLOSE_WAIT)))
+    {
+
+        /* Yes, recompute the connect MSS under protection.  */
+        tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+        _nx_tcp_socket_path_mtu_refresh(socket_ptr);
+        tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+    }
+#endif /* NX_ENABLE_IP_PATH_MTU_DISCOVERY */
+
     /* MSS size is IP MTU - IP header - optional header - TCP header. */
 
     /* Send the packet directly if it is within MSS size. */
@@ -61,6 +61,11 @@
 /*    _nx_tcp_packet_send_ack               Send ACK message              */
 /*    _nx_packet_release                    Packet release function       */
 /*    _nx_tcp_socket_retransmit             Retransmit packet             */
+/*    _nx_tcp_socket_rtt_update             Update round trip time        */
+/*    _nx_tcp_socket_rack_loss_detect       RACK loss detection           */
+/*    _nx_tcp_socket_tlp_timeout_set        Schedule tail loss probe      */
+/*    _nx_tcp_socket_transmit_index_search  Find packets covered by ACK   */
+/*    tx_time_get                           Get current time              */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -76,17 +81,22 @@
 VOID  _nx_tcp_socket_state_ack_check(NX_TCP_SOCKET *socket_ptr, NX_TCP_HEADER *tcp_header_ptr)
 {
 
+#ifndef NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX
 NX_TCP_HEADER *search_header_ptr;
+#endif /* NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX */
 NX_PACKET     *search_ptr;
 NX_PACKET     *previous_ptr;
+#ifndef NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX
 ULONG          header_length;
 ULONG          search_sequence;
+ULONG          ending_packet_sequence;
+#endif /* NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX */
 ULONG          temp;
 ULONG          packet_release_count;
-ULONG          ending_packet_sequence;
 ULONG          starting_tx_sequence =  0;
 ULONG          ending_tx_sequence =  0;
 ULONG          acked_bytes;
+ULONG          data_length;
 UINT           wrapped_flag =  NX_FALSE;
 
 
@@ -169,6 +179,10 @@ UINT           wrapped_flag =  NX_FALSE;
             if ((search_ptr) && (search_ptr -> nx_packet_queue_next == ((NX_PACKET *)NX_DRIVER_TX_DONE)))
             {
 
+#ifdef NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX
+                /* Pickup the starting sequence number from the transmit queue index.  */
+                starting_tx_sequence =  socket_ptr -> nx_tcp_socket_transmit_index_start;
+#else
                 /* Setup a pointer to header of this packet in the sent list.  */
                 search_header_ptr =  (NX_TCP_HEADER *)search_ptr -> nx_packet_prepend_ptr;
 
@@ -176,6 +190,7 @@ UINT           wrapped_flag =  NX_FALSE;
                 starting_tx_sequence =  search_header_ptr -> nx_tcp_sequence_number;
 
                 NX_CHANGE_ULONG_ENDIAN(starting_tx_sequence);
+#endif /* NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX */
 
                 /* Determine if the incoming ACK matches the front of our transmit queue. If so,
                    decrease the retransmit timeout by 50% in order to improve the retry time.  */
@@ -185,6 +200,28 @@ UINT           wrapped_flag =  NX_FALSE;
                     /* Handle duplicated ACK packet.  */
                     socket_ptr -> nx_tcp_socket_duplicated_ack_received++;
 
+#ifndef NX_DISABLE_TCP_INFO
+                    /* Increment the duplicated ACK count for the socket.  */
+                    socket_ptr -> nx_tcp_socket_duplicated_acks++;
+#endif
+
+#ifdef NX_ENABLE_TCP_RACK_TLP
+                    /* Time based loss detection can mark the head lost before the third
+                       duplicated ACK arrives, RFC 8985.  */
+                    if ((socket_ptr -> nx_tcp_socket_duplicated_ack_received < 3) &&
+                        (socket_ptr -> nx_tcp_socket_fast_recovery == NX_FALSE) &&
+                        (_nx_tcp_socket_rack_loss_detect(socket_ptr) == NX_TRUE))
+                    {
+
+                        /* Retransmit packet immediately and enter fast recovery.  */
+                        _nx_tcp_socket_retransmit(socket_ptr -> nx_tcp_socket_ip_ptr, socket_ptr, NX_TCP_RACK_RETRANSMIT);
+
+                        /* Continue as if the duplicated ACK threshold had been reached, so further
+                           duplicated ACKs inflate the congestion window.  */
+                        socket_ptr -> nx_tcp_socket_duplicated_ack_received = 3;
+                    }
+                    else
+#endif /* NX_ENABLE_TCP_RACK_TLP */
                     if (socket_ptr -> nx_tcp_socket_duplicated_ack_received == 3)
                     {
                         if ((INT)((tcp_header_ptr -> nx_tcp_acknowledgment_number - 1) -
@@ -274,6 +311,43 @@ UINT           wrapped_flag =  NX_FALSE;
             /* See if we can find the sequence number in the sent queue for this socket.  */
             previous_ptr =  NX_NULL;
 
+#ifdef NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX
+            /* Look up the number of packets covered by the ACK in the transmit queue index.  */
+            temp =  _nx_tcp_socket_transmit_index_search(socket_ptr, tcp_header_ptr -> nx_tcp_acknowledgment_number);
+
+            /* Move to the last covered packet.  */
+            while ((search_ptr) && (packet_release_count < temp))
+            {
+
+                /* Determine if the packet has been transmitted.  */
+                if (search_ptr -> nx_packet_queue_next != ((NX_PACKET *)NX_DRIVER_TX_DONE))
+                {
+                    break;
+                }
+
+                /* Increase the packet release count.  */
+                packet_release_count++;
+
+                /* Update this socket's transmit window with the advertised window size in the ACK message.  */
+                socket_ptr -> nx_tcp_socket_tx_window_advertised =  (tcp_header_ptr -> nx_tcp_header_word_3) & NX_LOWER_16_MASK;
+
+#ifdef NX_ENABLE_TCP_WINDOW_SCALING
+                socket_ptr -> nx_tcp_socket_tx_window_advertised <<= socket_ptr -> nx_tcp_snd_win_scale_value;
+#endif /* NX_ENABLE_TCP_WINDOW_SCALING */
+
+                /* Move the search and previous pointers forward.  */
+                previous_ptr =  search_ptr;
+                search_ptr =  search_ptr -> nx_packet_tcp_queue_next;
+
+                /* Determine if we are at the end of the TCP queue.  */
+                if (search_ptr == ((NX_PACKET *)NX_PACKET_ENQUEUED))
+                {
+
+                    /* Yes, set the search pointer to NULL.  */
+                    search_ptr =  NX_NULL;
+                }
+            }
+#else
             while (search_ptr)
             {
 
@@ -391,6 +465,7 @@ UINT           wrapped_flag =  NX_FALSE;
                     search_ptr =  NX_NULL;
                 }
             }
+#endif /* NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX */
         }
 
         /* Determine if anything needs to be released.  */
@@ -469,6 +544,15 @@ UINT           wrapped_flag =  NX_FALSE;
             /* Reset the duplicated ACK counter. */
             socket_ptr -> nx_tcp_socket_duplicated_ack_received = 0;
 
+            /* Determine if this ACK covers the segment being timed.  */
+            if ((socket_ptr -> nx_tcp_socket_rtt_timing) &&
+                ((INT)(tcp_header_ptr -> nx_tcp_acknowledgment_number - socket_ptr -> nx_tcp_socket_rtt_sequence) >= 0))
+            {
+
+                /* Yes, take a round trip time sample.  */
+                _nx_tcp_socket_rtt_update(socket_ptr, tx_time_get() - socket_ptr -> nx_tcp_socket_rtt_start_time);
+            }
+
 
             /* Determine if the packet has been transmitted.  */
             /*lint -e{923} suppress cast of ULONG to pointer.  */
@@ -486,6 +570,10 @@ UINT           wrapped_flag =  NX_FALSE;
             else
             {
 
+#ifdef NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX
+                /* Pickup the starting sequence number from the transmit queue index.  */
+                starting_tx_sequence =  socket_ptr -> nx_tcp_socket_transmit_index_start;
+#else
                 /* Setup a pointer to header of this packet in the sent list.  */
                 /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
                 search_header_ptr =  (NX_TCP_HEADER *)socket_ptr -> nx_tcp_socket_transmit_sent_head -> nx_packet_prepend_ptr;
@@ -493,6 +581,7 @@ UINT           wrapped_flag =  NX_FALSE;
                 /* Pickup the starting sequence number.  */
                 starting_tx_sequence =  search_header_ptr -> nx_tcp_sequence_number;
                 NX_CHANGE_ULONG_ENDIAN(starting_tx_sequence);
+#endif /* NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX */
 
                 /* Set previous cumulative acknowlesgement. */
                 socket_ptr -> nx_tcp_socket_previous_highest_ack = starting_tx_sequence;
@@ -556,6 +645,36 @@ UINT           wrapped_flag =  NX_FALSE;
         }
 
 
+#ifdef NX_ENABLE_TCP_RACK_TLP
+        /* The head of the queue has moved, so cancel the reordering timeout.  */
+        socket_ptr -> nx_tcp_socket_rack_timeout =  0;
+
+        /* Determine if this ACK ends a tail loss probe episode.  */
+        if ((socket_ptr -> nx_tcp_socket_tlp_in_progress == NX_TRUE) &&
+            ((INT)(tcp_header_ptr -> nx_tcp_acknowledgment_number - socket_ptr -> nx_tcp_socket_tlp_end_sequence) >= 0))
+        {
+
+            /* Yes, the episode is over.  */
+            socket_ptr -> nx_tcp_socket_tlp_in_progress =  NX_FALSE;
+
+            /* Without DSACK there is no way to tell whether the probe or the original
+               segment was delivered, so assume the probe repaired a loss and respond to
+               the congestion, RFC 8985 Section 7.4.2.  */
+            if (socket_ptr -> nx_tcp_socket_fast_recovery == NX_FALSE)
+            {
+
+                /* Halve the congestion window, but keep at least 2 * MSS.  */
+                temp =  socket_ptr -> nx_tcp_socket_tx_window_congestion >> 1;
+                if (temp < (socket_ptr -> nx_tcp_socket_connect_mss << 1))
+                {
+                    temp =  socket_ptr -> nx_tcp_socket_connect_mss << 1;
+                }
+                socket_ptr -> nx_tcp_socket_tx_slow_start_threshold =  temp;
+                socket_ptr -> nx_tcp_socket_tx_window_congestion =     temp;
+            }
+        }
+#endif /* NX_ENABLE_TCP_RACK_TLP */
+
         /* Save the front of the of the transmit queue.  */
         search_ptr =  socket_ptr -> nx_tcp_socket_transmit_sent_head;
 
@@ -576,10 +695,20 @@ UINT           wrapped_flag =  NX_FALSE;
             /* Setup a new transmit timeout.  */
             socket_ptr -> nx_tcp_socket_timeout =          socket_ptr -> nx_tcp_socket_timeout_rate;
             socket_ptr -> nx_tcp_socket_timeout_retries =  0;
+
+#ifdef NX_ENABLE_TCP_RACK_TLP
+            /* Data is still outstanding, schedule a tail loss probe.  */
+            _nx_tcp_socket_tlp_timeout_set(socket_ptr);
+#endif /* NX_ENABLE_TCP_RACK_TLP */
         }
         else
         {
 
+#ifdef NX_ENABLE_TCP_RACK_TLP
+            /* Nothing is outstanding, so no probe is needed.  */
+            socket_ptr -> nx_tcp_socket_tlp_timeout =  0;
+#endif /* NX_ENABLE_TCP_RACK_TLP */
+
             /* The transmit list is now cleared, just set the head and tail pointers to
                NULL.  */
             socket_ptr -> nx_tcp_socket_transmit_sent_head  =  NX_NULL;
@@ -620,6 +749,19 @@ UINT           wrapped_flag =  NX_FALSE;
             /* Set the packet to allocated to indicate it is no longer part of the TCP queue.  */
             previous_ptr -> nx_packet_tcp_queue_next =  ((NX_PACKET *)NX_PACKET_ALLOCATED);
 
+#ifdef NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX
+            /* Pickup the data length of this packet from the transmit queue index and
+               remove the packet from the index.  */
+            temp =  socket_ptr -> nx_tcp_socket_transmit_index_end[socket_ptr -> nx_tcp_socket_transmit_index_head];
+            data_length =  temp - socket_ptr -> nx_tcp_socket_transmit_index_start;
+            socket_ptr -> nx_tcp_socket_transmit_index_start =  temp;
+            socket_ptr -> nx_tcp_socket_transmit_index_head++;
+            if (socket_ptr -> nx_tcp_socket_transmit_index_head == NX_TCP_TRANSMIT_QUEUE_INDEX_SIZE)
+            {
+                socket_ptr -> nx_tcp_socket_transmit_index_head =  0;
+            }
+#endif /* NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX */
+
             /* Has the packet been transmitted? This is only pertinent if a retransmit of
                the packet occurred prior to receiving the ACK. If so, the packet could be
                in an ARP queue or in a driver queue waiting for transmission so we can't
@@ -631,14 +773,17 @@ UINT           wrapped_flag =  NX_FALSE;
                 /* Yes, the driver has already released the packet.  */
 
                 /* Open up the transmit window. */
+#ifndef NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX
                 search_header_ptr = (NX_TCP_HEADER *)previous_ptr -> nx_packet_prepend_ptr;
 
                 temp = search_header_ptr -> nx_tcp_header_word_3;
                 NX_CHANGE_ULONG_ENDIAN(temp);
                 header_length = (temp >> NX_TCP_HEADER_SHIFT) * sizeof(ULONG);
-                if (socket_ptr -> nx_tcp_socket_tx_outstanding_bytes > (previous_ptr -> nx_packet_length - header_length))
+                data_length = previous_ptr -> nx_packet_length - header_length;
+#endif /* NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX */
+                if (socket_ptr -> nx_tcp_socket_tx_outstanding_bytes > data_length)
                 {
-                    socket_ptr -> nx_tcp_socket_tx_outstanding_bytes -= previous_ptr -> nx_packet_length - header_length;
+                    socket_ptr -> nx_tcp_socket_tx_outstanding_bytes -= data_length;
                 }
                 else
                 {
@@ -662,6 +807,11 @@ UINT           wrapped_flag =  NX_FALSE;
         if (socket_ptr -> nx_tcp_socket_fast_recovery == NX_TRUE)
         {
 
+#ifndef NX_DISABLE_TCP_INFO
+            /* Increment the fast retransmit count for the socket.  */
+            socket_ptr -> nx_tcp_socket_fast_retransmits++;
+#endif
+
             /* Only partial data are ACKed. Retransmit packet immediately. */
             _nx_tcp_socket_retransmit(socket_ptr -> nx_tcp_socket_ip_ptr, socket_ptr, NX_FALSE);
         }
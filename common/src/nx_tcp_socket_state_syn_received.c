@@ -61,6 +61,7 @@
 /*                                                                        */
 /*    _nx_tcp_socket_thread_resume          Resume suspended thread       */
 /*    _nx_tcp_packet_send_rst               Send RST packet               */
+/*    _nx_tcp_server_socket_pool_reclaim    Reclaim accept pool socket    */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -77,6 +78,9 @@ VOID  _nx_tcp_socket_state_syn_received(NX_TCP_SOCKET *socket_ptr, NX_TCP_HEADER
 {
 UINT window_wrap_flag = NX_FALSE;
 UINT outside_of_window;
+#ifdef NX_ENABLE_TCP_ACCEPT_POOL
+struct NX_TCP_LISTEN_STRUCT *listen_ptr;
+#endif /* NX_ENABLE_TCP_ACCEPT_POOL */
 
 
     /* Determine if the incoming message is an ACK message.  If it is and
@@ -145,6 +149,33 @@ UINT outside_of_window;
         /* Move into the ESTABLISHED state.  */
         socket_ptr -> nx_tcp_socket_state =  NX_TCP_ESTABLISHED;
 
+#ifdef NX_ENABLE_TCP_ACCEPT_POOL
+        /* Pickup the accept pool of this socket, if any.  */
+        listen_ptr =  socket_ptr -> nx_tcp_socket_pool_listen;
+
+        /* Determine if the socket completed a handshake on behalf of an accept pool.  */
+        if ((listen_ptr) && (socket_ptr -> nx_tcp_socket_pool_state == NX_TCP_POOL_SOCKET_PENDING))
+        {
+
+            /* Yes, place the socket at the end of the ready list of the pool.  */
+            socket_ptr -> nx_tcp_socket_pool_state =  NX_TCP_POOL_SOCKET_READY;
+            socket_ptr -> nx_tcp_socket_pool_next =   NX_NULL;
+            if (listen_ptr -> nx_tcp_listen_pool_ready_tail)
+            {
+                (listen_ptr -> nx_tcp_listen_pool_ready_tail) -> nx_tcp_socket_pool_next =  socket_ptr;
+            }
+            else
+            {
+                listen_ptr -> nx_tcp_listen_pool_ready_head =  socket_ptr;
+            }
+            listen_ptr -> nx_tcp_listen_pool_ready_tail =  socket_ptr;
+            listen_ptr -> nx_tcp_listen_pool_ready_count++;
+
+            /* Wake a thread waiting in nx_tcp_server_socket_pool_accept, if any.  */
+            _nx_tcp_socket_thread_resume(&(listen_ptr -> nx_tcp_listen_pool_suspension_list), NX_SUCCESS);
+        }
+#endif /* NX_ENABLE_TCP_ACCEPT_POOL */
+
 #ifndef NX_DISABLE_EXTENDED_NOTIFY_SUPPORT
 
         /* If registered with the TCP socket, call the application's connection completion callback function.  */
@@ -238,6 +269,12 @@ UINT outside_of_window;
 
             /* This socket should not have an active timeout. */
             socket_ptr -> nx_tcp_socket_timeout = 0;
+
+#ifdef NX_ENABLE_TCP_ACCEPT_POOL
+
+            /* Return the socket to its accept pool, if it was completing a handshake for one.  */
+            _nx_tcp_server_socket_pool_reclaim(socket_ptr);
+#endif /* NX_ENABLE_TCP_ACCEPT_POOL */
         }
         else
         {
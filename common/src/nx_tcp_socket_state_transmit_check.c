@@ -59,6 +59,9 @@
 /*                                                                        */
 /*    _nx_ip_packet_send                    Send IP packet                */
 /*    _nx_tcp_socket_thread_resume          Resume suspended thread       */
+/*    _nx_tcp_socket_tlp_timeout_set        Schedule tail loss probe      */
+/*    _nx_tcp_socket_transmit_index_append  Record packet in queue index  */
+/*    tx_time_get                           Get current time              */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -176,6 +179,25 @@ ULONG      tx_window_current;
             socket_ptr -> nx_tcp_socket_tx_sequence =  socket_ptr -> nx_tcp_socket_tx_sequence +
                 (packet_ptr -> nx_packet_length - sizeof(NX_TCP_HEADER));
 
+#ifdef NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX
+            /* Record the packet in the transmit queue index.  */
+            _nx_tcp_socket_transmit_index_append(socket_ptr, packet_ptr -> nx_packet_length - sizeof(NX_TCP_HEADER));
+#endif /* NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX */
+
+            /* Start timing this segment if no other segment is being timed.  */
+            if (socket_ptr -> nx_tcp_socket_rtt_timing == NX_FALSE)
+            {
+                socket_ptr -> nx_tcp_socket_rtt_timing =      NX_TRUE;
+                socket_ptr -> nx_tcp_socket_rtt_sequence =    socket_ptr -> nx_tcp_socket_tx_sequence;
+                socket_ptr -> nx_tcp_socket_rtt_start_time =  tx_time_get();
+            }
+
+#ifdef NX_ENABLE_TCP_RACK_TLP
+            /* Record the transmit time and schedule a tail loss probe.  */
+            packet_ptr -> nx_packet_tcp_transmit_time =  tx_time_get();
+            _nx_tcp_socket_tlp_timeout_set(socket_ptr);
+#endif /* NX_ENABLE_TCP_RACK_TLP */
+
             /* The packet is already in the native endian format so just send it out
                the IP interface.  */
 
@@ -195,7 +217,7 @@ ULONG      tx_window_current;
 
             /* Send the TCP packet to the IP component.  */
             _nx_ip_packet_send(ip_ptr, packet_ptr,  socket_ptr -> nx_tcp_socket_connect_ip,
-                               socket_ptr -> nx_tcp_socket_type_of_service, socket_ptr -> nx_tcp_socket_time_to_live, NX_IP_TCP, socket_ptr -> nx_tcp_socket_fragment_enable);
+                               socket_ptr -> nx_tcp_socket_type_of_service, socket_ptr -> nx_tcp_socket_time_to_live, NX_IP_TCP, NX_TCP_SOCKET_FRAGMENT(socket_ptr, packet_ptr));
 
             /* Decrement the suspension count.  */
             socket_ptr -> nx_tcp_socket_transmit_suspended_count--;
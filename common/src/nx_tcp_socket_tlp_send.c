@@ -0,0 +1,131 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+#include "nx_ip.h"
+#include "nx_tcp.h"
+
+
+#ifdef NX_ENABLE_TCP_RACK_TLP
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_tlp_send                             PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends a tail loss probe when the probe timeout        */
+/*    expires, RFC 8985 Section 7.3.  The last segment on the transmit    */
+/*    sent queue is retransmitted so that the peer's ACK reveals any loss */
+/*    at the tail of the flight.  Only one probe is sent per episode and  */
+/*    the congestion window is not changed.                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                IP instance pointer           */
+/*    socket_ptr                            Pointer to owning socket      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_packet_send                    Resend the transmit packet    */
+/*    tx_time_get                           Get current time              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_fast_periodic_processing      Fast TCP periodic processing  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_socket_tlp_send(NX_IP *ip_ptr, NX_TCP_SOCKET *socket_ptr)
+{
+
+NX_PACKET *packet_ptr;
+
+
+    /* Pickup the tail of the transmit queue.  */
+    packet_ptr =  socket_ptr -> nx_tcp_socket_transmit_sent_tail;
+
+    /* Determine if a probe can be sent.  The tail must have been released by the driver
+       and the peer must have an open window.  */
+    if ((packet_ptr == NX_NULL) ||
+        (packet_ptr -> nx_packet_queue_next != (NX_PACKET *)NX_DRIVER_TX_DONE) ||
+        (socket_ptr -> nx_tcp_socket_tx_window_advertised == 0) ||
+        (socket_ptr -> nx_tcp_socket_fast_recovery == NX_TRUE) ||
+        (socket_ptr -> nx_tcp_socket_tlp_in_progress == NX_TRUE))
+    {
+
+        /* No, leave recovery to the retransmit timeout.  */
+        return;
+    }
+
+    /* Start the probe episode.  It ends when all data sent so far is acknowledged.  */
+    socket_ptr -> nx_tcp_socket_tlp_in_progress =   NX_TRUE;
+    socket_ptr -> nx_tcp_socket_tlp_end_sequence =  socket_ptr -> nx_tcp_socket_tx_sequence;
+
+    /* Retransmitted data can not be used for round trip time measurement.  */
+    socket_ptr -> nx_tcp_socket_rtt_timing =  NX_FALSE;
+
+#ifndef NX_DISABLE_TCP_INFO
+    /* Increment the TCP retransmit count.  */
+    ip_ptr -> nx_ip_tcp_retransmit_packets++;
+
+    /* Increment the TCP retransmit and tail loss probe counts for the socket.  */
+    socket_ptr -> nx_tcp_socket_retransmit_packets++;
+    socket_ptr -> nx_tcp_socket_tail_loss_probes++;
+#endif
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_INTERNAL_TCP_RETRY, ip_ptr, socket_ptr, packet_ptr, socket_ptr -> nx_tcp_socket_timeout_retries, NX_TRACE_INTERNAL_EVENTS, 0, 0);
+
+    /* Clear the queue next pointer.  */
+    packet_ptr -> nx_packet_queue_next =  NX_NULL;
+
+    /* Record the transmit time.  */
+    packet_ptr -> nx_packet_tcp_transmit_time =  tx_time_get();
+
+    /* Send the probe.  */
+    _nx_ip_packet_send(ip_ptr, packet_ptr,  socket_ptr -> nx_tcp_socket_connect_ip,
+                       socket_ptr -> nx_tcp_socket_type_of_service, socket_ptr -> nx_tcp_socket_time_to_live, NX_IP_TCP,
+                       NX_TCP_SOCKET_FRAGMENT(socket_ptr, packet_ptr));
+}
+#endif /* NX_ENABLE_TCP_RACK_TLP */
+
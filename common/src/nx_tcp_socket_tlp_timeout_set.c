@@ -0,0 +1,133 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+#include "nx_tcp.h"
+
+
+#ifdef NX_ENABLE_TCP_RACK_TLP
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_tlp_timeout_set                      PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function starts the tail loss probe timeout after data has been*/
+/*    transmitted or acknowledged, RFC 8985 Section 7.2.  The probe       */
+/*    timeout is two smoothed RTTs, or one second before an RTT sample is */
+/*    available.  When a single segment is outstanding, the peer's delayed*/
+/*    ACK time is added.  No probe is scheduled during recovery, while a  */
+/*    probe is outstanding, or when the retransmit timeout would expire   */
+/*    first.                                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to owning socket      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_send_internal          Send TCP data                 */
+/*    _nx_tcp_socket_state_ack_check        Process ACK number            */
+/*    _nx_tcp_socket_state_transmit_check   Check for transmit ability    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_socket_tlp_timeout_set(NX_TCP_SOCKET *socket_ptr)
+{
+
+ULONG probe_timeout;
+
+
+    /* Clear any previous probe timeout.  */
+    socket_ptr -> nx_tcp_socket_tlp_timeout =  0;
+
+    /* Determine if a probe is allowed.  */
+    if ((socket_ptr -> nx_tcp_socket_transmit_sent_head == NX_NULL) ||
+        (socket_ptr -> nx_tcp_socket_fast_recovery == NX_TRUE) ||
+        (socket_ptr -> nx_tcp_socket_tlp_in_progress == NX_TRUE) ||
+        (socket_ptr -> nx_tcp_socket_state != NX_TCP_ESTABLISHED))
+    {
+
+        /* No, just return.  */
+        return;
+    }
+
+    /* Determine if there is an RTT sample.  */
+    if (socket_ptr -> nx_tcp_socket_rtt_smoothed)
+    {
+
+        /* Yes, the probe timeout is 2 * SRTT.  The smoothed RTT is scaled by 8.  */
+        probe_timeout =  socket_ptr -> nx_tcp_socket_rtt_smoothed >> 2;
+    }
+    else
+    {
+
+        /* No, use one second.  */
+        probe_timeout =  NX_IP_PERIODIC_RATE;
+    }
+
+    /* Determine if only one segment is outstanding.  */
+    if (socket_ptr -> nx_tcp_socket_transmit_sent_count == 1)
+    {
+
+        /* Yes, allow for the peer delaying its ACK.  */
+        probe_timeout =  probe_timeout + _nx_tcp_ack_timer_rate;
+    }
+
+    /* Determine if the retransmit timeout expires first.  */
+    if ((socket_ptr -> nx_tcp_socket_timeout) && (probe_timeout >= socket_ptr -> nx_tcp_socket_timeout))
+    {
+
+        /* Yes, a probe is pointless.  */
+        return;
+    }
+
+    /* Start the probe timeout.  */
+    socket_ptr -> nx_tcp_socket_tlp_timeout =  probe_timeout;
+}
+#endif /* NX_ENABLE_TCP_RACK_TLP */
+
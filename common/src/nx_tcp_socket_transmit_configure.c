@@ -94,6 +94,14 @@ NX_IP *ip_ptr;
     /* Obtain the IP mutex so we can initiate accept processing for this socket.  */
     tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
 
+#ifdef NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX
+    /* The transmit queue can not be deeper than the transmit queue index.  */
+    if (max_queue_depth > NX_TCP_TRANSMIT_QUEUE_INDEX_SIZE)
+    {
+        max_queue_depth =  NX_TCP_TRANSMIT_QUEUE_INDEX_SIZE;
+    }
+#endif /* NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX */
+
     /* Setup the socket with the new transmit parameters.  */
     socket_ptr -> nx_tcp_socket_timeout_rate =                    timeout;
     socket_ptr -> nx_tcp_socket_timeout_max_retries =             max_retries;
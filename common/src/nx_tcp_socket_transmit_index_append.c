@@ -0,0 +1,101 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+
+#ifdef NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_transmit_index_append                PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function records a packet that has just been placed at the tail*/
+/*    of the transmit sent queue in the transmit queue index.  It must be */
+/*    called after the packet sent count and the transmit sequence number */
+/*    have been updated for the packet.                                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to owning socket      */
+/*    data_length                           Number of data bytes in packet*/
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_send_internal          Send TCP data                 */
+/*    _nx_tcp_socket_state_transmit_check   Check for transmit ability    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_tcp_socket_transmit_index_append(NX_TCP_SOCKET *socket_ptr, ULONG data_length)
+{
+
+ULONG index;
+
+
+    /* Determine if this packet is the only one on the queue.  */
+    if (socket_ptr -> nx_tcp_socket_transmit_sent_count == 1)
+    {
+
+        /* Yes, restart the index with this packet at its head.  */
+        socket_ptr -> nx_tcp_socket_transmit_index_head =   0;
+        socket_ptr -> nx_tcp_socket_transmit_index_start =  socket_ptr -> nx_tcp_socket_tx_sequence - data_length;
+    }
+
+    /* Compute the entry for the tail of the queue.  */
+    index =  socket_ptr -> nx_tcp_socket_transmit_index_head + socket_ptr -> nx_tcp_socket_transmit_sent_count - 1;
+    if (index >= NX_TCP_TRANSMIT_QUEUE_INDEX_SIZE)
+    {
+        index =  index - NX_TCP_TRANSMIT_QUEUE_INDEX_SIZE;
+    }
+
+    /* Record the ending sequence of the packet.  */
+    socket_ptr -> nx_tcp_socket_transmit_index_end[index] =  socket_ptr -> nx_tcp_socket_tx_sequence;
+}
+#endif /* NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX */
+
@@ -0,0 +1,136 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_tcp.h"
+
+
+#ifdef NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_tcp_socket_transmit_index_search                PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the number of packets at the front of the     */
+/*    transmit sent queue that are completely covered by the supplied ACK */
+/*    number.  Sequence numbers are taken relative to the start of the    */
+/*    head packet, which makes the ending sequences of the queued packets */
+/*    increase monotonically even across sequence number wrap, so a binary*/
+/*    search over the index is used.  An ACK beyond the last transmitted  */
+/*    sequence covers nothing.                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to owning socket      */
+/*    ack_number                            ACK number from the peer      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    count                                 Number of packets covered     */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_tcp_socket_state_ack_check        Process ACK number            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _nx_tcp_socket_transmit_index_search(NX_TCP_SOCKET *socket_ptr, ULONG ack_number)
+{
+
+ULONG start;
+ULONG ack_offset;
+ULONG low;
+ULONG high;
+ULONG middle;
+ULONG index;
+
+
+    /* Pickup the starting sequence of the head packet.  */
+    start =  socket_ptr -> nx_tcp_socket_transmit_index_start;
+
+    /* Compute the ACK position relative to the head packet.  */
+    ack_offset =  ack_number - start;
+
+    /* Determine if the ACK is beyond the last transmitted sequence.  */
+    if ((socket_ptr -> nx_tcp_socket_transmit_sent_count == 0) ||
+        (ack_offset > (socket_ptr -> nx_tcp_socket_tx_sequence - start)))
+    {
+
+        /* Yes, it does not cover any packet.  */
+        return(0);
+    }
+
+    /* Find the number of entries whose ending sequence is at or before the ACK.  */
+    low =   0;
+    high =  socket_ptr -> nx_tcp_socket_transmit_sent_count;
+    while (low < high)
+    {
+
+        /* Pickup the middle entry.  */
+        middle =  (low + high) >> 1;
+        index =   socket_ptr -> nx_tcp_socket_transmit_index_head + middle;
+        if (index >= NX_TCP_TRANSMIT_QUEUE_INDEX_SIZE)
+        {
+            index =  index - NX_TCP_TRANSMIT_QUEUE_INDEX_SIZE;
+        }
+
+        /* Determine if the ACK covers this packet.  */
+        if ((socket_ptr -> nx_tcp_socket_transmit_index_end[index] - start) <= ack_offset)
+        {
+
+            /* Yes, search the upper half.  */
+            low =  middle + 1;
+        }
+        else
+        {
+
+            /* No, search the lower half.  */
+            high =  middle;
+        }
+    }
+
+    /* Return the number of covered packets.  */
+    return(low);
+}
+#endif /* NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX */
+
@@ -58,6 +58,8 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_packet_release                    Packet release function       */
+/*    _nx_udp_socket_drop_record            Record receive drops          */
+/*    _nx_udp_socket_find                   Find socket for the flow      */
 /*    tx_mutex_get                          Get protection mutex          */
 /*    tx_mutex_put                          Release protection mutex      */
 /*    _tx_thread_system_resume              Resume suspended thread       */
@@ -84,6 +86,9 @@ UINT           port;
 TX_THREAD     *thread_ptr;
 NX_UDP_SOCKET *socket_ptr;
 NX_UDP_HEADER *udp_header_ptr;
+NX_PACKET     *drop_head;
+NX_PACKET     *drop_ptr;
+ULONG          drops;
 
 
 #ifndef NX_DISABLE_UDP_INFO
@@ -188,6 +193,30 @@ NX_UDP_HEADER *udp_header_ptr;
         return;
     }
 
+#ifdef NX_ENABLE_UDP_FLOW_DEMUX
+    /* Find the socket for the flow, either the socket connected to the source of the
+       packet or one of the sockets bound to the port.  */
+    socket_ptr =  _nx_udp_socket_find(ip_ptr, port, *(((ULONG *)packet_ptr -> nx_packet_prepend_ptr) - 2),
+                                      (UINT)(udp_header_ptr -> nx_udp_header_word_0 >> NX_SHIFT_BY_16));
+
+    /* Determine if a socket was found.  */
+    if (socket_ptr)
+    {
+
+#ifndef NX_DISABLE_UDP_INFO
+
+        /* Increment the total number of packets received for this socket.  */
+        socket_ptr -> nx_udp_socket_packets_received++;
+
+        /* Increment the total UDP receive bytes.  */
+        ip_ptr -> nx_ip_udp_bytes_received +=          packet_ptr -> nx_packet_length - sizeof(NX_UDP_HEADER);
+        socket_ptr -> nx_udp_socket_bytes_received +=  packet_ptr -> nx_packet_length - sizeof(NX_UDP_HEADER);
+#endif
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        NX_TRACE_IN_LINE_INSERT(NX_TRACE_INTERNAL_UDP_RECEIVE, ip_ptr, socket_ptr, packet_ptr, udp_header_ptr -> nx_udp_header_word_0, NX_TRACE_INTERNAL_EVENTS, 0, 0)
+    }
+#else
     /*  Loop to examine the list of bound ports on this index.  */
     do
     {
@@ -221,6 +250,7 @@ NX_UDP_HEADER *udp_header_ptr;
             socket_ptr =  socket_ptr -> nx_udp_socket_bound_next;
         }
     } while (socket_ptr != ip_ptr -> nx_ip_udp_port_table[index]);
+#endif /* NX_ENABLE_UDP_FLOW_DEMUX */
 
     /* Determine if the caller is a thread. If so, release the mutex protection previously setup.  */
     if ((_tx_thread_current_ptr) && (TX_THREAD_GET_SYSTEM_STATE() == 0))
@@ -231,7 +261,7 @@ NX_UDP_HEADER *udp_header_ptr;
     }
 
     /* Determine if a match was found.  */
-    if (socket_ptr -> nx_udp_socket_port != port)
+    if ((socket_ptr == NX_NULL) || (socket_ptr -> nx_udp_socket_port != port))
     {
 
 #ifndef NX_DISABLE_UDP_INFO
@@ -280,6 +310,7 @@ NX_UDP_HEADER *udp_header_ptr;
     /* Pickup the receive notify function.  */
     receive_callback =  socket_ptr -> nx_udp_receive_callback;
 
+#ifndef NX_ENABLE_UDP_FLOW_DEMUX
     /* Determine if we need to update the UDP port head pointer.  This should
        only be done if the found socket pointer is not the head pointer and
        the mutex for this IP instance is available.  */
@@ -289,6 +320,7 @@ NX_UDP_HEADER *udp_header_ptr;
         /* Move the port head pointer to this socket.  */
         ip_ptr -> nx_ip_udp_port_table[index] =  socket_ptr;
     }
+#endif /* NX_ENABLE_UDP_FLOW_DEMUX */
 
     /* Determine if there is thread waiting for a packet from this port.  */
     thread_ptr =  socket_ptr -> nx_udp_socket_receive_suspension_list;
@@ -348,7 +380,7 @@ NX_UDP_HEADER *udp_header_ptr;
     else
     {
 
-        /* No, queue the thread in the socket's receive packet queue.  */
+        /* No, queue the packet in the socket's receive packet queue.  */
 
         /* Place the packet at the end of the socket's receive queue.  */
         if (socket_ptr -> nx_udp_socket_receive_head)
@@ -356,60 +388,99 @@ NX_UDP_HEADER *udp_header_ptr;
 
             /* Add the new packet to a nonempty list.  */
             (socket_ptr -> nx_udp_socket_receive_tail) -> nx_packet_queue_next =  packet_ptr;
-            socket_ptr -> nx_udp_socket_receive_tail =  packet_ptr;
-            packet_ptr -> nx_packet_queue_next =        NX_NULL;
+        }
+        else
+        {
+
+            /* Add the new packet to an empty list.  */
+            socket_ptr -> nx_udp_socket_receive_head =  packet_ptr;
+        }
+        socket_ptr -> nx_udp_socket_receive_tail =  packet_ptr;
+        packet_ptr -> nx_packet_queue_next =        NX_NULL;
+
+        /* Increment the number of packets and bytes queued.  */
+        socket_ptr -> nx_udp_socket_receive_count++;
+        NX_UDP_RECEIVE_BYTES_ADD(socket_ptr, packet_ptr);
+
+        /* Loop to remove the oldest packets while the queue is over its limits.  The new
+           packet is always kept.  */
+        drop_head =  NX_NULL;
+        drops =      0;
+        while (socket_ptr -> nx_udp_socket_receive_count > 1)
+        {
+
+            /* Determine which limit, if any, is exceeded.  */
+            if (socket_ptr -> nx_udp_socket_receive_count > socket_ptr -> nx_udp_socket_queue_maximum)
+            {
 
-            /* Increment the number of packets queued.  */
-            socket_ptr -> nx_udp_socket_receive_count++;
+#ifdef NX_ENABLE_UDP_RECEIVE_BUDGET
+                /* Increment the queue full drop count.  */
+                socket_ptr -> nx_udp_socket_drops_queue_full++;
+#endif /* NX_ENABLE_UDP_RECEIVE_BUDGET */
+            }
+#ifdef NX_ENABLE_UDP_RECEIVE_BUDGET
+            else if ((socket_ptr -> nx_udp_socket_receive_bytes_maximum) &&
+                     (socket_ptr -> nx_udp_socket_receive_bytes > socket_ptr -> nx_udp_socket_receive_bytes_maximum))
+            {
 
-            /* Determine if the maximum queue depth has been reached.  */
-            if (socket_ptr -> nx_udp_socket_receive_count >
-                socket_ptr -> nx_udp_socket_queue_maximum)
+                /* Increment the receive buffer full drop count.  */
+                socket_ptr -> nx_udp_socket_drops_no_buffer++;
+            }
+#endif /* NX_ENABLE_UDP_RECEIVE_BUDGET */
+            else
             {
 
-                /* We have exceeded the queue depth, so remove the first item
-                   in the queue (which is the oldest).  */
-                packet_ptr =  socket_ptr -> nx_udp_socket_receive_head;
-                socket_ptr -> nx_udp_socket_receive_head =  packet_ptr -> nx_packet_queue_next;
+                /* The queue is within its limits.  */
+                break;
+            }
+
+            /* Remove the first item in the queue (which is the oldest).  */
+            drop_ptr =  socket_ptr -> nx_udp_socket_receive_head;
+            socket_ptr -> nx_udp_socket_receive_head =  drop_ptr -> nx_packet_queue_next;
+
+            /* Decrement the number of packets and bytes queued.  */
+            socket_ptr -> nx_udp_socket_receive_count--;
+            NX_UDP_RECEIVE_BYTES_REMOVE(socket_ptr, drop_ptr);
 
-                /* Decrement the number of packets queued.  */
-                socket_ptr -> nx_udp_socket_receive_count--;
+            /* Place the packet on the list to release.  */
+            drop_ptr -> nx_packet_queue_next =  drop_head;
+            drop_head =  drop_ptr;
+            drops++;
 
 #ifndef NX_DISABLE_UDP_INFO
 
-                /* Increment the total UDP receive packets dropped count.  */
-                ip_ptr -> nx_ip_udp_receive_packets_dropped++;
+            /* Increment the total UDP receive packets dropped count.  */
+            ip_ptr -> nx_ip_udp_receive_packets_dropped++;
 
-                /* Increment the total UDP receive packets dropped count for this socket.  */
-                socket_ptr -> nx_udp_socket_packets_dropped++;
+            /* Increment the total UDP receive packets dropped count for this socket.  */
+            socket_ptr -> nx_udp_socket_packets_dropped++;
 #endif
+        }
 
-                /* Restore interrupts.  */
-                TX_RESTORE
+        /* Restore interrupts.  */
+        TX_RESTORE
 
-                /* Release the packet.  */
-                _nx_packet_release(packet_ptr);
-            }
-            else
+        /* Determine if any packets were dropped.  */
+        if (drops)
+        {
+
+            /* Loop to release the dropped packets.  */
+            while (drop_head)
             {
 
-                /* Restore interrupts.  */
-                TX_RESTORE
-            }
-        }
-        else
-        {
+                /* Pickup the next dropped packet.  */
+                drop_ptr =   drop_head;
+                drop_head =  drop_ptr -> nx_packet_queue_next;
 
-            /* Add the new packet to an empty list.  */
-            socket_ptr -> nx_udp_socket_receive_head =  packet_ptr;
-            socket_ptr -> nx_udp_socket_receive_tail =  packet_ptr;
-            packet_ptr -> nx_packet_queue_next =        NX_NULL;
+                /* Release the packet.  */
+                _nx_packet_release(drop_ptr);
+            }
 
-            /* Increment the number of packets queued.  */
-            socket_ptr -> nx_udp_socket_receive_count++;
+#ifdef NX_ENABLE_UDP_RECEIVE_BUDGET
 
-            /* Restore interrupts.  */
-            TX_RESTORE
+            /* Record the drops against the drop notify threshold.  */
+            _nx_udp_socket_drop_record(socket_ptr, drops);
+#endif /* NX_ENABLE_UDP_RECEIVE_BUDGET */
         }
     }
 
@@ -0,0 +1,116 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   User Datagram Protocol (UDP)                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+#include "nx_udp.h"
+
+
+#ifdef NX_ENABLE_EPHEMERAL_PORT_BITMAP
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_udp_port_bitmap_release                         PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function updates the ephemeral port bitmap after a UDP socket  */
+/*    was removed from a port.  The port is marked as free only if no     */
+/*    other UDP socket is still bound to it.  This function must be called*/
+/*    with the IP protection mutex held.                                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    port                                  Port the socket was bound to  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_port_bitmap_clear              Mark port free                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_udp_socket_unbind                 Unbind UDP socket             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_udp_port_bitmap_release(NX_IP *ip_ptr, UINT port)
+{
+
+UINT           index;
+NX_UDP_SOCKET *search_ptr;
+NX_UDP_SOCKET *end_ptr;
+
+
+    /* Calculate the hash index in the UDP port array of the associated IP instance.  */
+    index =  (UINT)((port + (port >> 8)) & NX_UDP_PORT_TABLE_MASK);
+
+    /* Pickup the head of the UDP ports bound list.  */
+    search_ptr =  ip_ptr -> nx_ip_udp_port_table[index];
+
+    /* Determine if we need to perform a list search.  */
+    if (search_ptr)
+    {
+
+        /* Walk through the circular list of UDP sockets that are already
+           bound.  */
+        end_ptr =     search_ptr;
+        do
+        {
+
+            /* Determine if this entry is the same as the released port.  */
+            if (search_ptr -> nx_udp_socket_port == port)
+            {
+
+                /* Yes, the port is still in use, leave it marked.  */
+                return;
+            }
+
+            /* Move to the next entry in the list.  */
+            search_ptr =  search_ptr -> nx_udp_socket_bound_next;
+        } while (search_ptr != end_ptr);
+    }
+
+    /* No socket is bound to the port any more.  */
+    _nx_ip_port_bitmap_clear(&(ip_ptr -> nx_ip_udp_port_bitmap), port);
+}
+#endif /* NX_ENABLE_EPHEMERAL_PORT_BITMAP */
+
@@ -26,6 +26,7 @@
 /* Include necessary system files.  */
 
 #include "nx_api.h"
+#include "nx_ip.h"
 #include "nx_udp.h"
 #include "tx_thread.h"
 
@@ -57,6 +58,8 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_ip_port_bitmap_set                Mark port in use              */
+/*    _nx_udp_socket_connected_link         Add to connected socket table */
 /*    _nx_udp_free_port_find                Find a free UDP port          */
 /*    tx_mutex_get                          Obtain protection mutex       */
 /*    tx_mutex_put                          Release protection mutex      */
@@ -156,6 +159,29 @@ NX_UDP_SOCKET *end_ptr;
         } while (search_ptr != end_ptr);
     }
 
+#ifdef NX_ENABLE_UDP_FLOW_DEMUX
+    /* Determine if the port is bound to sockets that share it.  */
+    if ((search_ptr) && (search_ptr -> nx_udp_socket_port == port) &&
+        (search_ptr -> nx_udp_socket_port_share))
+    {
+
+        /* Determine if this socket shares the port too.  */
+        if (socket_ptr -> nx_udp_socket_port_share == NX_FALSE)
+        {
+
+            /* Release the IP protection.  */
+            tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+            /* Return the port unavailable error.  The port is held by a group of sockets,
+               so a bind cannot wait for any one of them to unbind.  */
+            return(NX_PORT_UNAVAILABLE);
+        }
+
+        /* Clear the search pointer so the socket is added to the port group below.  */
+        search_ptr =  NX_NULL;
+    }
+#endif /* NX_ENABLE_UDP_FLOW_DEMUX */
+
     /* Now determine if the port is available.  */
     if ((search_ptr == NX_NULL) || (search_ptr -> nx_udp_socket_port != port))
     {
@@ -166,7 +192,7 @@ NX_UDP_SOCKET *end_ptr;
         TX_DISABLE
 
         /* Determine if the list is NULL.  */
-        if (search_ptr)
+        if (ip_ptr -> nx_ip_udp_port_table[index])
         {
 
             /* There are already sockets on this list... just add this one
@@ -192,6 +218,21 @@ NX_UDP_SOCKET *end_ptr;
         /* Restore interrupts.  */
         TX_RESTORE
 
+#ifdef NX_ENABLE_UDP_FLOW_DEMUX
+        /* Determine if the socket is connected.  */
+        if (socket_ptr -> nx_udp_socket_peer_address)
+        {
+
+            /* Add the socket to the connected socket table.  */
+            _nx_udp_socket_connected_link(socket_ptr);
+        }
+#endif /* NX_ENABLE_UDP_FLOW_DEMUX */
+
+#ifdef NX_ENABLE_EPHEMERAL_PORT_BITMAP
+        /* Mark the port as in use in the ephemeral port bitmap.  */
+        _nx_ip_port_bitmap_set(&(ip_ptr -> nx_ip_udp_port_bitmap), port);
+#endif /* NX_ENABLE_EPHEMERAL_PORT_BITMAP */
+
         /* Release the mutex protection.  */
         tx_mutex_put(&(ip_ptr -> nx_ip_protection));
 
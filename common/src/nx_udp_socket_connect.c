@@ -0,0 +1,132 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   User Datagram Protocol (UDP)                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_udp.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_udp_socket_connect                              PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function connects the UDP socket to a peer.  A connected       */
+/*    socket only receives packets sent from the peer address and port,   */
+/*    and is found through the connected socket table rather than the     */
+/*    port list.  Connecting to IP address 0 disconnects the socket.  The */
+/*    send path is not affected; packets are still sent to the address    */
+/*    and port passed to the send service.                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to UDP socket         */
+/*    ip_address                            Peer IP address, or 0 to      */
+/*                                            disconnect                  */
+/*    port                                  Peer UDP port                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_udp_socket_connected_link         Add to connected socket table */
+/*    _nx_udp_socket_connected_unlink       Remove from connected socket  */
+/*                                            table                       */
+/*    tx_mutex_get                          Obtain protection mutex       */
+/*    tx_mutex_put                          Release protection mutex      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_udp_socket_connect(NX_UDP_SOCKET *socket_ptr, ULONG ip_address, UINT port)
+{
+#ifdef NX_ENABLE_UDP_FLOW_DEMUX
+
+NX_IP *ip_ptr;
+
+
+    /* Setup the pointer to the associated IP instance.  */
+    ip_ptr =  socket_ptr -> nx_udp_socket_ip_ptr;
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_UDP_SOCKET_CONNECT, ip_ptr, socket_ptr, ip_address, port, NX_TRACE_UDP_EVENTS, 0, 0)
+
+    /* Obtain the IP mutex so the socket's bound state and the connected socket table
+       cannot change.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Determine if the socket is bound and already connected.  */
+    if ((socket_ptr -> nx_udp_socket_bound_next) && (socket_ptr -> nx_udp_socket_peer_address))
+    {
+
+        /* Remove the socket from the connected socket table.  */
+        _nx_udp_socket_connected_unlink(socket_ptr);
+    }
+
+    /* Save the peer of the socket.  */
+    socket_ptr -> nx_udp_socket_peer_address =  ip_address;
+    socket_ptr -> nx_udp_socket_peer_port =     (ip_address) ? port : 0;
+
+    /* Determine if the socket is bound and now connected.  */
+    if ((socket_ptr -> nx_udp_socket_bound_next) && (ip_address))
+    {
+
+        /* Add the socket to the connected socket table.  */
+        _nx_udp_socket_connected_link(socket_ptr);
+    }
+
+    /* Release the mutex protection.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Return success to the caller.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_UDP_FLOW_DEMUX */
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    NX_PARAMETER_NOT_USED(ip_address);
+    NX_PARAMETER_NOT_USED(port);
+
+    return(NX_NOT_SUPPORTED);
+#endif /* NX_ENABLE_UDP_FLOW_DEMUX */
+}
+
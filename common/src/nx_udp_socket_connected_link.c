@@ -0,0 +1,103 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   User Datagram Protocol (UDP)                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_udp.h"
+
+
+#ifdef NX_ENABLE_UDP_FLOW_DEMUX
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_udp_socket_connected_link                       PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds a bound and connected UDP socket to the          */
+/*    connected socket table of its IP instance.  The caller must hold    */
+/*    the IP protection mutex.                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to UDP socket         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_udp_socket_bind                   Bind UDP socket to port       */
+/*    _nx_udp_socket_connect                Connect UDP socket to peer    */
+/*    _nx_udp_socket_unbind                 Unbind UDP socket from port   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_udp_socket_connected_link(NX_UDP_SOCKET *socket_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+UINT   index;
+NX_IP *ip_ptr;
+
+
+    /* Setup the pointer to the associated IP instance.  */
+    ip_ptr =  socket_ptr -> nx_udp_socket_ip_ptr;
+
+    /* Calculate the index in the connected socket table.  */
+    index =  NX_UDP_CONNECTED_HASH(socket_ptr -> nx_udp_socket_port, socket_ptr -> nx_udp_socket_peer_address,
+                                   socket_ptr -> nx_udp_socket_peer_port);
+
+    /* Disable interrupts, since packets may be received from the IP helper thread or an ISR.  */
+    TX_DISABLE
+
+    /* Place the socket at the head of the bucket.  */
+    socket_ptr -> nx_udp_socket_connected_next =  ip_ptr -> nx_ip_udp_connected_table[index];
+    ip_ptr -> nx_ip_udp_connected_table[index] =  socket_ptr;
+
+    /* Increment the number of connected sockets.  */
+    ip_ptr -> nx_ip_udp_connected_count++;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+}
+#endif /* NX_ENABLE_UDP_FLOW_DEMUX */
+
@@ -0,0 +1,127 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   User Datagram Protocol (UDP)                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_udp.h"
+
+
+#ifdef NX_ENABLE_UDP_FLOW_DEMUX
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_udp_socket_connected_unlink                     PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes a UDP socket from the connected socket table  */
+/*    of its IP instance.  The caller must hold the IP protection mutex.  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to UDP socket         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_udp_socket_connect                Connect UDP socket to peer    */
+/*    _nx_udp_socket_unbind                 Unbind UDP socket from port   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_udp_socket_connected_unlink(NX_UDP_SOCKET *socket_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+UINT           index;
+NX_IP         *ip_ptr;
+NX_UDP_SOCKET *search_ptr;
+NX_UDP_SOCKET *previous_ptr;
+
+
+    /* Setup the pointer to the associated IP instance.  */
+    ip_ptr =  socket_ptr -> nx_udp_socket_ip_ptr;
+
+    /* Calculate the index in the connected socket table.  */
+    index =  NX_UDP_CONNECTED_HASH(socket_ptr -> nx_udp_socket_port, socket_ptr -> nx_udp_socket_peer_address,
+                                   socket_ptr -> nx_udp_socket_peer_port);
+
+    /* Disable interrupts, since packets may be received from the IP helper thread or an ISR.  */
+    TX_DISABLE
+
+    /* Loop to find the socket in the bucket.  */
+    previous_ptr =  NX_NULL;
+    search_ptr =    ip_ptr -> nx_ip_udp_connected_table[index];
+    while (search_ptr)
+    {
+
+        /* Determine if this is the socket.  */
+        if (search_ptr == socket_ptr)
+        {
+
+            /* Yes, unlink it from the bucket.  */
+            if (previous_ptr)
+            {
+                previous_ptr -> nx_udp_socket_connected_next =  socket_ptr -> nx_udp_socket_connected_next;
+            }
+            else
+            {
+                ip_ptr -> nx_ip_udp_connected_table[index] =  socket_ptr -> nx_udp_socket_connected_next;
+            }
+            socket_ptr -> nx_udp_socket_connected_next =  NX_NULL;
+
+            /* Decrement the number of connected sockets.  */
+            ip_ptr -> nx_ip_udp_connected_count--;
+            break;
+        }
+
+        /* Move to the next socket in the bucket.  */
+        previous_ptr =  search_ptr;
+        search_ptr =    search_ptr -> nx_udp_socket_connected_next;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+}
+#endif /* NX_ENABLE_UDP_FLOW_DEMUX */
+
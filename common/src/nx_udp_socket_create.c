@@ -120,6 +120,9 @@ NX_UDP_SOCKET *tail_ptr;
     socket_ptr -> nx_udp_socket_queue_maximum =         queue_maximum;
     socket_ptr -> nx_udp_socket_receive_head =          NX_NULL;
     socket_ptr -> nx_udp_socket_receive_tail =          NX_NULL;
+#ifdef NX_ENABLE_UDP_RECEIVE_BUDGET
+    socket_ptr -> nx_udp_socket_receive_bytes_maximum = NX_UDP_RECEIVE_BUFFER_DEFAULT;
+#endif /* NX_ENABLE_UDP_RECEIVE_BUDGET */
 
     /* Clear the receive notify function pointer.  */
     socket_ptr -> nx_udp_receive_callback =             NX_NULL;
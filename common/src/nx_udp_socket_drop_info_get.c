@@ -0,0 +1,130 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   User Datagram Protocol (UDP)                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_udp.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_udp_socket_drop_info_get                        PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves the receive drop counters of the UDP        */
+/*    socket: packets dropped because the receive queue held its maximum  */
+/*    number of packets, packets dropped because the receive queue was    */
+/*    over its byte limit, and packets dropped on a checksum error.       */
+/*    Destinations that are NULL are skipped.                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to UDP socket         */
+/*    queue_full_drops                      Destination for queue full    */
+/*                                            drops                       */
+/*    no_buffer_drops                       Destination for no buffer     */
+/*                                            drops                       */
+/*    checksum_drops                        Destination for checksum drops*/
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_udp_socket_drop_info_get(NX_UDP_SOCKET *socket_ptr, ULONG *queue_full_drops, ULONG *no_buffer_drops,
+                                   ULONG *checksum_drops)
+{
+#ifdef NX_ENABLE_UDP_RECEIVE_BUDGET
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_UDP_SOCKET_DROP_INFO_GET, socket_ptr -> nx_udp_socket_ip_ptr, socket_ptr, socket_ptr -> nx_udp_socket_drops_queue_full, socket_ptr -> nx_udp_socket_drops_no_buffer, NX_TRACE_UDP_EVENTS, 0, 0)
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Determine if queue full drops is wanted.  */
+    if (queue_full_drops)
+    {
+
+        /* Return the number of packets dropped on a full receive queue.  */
+        *queue_full_drops =  socket_ptr -> nx_udp_socket_drops_queue_full;
+    }
+
+    /* Determine if no buffer drops is wanted.  */
+    if (no_buffer_drops)
+    {
+
+        /* Return the number of packets dropped over the receive byte limit.  */
+        *no_buffer_drops =  socket_ptr -> nx_udp_socket_drops_no_buffer;
+    }
+
+    /* Determine if checksum drops is wanted.  */
+    if (checksum_drops)
+    {
+
+        /* Return the number of packets dropped on checksum error.  */
+        *checksum_drops =  socket_ptr -> nx_udp_socket_drops_checksum;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return successful completion status.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_UDP_RECEIVE_BUDGET */
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    NX_PARAMETER_NOT_USED(queue_full_drops);
+    NX_PARAMETER_NOT_USED(no_buffer_drops);
+    NX_PARAMETER_NOT_USED(checksum_drops);
+
+    return(NX_NOT_SUPPORTED);
+#endif /* NX_ENABLE_UDP_RECEIVE_BUDGET */
+}
+
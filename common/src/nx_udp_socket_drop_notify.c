@@ -0,0 +1,119 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   User Datagram Protocol (UDP)                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_udp.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_udp_socket_drop_notify                          PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets the drop notify function of the UDP socket.  The */
+/*    function is called with the number of drops counted in the current  */
+/*    period when the receive drops of the socket in a period of ticks    */
+/*    reach the threshold, and at most once per period.  Drops on a full  */
+/*    receive queue, over the receive byte limit and on checksum error    */
+/*    are all counted.  A NULL function disables the notification.        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to UDP socket         */
+/*    threshold                             Drops per period to notify    */
+/*    period                                Period in ticks               */
+/*    drop_notify                           Application drop notify       */
+/*                                            function                    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_time_get                           Get system time               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_udp_socket_drop_notify(NX_UDP_SOCKET *socket_ptr, ULONG threshold, ULONG period,
+                                 VOID (*drop_notify)(NX_UDP_SOCKET *socket_ptr, ULONG drops))
+{
+#ifdef NX_ENABLE_UDP_RECEIVE_BUDGET
+TX_INTERRUPT_SAVE_AREA
+ULONG current_time;
+
+
+    /* Pickup the current time.  */
+    current_time =  tx_time_get();
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Setup the drop notify function, threshold and period.  */
+    socket_ptr -> nx_udp_socket_drop_notify =     drop_notify;
+    socket_ptr -> nx_udp_socket_drop_threshold =  threshold;
+    socket_ptr -> nx_udp_socket_drop_period =     period;
+
+    /* Start a new period.  */
+    socket_ptr -> nx_udp_socket_drop_period_start =  current_time;
+    socket_ptr -> nx_udp_socket_drop_period_count =  0;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_UDP_SOCKET_DROP_NOTIFY, socket_ptr -> nx_udp_socket_ip_ptr, socket_ptr, threshold, period, NX_TRACE_UDP_EVENTS, 0, 0)
+
+    /* Return successful completion.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_UDP_RECEIVE_BUDGET */
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    NX_PARAMETER_NOT_USED(threshold);
+    NX_PARAMETER_NOT_USED(period);
+    NX_PARAMETER_NOT_USED(drop_notify);
+
+    return(NX_NOT_SUPPORTED);
+#endif /* NX_ENABLE_UDP_RECEIVE_BUDGET */
+}
+
@@ -0,0 +1,145 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   User Datagram Protocol (UDP)                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_udp.h"
+
+
+#ifdef NX_ENABLE_UDP_RECEIVE_BUDGET
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_udp_socket_drop_record                          PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds receive drops of a UDP socket to the drops       */
+/*    counted in the current notify period.  A new period is started when */
+/*    the previous one has elapsed.  When the drops in the period reach   */
+/*    the threshold, the drop notify function of the socket is called,    */
+/*    once per period.                                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to UDP socket         */
+/*    drops                                 Number of packets dropped     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_time_get                           Get system time               */
+/*    (nx_udp_socket_drop_notify)           Application drop notify       */
+/*                                            function                    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_udp_packet_receive                Receive UDP packet            */
+/*    _nx_udp_socket_receive                Receive UDP packet            */
+/*    _nx_udp_socket_receive_batch          Receive a batch of UDP packets*/
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_udp_socket_drop_record(NX_UDP_SOCKET *socket_ptr, ULONG drops)
+{
+
+TX_INTERRUPT_SAVE_AREA
+VOID  (*drop_notify)(NX_UDP_SOCKET *socket_ptr, ULONG drops);
+ULONG current_time;
+ULONG previous_count;
+ULONG period_count;
+
+
+    /* Pickup the current time.  */
+    current_time =  tx_time_get();
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Pickup the drop notify function.  */
+    drop_notify =  socket_ptr -> nx_udp_socket_drop_notify;
+
+    /* Determine if drop notification is requested.  */
+    if (drop_notify == NX_NULL)
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Nothing to record.  */
+        return;
+    }
+
+    /* Determine if the current period has elapsed.  */
+    if ((ULONG)(current_time - socket_ptr -> nx_udp_socket_drop_period_start) >= socket_ptr -> nx_udp_socket_drop_period)
+    {
+
+        /* Yes, start a new period.  */
+        socket_ptr -> nx_udp_socket_drop_period_start =  current_time;
+        socket_ptr -> nx_udp_socket_drop_period_count =  0;
+    }
+
+    /* Add the drops to the period.  */
+    previous_count =  socket_ptr -> nx_udp_socket_drop_period_count;
+    period_count =    previous_count + drops;
+    socket_ptr -> nx_udp_socket_drop_period_count =  period_count;
+
+    /* Determine if these drops reach the threshold.  Drops beyond the threshold in the
+       same period are not notified again.  */
+    if ((previous_count >= socket_ptr -> nx_udp_socket_drop_threshold) ||
+        (period_count < socket_ptr -> nx_udp_socket_drop_threshold))
+    {
+
+        /* No, clear the notify function.  */
+        drop_notify =  NX_NULL;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Determine if the application is to be notified.  */
+    if (drop_notify)
+    {
+
+        /* Yes, call the application's drop notify function for this socket.  */
+        (drop_notify)(socket_ptr, period_count);
+    }
+}
+#endif /* NX_ENABLE_UDP_RECEIVE_BUDGET */
+
@@ -0,0 +1,185 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   User Datagram Protocol (UDP)                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_udp.h"
+
+
+#ifdef NX_ENABLE_UDP_FLOW_DEMUX
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_udp_socket_find                                 PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function finds the UDP socket that receives a packet sent to   */
+/*    the specified port from the specified source.  A socket connected   */
+/*    to the source is preferred.  Otherwise the packet goes to an        */
+/*    unconnected socket bound to the port, and if several sockets share  */
+/*    the port, the socket is selected by a hash of the source address    */
+/*    and port so all packets of a flow go to the same socket.            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP control block   */
+/*    port                                  Destination UDP port          */
+/*    source_ip                             Source IP address             */
+/*    source_port                           Source UDP port               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    socket_ptr                            Pointer to the socket, or     */
+/*                                            NX_NULL if none is found    */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_udp_packet_receive                UDP packet receive processing */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+NX_UDP_SOCKET  *_nx_udp_socket_find(NX_IP *ip_ptr, UINT port, ULONG source_ip, UINT source_port)
+{
+
+UINT           index;
+ULONG          count;
+ULONG          selected;
+NX_UDP_SOCKET *socket_ptr;
+NX_UDP_SOCKET *head_ptr;
+NX_UDP_SOCKET *found_ptr;
+
+
+    /* Determine if there are any connected sockets.  */
+    if (ip_ptr -> nx_ip_udp_connected_count)
+    {
+
+        /* Pickup the head of the connected socket table bucket for this flow.  */
+        socket_ptr =  ip_ptr -> nx_ip_udp_connected_table[NX_UDP_CONNECTED_HASH(port, source_ip, source_port)];
+
+        /* Loop to find the socket connected to the source of the packet.  */
+        while (socket_ptr)
+        {
+
+            /* Determine if this socket matches the flow.  */
+            if ((socket_ptr -> nx_udp_socket_peer_address == source_ip) &&
+                (socket_ptr -> nx_udp_socket_peer_port == source_port) &&
+                (socket_ptr -> nx_udp_socket_port == port))
+            {
+
+                /* Yes, return the connected socket.  */
+                return(socket_ptr);
+            }
+
+            /* Move to the next socket in the bucket.  */
+            socket_ptr =  socket_ptr -> nx_udp_socket_connected_next;
+        }
+    }
+
+    /* Calculate the hash index in the UDP port array of the associated IP instance.  */
+    index =  (UINT)((port + (port >> 8)) & NX_UDP_PORT_TABLE_MASK);
+
+    /* Pickup the head of the UDP ports bound list.  */
+    head_ptr =  ip_ptr -> nx_ip_udp_port_table[index];
+
+    /* Determine if there are any sockets bound on this port index.  */
+    if (head_ptr == NX_NULL)
+    {
+        return(NX_NULL);
+    }
+
+    /* Loop to count the unconnected sockets bound to the port.  */
+    count =      0;
+    found_ptr =  NX_NULL;
+    socket_ptr = head_ptr;
+    do
+    {
+
+        /* Determine if this unconnected socket is bound to the port.  */
+        if ((socket_ptr -> nx_udp_socket_port == port) &&
+            (socket_ptr -> nx_udp_socket_peer_address == 0))
+        {
+
+            /* Remember the first socket found.  */
+            if (count == 0)
+            {
+                found_ptr =  socket_ptr;
+            }
+            count++;
+
+            /* A socket that does not share the port is the only one bound to it.  */
+            if (socket_ptr -> nx_udp_socket_port_share == NX_FALSE)
+            {
+                break;
+            }
+        }
+
+        /* Move to the next entry in the bound index.  */
+        socket_ptr =  socket_ptr -> nx_udp_socket_bound_next;
+    } while (socket_ptr != head_ptr);
+
+    /* Determine if the port is shared by several sockets.  */
+    if (count > 1)
+    {
+
+        /* Select the socket for this flow.  */
+        selected =  NX_UDP_FLOW_HASH(source_ip, source_port) % count;
+
+        /* Loop to move to the selected socket.  */
+        while (selected)
+        {
+
+            /* Move to the next entry in the bound index.  */
+            found_ptr =  found_ptr -> nx_udp_socket_bound_next;
+
+            /* Determine if this is another unconnected socket bound to the port.  */
+            if ((found_ptr -> nx_udp_socket_port == port) &&
+                (found_ptr -> nx_udp_socket_peer_address == 0))
+            {
+                selected--;
+            }
+        }
+    }
+
+    /* Return the socket found.  */
+    return(found_ptr);
+}
+#endif /* NX_ENABLE_UDP_FLOW_DEMUX */
+
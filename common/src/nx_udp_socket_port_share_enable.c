@@ -0,0 +1,112 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   User Datagram Protocol (UDP)                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_udp.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_udp_socket_port_share_enable                    PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function enables port sharing on the UDP socket.  Sockets that */
+/*    all have port sharing enabled can be bound to the same port, and    */
+/*    the packets received on the port from sources no socket is          */
+/*    connected to are spread over them by flow.  Port sharing must be    */
+/*    enabled before the socket is bound.                                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to UDP socket         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_udp_socket_port_share_enable(NX_UDP_SOCKET *socket_ptr)
+{
+#ifdef NX_ENABLE_UDP_FLOW_DEMUX
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_UDP_SOCKET_PORT_SHARE_ENABLE, socket_ptr -> nx_udp_socket_ip_ptr, socket_ptr, 0, 0, NX_TRACE_UDP_EVENTS, 0, 0)
+
+    /* Lockout interrupts.  */
+    TX_DISABLE
+
+    /* Determine if the socket is bound or a bind is in progress.  */
+    if ((socket_ptr -> nx_udp_socket_bound_next) ||
+        (socket_ptr -> nx_udp_socket_bind_in_progress))
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Socket is already bound, return an error message.  */
+        return(NX_ALREADY_BOUND);
+    }
+
+    /* Set the port sharing flag.  */
+    socket_ptr -> nx_udp_socket_port_share =  NX_TRUE;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return a successful status.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_UDP_FLOW_DEMUX */
+    NX_PARAMETER_NOT_USED(socket_ptr);
+
+    return(NX_NOT_SUPPORTED);
+#endif /* NX_ENABLE_UDP_FLOW_DEMUX */
+}
+
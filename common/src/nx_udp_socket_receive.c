@@ -59,6 +59,8 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_packet_release                    Release data packet           */
+/*    _nx_udp_checksum                      Compute UDP checksum          */
+/*    _nx_udp_socket_drop_record            Record receive drops          */
 /*    _tx_thread_system_suspend             Suspend thread                */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -78,14 +80,7 @@ TX_INTERRUPT_SAVE_AREA
 
 #ifndef NX_DISABLE_UDP_RX_CHECKSUM
 ULONG      checksum;
-ULONG      length;
-ULONG      temp;
 ULONG     *temp_ptr;
-UCHAR     *word_ptr;
-UCHAR     *pad_ptr;
-ULONG      packet_length;
-ULONG      adjusted_packet_length;
-NX_PACKET *current_packet;
 #endif
 TX_THREAD *thread_ptr;
 
@@ -135,8 +130,9 @@ ULONG                  trace_timestamp;
                 socket_ptr -> nx_udp_socket_receive_tail =  NX_NULL;
             }
 
-            /* Decrease the queued packet count.  */
+            /* Decrease the queued packet and byte counts.  */
             socket_ptr -> nx_udp_socket_receive_count--;
+            NX_UDP_RECEIVE_BYTES_REMOVE(socket_ptr, *packet_ptr);
 
             /* Restore interrupts.  */
             TX_RESTORE
@@ -240,121 +236,19 @@ ULONG                  trace_timestamp;
 
             /* Yes, we need to compute the UDP checksum.  */
 
-            /* First calculate the checksum of the pseudo UDP header that includes the source IP
-               address, destination IP address, protocol word, and the UDP length.  */
-            temp =  *(temp_ptr - 2);
-            checksum =  (temp >> NX_SHIFT_BY_16);
-            checksum += (temp & NX_LOWER_16_MASK);
-            temp =  *(temp_ptr - 1);
-            checksum += (temp >> NX_SHIFT_BY_16);
-            checksum += (temp & NX_LOWER_16_MASK);
-            checksum += (NX_IP_UDP >> NX_SHIFT_BY_16);
-            checksum += (*packet_ptr) -> nx_packet_length;
-
             /* Endian swapping logic.  If NX_LITTLE_ENDIAN is specified, these macros will
                swap the endian of the UDP header.  */
             NX_CHANGE_ULONG_ENDIAN(*(temp_ptr));
             NX_CHANGE_ULONG_ENDIAN(*(temp_ptr + 1));
 
-            /* Setup the length of the packet checksum. */
-            length = (*packet_ptr) -> nx_packet_length;
-
-            /* Initialize the current packet to the input packet pointer.  */
-            current_packet =  *packet_ptr;
-
-            /* Loop to calculate the packet's checksum.  */
-            while (length)
-            {
-                /* Calculate the current packet length.  */
-                packet_length =  (ULONG)(current_packet -> nx_packet_append_ptr - current_packet -> nx_packet_prepend_ptr);
-
-                /* Make the adjusted packet length evenly divisible by sizeof(ULONG).  */
-                adjusted_packet_length =  ((packet_length + (sizeof(ULONG) - 1)) / sizeof(ULONG)) * sizeof(ULONG);
-
-                /* Determine if we need to add padding bytes.  */
-                if (packet_length < adjusted_packet_length)
-                {
-
-                    /* Calculate how many bytes we need to zero at the end of the packet.  */
-                    temp =  adjusted_packet_length - packet_length;
-
-                    /* Setup temporary pointer to the current packet's append pointer.  */
-                    pad_ptr =  current_packet -> nx_packet_append_ptr;
-
-                    /* Loop to pad current packet with 0s so we don't have to worry about a partial last word.  */
-                    while (temp)
-                    {
-
-                        /* Check for the end of the packet.  */
-                        if (pad_ptr >= current_packet -> nx_packet_data_end)
-                        {
-                            break;
-                        }
-
-                        /* Write a 0. */
-                        *pad_ptr++ =  0;
-
-                        /* Decrease the pad count.  */
-                        temp--;
-                    }
-                }
-
-                /* Setup the pointer to the start of the packet.  */
-                word_ptr =  (UCHAR *)current_packet -> nx_packet_prepend_ptr;
-
-                /* Now loop through the current packet to compute the checksum on this packet.  */
-                while (adjusted_packet_length)
-                {
-
-                    /* Pickup a whole ULONG.  */
-                    temp =  *((ULONG *)word_ptr);
-
-                    /* Endian swapping logic.  If NX_LITTLE_ENDIAN is specified, these macros will
-                       swap the endian of the long word in the message.  */
-                    NX_CHANGE_ULONG_ENDIAN(temp);
-
-                    /* Add upper 16-bits into checksum.  */
-                    checksum =  checksum + (temp >> NX_SHIFT_BY_16);
-
-                    /* Add lower 16-bits into checksum.  */
-                    checksum =  checksum + (temp & NX_LOWER_16_MASK);
-
-                    /* Move the word pointer and decrease the length.  */
-                    word_ptr =  word_ptr + sizeof(ULONG);
-                    adjusted_packet_length = adjusted_packet_length - sizeof(ULONG);
-                }
-
-                /* Adjust the checksum length.  */
-                length =  length - packet_length;
-
-                /* Determine if we are at the end of the current packet.  */
-                if ((length) && (word_ptr >= (UCHAR *)current_packet -> nx_packet_append_ptr) &&
-                    (current_packet -> nx_packet_next))
-                {
-
-                    /* We have crossed the packet boundary.  Move to the next packet
-                       structure.  */
-                    current_packet =  current_packet -> nx_packet_next;
-
-                    /* Setup the new word pointer.  */
-                    word_ptr =  (UCHAR *)current_packet -> nx_packet_prepend_ptr;
-                }
-            }
+            /* Compute the checksum over the pseudo header and the packet.  */
+            checksum =  _nx_udp_checksum(*packet_ptr, *(temp_ptr - 2), *(temp_ptr - 1));
 
             /* Endian swapping logic.  If NX_LITTLE_ENDIAN is specified, these macros will
                swap the endian of the UDP header.  */
             NX_CHANGE_ULONG_ENDIAN(*(temp_ptr));
             NX_CHANGE_ULONG_ENDIAN(*(temp_ptr + 1));
 
-            /* Add in the carry bits into the checksum.  */
-            checksum = (checksum >> NX_SHIFT_BY_16) + (checksum & NX_LOWER_16_MASK);
-
-            /* Do it again in case previous operation generates an overflow.  */
-            checksum = (checksum >> NX_SHIFT_BY_16) + (checksum & NX_LOWER_16_MASK);
-
-            /* Perform the one's complement processing on the checksum.  */
-            checksum =  NX_LOWER_16_MASK & ~checksum;
-
             /* Determine if it is valid.  */
             if (checksum == 0)
             {
@@ -397,6 +291,21 @@ ULONG                  trace_timestamp;
 
                 /* Bad UDP checksum.  Release the packet. */
                 _nx_packet_release(*packet_ptr);
+
+#ifdef NX_ENABLE_UDP_RECEIVE_BUDGET
+
+                /* Disable interrupts.  */
+                TX_DISABLE
+
+                /* Increment the checksum drop count for this socket.  */
+                socket_ptr -> nx_udp_socket_drops_checksum++;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Record the drop against the drop notify threshold.  */
+                _nx_udp_socket_drop_record(socket_ptr, 1);
+#endif /* NX_ENABLE_UDP_RECEIVE_BUDGET */
             }
         }
         else
@@ -0,0 +1,265 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   User Datagram Protocol (UDP)                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_udp.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_udp_socket_receive_batch                        PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves up to the specified number of UDP packets   */
+/*    received on the socket.  If no packet is queued, it waits for the   */
+/*    first one as specified by the wait option.  The packets queued      */
+/*    behind it are then taken from the socket in one step and returned   */
+/*    without waiting further.                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to UDP socket         */
+/*    packet_array                          Array of UDP packet pointers  */
+/*    array_size                            Number of entries in array    */
+/*    received_count                        Pointer to destination for the*/
+/*                                            number of packets received  */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_release                    Release data packet           */
+/*    _nx_udp_checksum                      Compute UDP checksum          */
+/*    _nx_udp_socket_drop_record            Record receive drops          */
+/*    _nx_udp_socket_receive                Receive the first packet      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_udp_socket_receive_batch(NX_UDP_SOCKET *socket_ptr, NX_PACKET **packet_array, UINT array_size,
+                                   UINT *received_count, ULONG wait_option)
+{
+#ifdef NX_ENABLE_UDP_BATCH
+TX_INTERRUPT_SAVE_AREA
+
+UINT       status;
+UINT       count;
+UINT       taken;
+UINT       index;
+UINT       end_index;
+NX_PACKET *packet_ptr;
+#ifndef NX_DISABLE_UDP_RX_CHECKSUM
+ULONG      checksum;
+ULONG     *temp_ptr;
+#endif
+
+
+    /* Set the received count to zero initially.  */
+    *received_count =  0;
+
+    /* Receive the first packet, waiting for it if so requested.  */
+    status =  _nx_udp_socket_receive(socket_ptr, &packet_array[0], wait_option);
+
+    /* Determine if a packet was received.  */
+    if (status != NX_SUCCESS)
+    {
+        return(status);
+    }
+    count =  1;
+
+    /* Loop to take the packets already queued on the socket.  */
+    while (count < array_size)
+    {
+
+        /* Lockout interrupts.  */
+        TX_DISABLE
+
+        /* Remove as many queued packets as fit in the array.  */
+        taken =  0;
+        while ((count + taken < array_size) && (socket_ptr -> nx_udp_socket_receive_count))
+        {
+
+            /* Remove the packet at the head of the queue.  */
+            packet_array[count + taken] =  socket_ptr -> nx_udp_socket_receive_head;
+            socket_ptr -> nx_udp_socket_receive_head =  packet_array[count + taken] -> nx_packet_queue_next;
+
+            /* Decrease the queued packet and byte counts.  */
+            socket_ptr -> nx_udp_socket_receive_count--;
+            NX_UDP_RECEIVE_BYTES_REMOVE(socket_ptr, packet_array[count + taken]);
+            taken++;
+        }
+
+        /* If this was the last packet, set the tail pointer to NULL.  */
+        if (socket_ptr -> nx_udp_socket_receive_head == NX_NULL)
+        {
+            socket_ptr -> nx_udp_socket_receive_tail =  NX_NULL;
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Determine if there are no more packets.  */
+        if (taken == 0)
+        {
+            break;
+        }
+
+        /* Loop to check and strip the packets taken, keeping the valid ones at the
+           front of the array.  */
+        end_index =  count + taken;
+        for (index = count; index < end_index; index++)
+        {
+
+            /* Pickup the packet.  */
+            packet_ptr =  packet_array[index];
+
+#ifndef NX_DISABLE_UDP_RX_CHECKSUM
+
+            /* Determine if we need to verify the UDP checksum.  If it is disabled for this socket
+               or if the UDP packet has a zero in the checksum field (indicating it was not computed
+               by the sender, skip the checksum processing.  */
+            temp_ptr =  (ULONG *)packet_ptr -> nx_packet_prepend_ptr;
+            if ((!socket_ptr -> nx_udp_socket_disable_checksum) && (*(temp_ptr + 1) & NX_LOWER_16_MASK))
+            {
+
+                /* Endian swapping logic.  If NX_LITTLE_ENDIAN is specified, these macros will
+                   swap the endian of the UDP header.  */
+                NX_CHANGE_ULONG_ENDIAN(*(temp_ptr));
+                NX_CHANGE_ULONG_ENDIAN(*(temp_ptr + 1));
+
+                /* Compute the checksum over the pseudo header and the packet.  */
+                checksum =  _nx_udp_checksum(packet_ptr, *(temp_ptr - 2), *(temp_ptr - 1));
+
+                /* Endian swapping logic.  If NX_LITTLE_ENDIAN is specified, these macros will
+                   swap the endian of the UDP header.  */
+                NX_CHANGE_ULONG_ENDIAN(*(temp_ptr));
+                NX_CHANGE_ULONG_ENDIAN(*(temp_ptr + 1));
+
+                /* Determine if it is valid.  */
+                if (checksum != 0)
+                {
+
+#ifndef NX_DISABLE_UDP_INFO
+
+                    /* Disable interrupts.  */
+                    TX_DISABLE
+
+                    /* Increment the UDP checksum error count.  */
+                    (socket_ptr -> nx_udp_socket_ip_ptr) -> nx_ip_udp_checksum_errors++;
+
+                    /* Increment the UDP invalid packets error count.  */
+                    (socket_ptr -> nx_udp_socket_ip_ptr) -> nx_ip_udp_invalid_packets++;
+
+                    /* Increment the UDP checksum error count for this socket.  */
+                    socket_ptr -> nx_udp_socket_checksum_errors++;
+
+                    /* Decrement the total UDP receive packets count.  */
+                    (socket_ptr -> nx_udp_socket_ip_ptr) -> nx_ip_udp_packets_received--;
+
+                    /* Decrement the total UDP receive bytes.  */
+                    (socket_ptr -> nx_udp_socket_ip_ptr) -> nx_ip_udp_bytes_received -=  packet_ptr -> nx_packet_length - sizeof(NX_UDP_HEADER);
+
+                    /* Decrement the total UDP receive packets count.  */
+                    socket_ptr -> nx_udp_socket_packets_received--;
+
+                    /* Decrement the total UDP receive bytes.  */
+                    socket_ptr -> nx_udp_socket_bytes_received -=  packet_ptr -> nx_packet_length - sizeof(NX_UDP_HEADER);
+
+                    /* Restore interrupts.  */
+                    TX_RESTORE
+#endif
+
+                    /* Bad UDP checksum.  Release the packet. */
+                    _nx_packet_release(packet_ptr);
+
+#ifdef NX_ENABLE_UDP_RECEIVE_BUDGET
+
+                    /* Disable interrupts.  */
+                    TX_DISABLE
+
+                    /* Increment the checksum drop count for this socket.  */
+                    socket_ptr -> nx_udp_socket_drops_checksum++;
+
+                    /* Restore interrupts.  */
+                    TX_RESTORE
+
+                    /* Record the drop against the drop notify threshold.  */
+                    _nx_udp_socket_drop_record(socket_ptr, 1);
+#endif /* NX_ENABLE_UDP_RECEIVE_BUDGET */
+                    continue;
+                }
+            }
+#endif
+
+            /* Remove the UDP header.  */
+            packet_ptr -> nx_packet_length =       packet_ptr -> nx_packet_length - sizeof(NX_UDP_HEADER);
+            packet_ptr -> nx_packet_prepend_ptr =  packet_ptr -> nx_packet_prepend_ptr + sizeof(NX_UDP_HEADER);
+
+            /* Keep the packet in the array.  */
+            packet_array[count++] =  packet_ptr;
+        }
+    }
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_UDP_SOCKET_RECEIVE_BATCH, socket_ptr -> nx_udp_socket_ip_ptr, socket_ptr, array_size, count, NX_TRACE_UDP_EVENTS, 0, 0)
+
+    /* Return the number of packets received.  */
+    *received_count =  count;
+
+    /* Return a successful status to the caller.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_UDP_BATCH */
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    NX_PARAMETER_NOT_USED(packet_array);
+    NX_PARAMETER_NOT_USED(array_size);
+    NX_PARAMETER_NOT_USED(received_count);
+    NX_PARAMETER_NOT_USED(wait_option);
+
+    return(NX_NOT_SUPPORTED);
+#endif /* NX_ENABLE_UDP_BATCH */
+}
+
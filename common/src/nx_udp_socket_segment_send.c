@@ -0,0 +1,364 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   User Datagram Protocol (UDP)                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_udp.h"
+#include "nx_ip.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_udp_socket_segment_send                         PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends the payload of the supplied packet through the  */
+/*    supplied socket as a train of UDP datagrams to the supplied IP      */
+/*    address and port.  Each datagram carries segment_size bytes of the  */
+/*    payload, except the last which carries the rest.                    */
+/*                                                                        */
+/*    The route is looked up once for the whole train and the UDP headers */
+/*    are built from a single template.  All datagrams are allocated from */
+/*    the default packet pool before any is sent, so the payload is       */
+/*    either sent completely or not at all; on success the supplied       */
+/*    packet is released.  The datagrams are passed to IP under one hold  */
+/*    of the IP protection mutex as one transmit burst.                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to UDP socket         */
+/*    packet_ptr                            Pointer to UDP payload        */
+/*    ip_address                            IP address                    */
+/*    port                                  16-bit UDP port number        */
+/*    segment_size                          Payload size of each datagram */
+/*    wait_option                           Suspension option for         */
+/*                                            allocating the datagrams    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_destination_cache_route        Find route using destination  */
+/*                                            cache                       */
+/*    _nx_ip_packet_send                    Send the UDP packet over IP   */
+/*    _nx_ip_route_find                     Find a suitable outgoing      */
+/*                                            interface                   */
+/*    _nx_ip_transmit_burst_end             End transmit burst            */
+/*    _nx_packet_allocate                   Allocate a datagram           */
+/*    _nx_packet_release                    Release packet                */
+/*    _nx_udp_checksum                      Compute UDP checksum          */
+/*    _nx_udp_socket_send                   Send a single datagram        */
+/*    tx_mutex_get                          Get protection mutex          */
+/*    tx_mutex_put                          Put protection mutex          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_udp_socket_segment_send(NX_UDP_SOCKET *socket_ptr, NX_PACKET *packet_ptr,
+                                  ULONG ip_address, UINT port, ULONG segment_size, ULONG wait_option)
+{
+#ifdef NX_ENABLE_UDP_SEGMENTATION
+TX_INTERRUPT_SAVE_AREA
+
+UINT           status;
+ULONG          remaining;
+ULONG          data_size;
+ULONG          copy_size;
+ULONG          segment_count;
+ULONG          header_word_0;
+UCHAR         *source_ptr;
+NX_PACKET     *source_packet;
+NX_PACKET     *segment_ptr;
+NX_PACKET     *head_ptr;
+NX_PACKET     *tail_ptr;
+NX_IP         *ip_ptr;
+NX_UDP_HEADER *udp_header_ptr;
+#ifndef NX_DISABLE_UDP_TX_CHECKSUM
+ULONG          checksum;
+#endif
+
+
+    /* Determine if the payload fits in a single datagram.  */
+    if (packet_ptr -> nx_packet_length <= segment_size)
+    {
+
+        /* Yes, just send it as is.  */
+        return(_nx_udp_socket_send(socket_ptr, packet_ptr, ip_address, port));
+    }
+
+    /* Lockout interrupts.  */
+    TX_DISABLE
+
+    /* Determine if the socket is currently bound.  */
+    if (!socket_ptr ->  nx_udp_socket_bound_next)
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Socket is not bound, return an error message.  */
+        return(NX_NOT_BOUND);
+    }
+
+    /* Setup the pointer to the associated IP instance.  */
+    ip_ptr =  socket_ptr -> nx_udp_socket_ip_ptr;
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_UDP_SOCKET_SEGMENT_SEND, socket_ptr, packet_ptr, packet_ptr -> nx_packet_length, segment_size, NX_TRACE_UDP_EVENTS, 0, 0)
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Determine if a datagram fits in a packet of the default packet pool.  */
+    if ((segment_size + NX_UDP_PACKET) > ip_ptr -> nx_ip_default_packet_pool -> nx_packet_pool_payload_size)
+    {
+
+        /* Return a size error.  */
+        return(NX_SIZE_ERROR);
+    }
+
+    /* If the packet does not have outgoing interface defined, pick up the outgoing interface from the socket structure. */
+    if (packet_ptr -> nx_packet_ip_interface == NX_NULL)
+    {
+        packet_ptr -> nx_packet_ip_interface = socket_ptr -> nx_udp_socket_ip_interface;
+    }
+
+    /* Call IP routing service once to find the best interface for transmitting the datagrams. */
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+
+    /* Get mutex protection, since the destination cache is shared by all threads
+       sending on the socket.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    status =  _nx_ip_destination_cache_route(ip_ptr, &(socket_ptr -> nx_udp_socket_destination_cache), ip_address, packet_ptr);
+
+    /* Release mutex protection.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+#else
+    status =  _nx_ip_route_find(ip_ptr, ip_address, &packet_ptr -> nx_packet_ip_interface, &packet_ptr -> nx_packet_next_hop_address);
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
+    if (status != NX_SUCCESS)
+    {
+        return(NX_IP_ADDRESS_ERROR);
+    }
+
+    /* Build the first 32-bit word of the UDP header template, which is the same for all
+       datagrams, in network byte order.  */
+    header_word_0 =  (((ULONG)socket_ptr -> nx_udp_socket_port) << NX_SHIFT_BY_16) | (ULONG)port;
+    NX_CHANGE_ULONG_ENDIAN(header_word_0);
+
+    /* Setup the source of the payload.  */
+    source_packet =  packet_ptr;
+    source_ptr =     packet_ptr -> nx_packet_prepend_ptr;
+    remaining =      packet_ptr -> nx_packet_length;
+
+    /* Loop to build the datagrams.  */
+    head_ptr =       NX_NULL;
+    tail_ptr =       NX_NULL;
+    segment_count =  0;
+    while (remaining)
+    {
+
+        /* Allocate a packet for the datagram.  */
+        status =  _nx_packet_allocate(ip_ptr -> nx_ip_default_packet_pool, &segment_ptr, NX_UDP_PACKET, wait_option);
+
+        /* Determine if the allocation failed.  */
+        if (status != NX_SUCCESS)
+        {
+
+            /* Loop to release the datagrams built so far.  */
+            while (head_ptr)
+            {
+                segment_ptr =  head_ptr;
+                head_ptr =     head_ptr -> nx_packet_queue_next;
+                _nx_packet_release(segment_ptr);
+            }
+
+            /* Return the allocation error, the payload still belongs to the caller.  */
+            return(status);
+        }
+
+        /* Calculate the payload size of this datagram.  */
+        data_size =  (remaining < segment_size) ? remaining : segment_size;
+        remaining -= data_size;
+        segment_ptr -> nx_packet_length =  data_size;
+
+        /* Loop to copy the payload of this datagram.  */
+        while (data_size)
+        {
+
+            /* Calculate the bytes left in the current packet of the payload.  */
+            copy_size =  (ULONG)(source_packet -> nx_packet_append_ptr - source_ptr);
+
+            /* Determine if the current packet is used up.  */
+            if (copy_size == 0)
+            {
+
+                /* Move to the next packet of the payload.  */
+                source_packet =  source_packet -> nx_packet_next;
+                source_ptr =     source_packet -> nx_packet_prepend_ptr;
+                continue;
+            }
+
+            /* Limit the copy to the rest of this datagram.  */
+            if (copy_size > data_size)
+            {
+                copy_size =  data_size;
+            }
+
+            /* Copy the data into the datagram.  */
+            memcpy(segment_ptr -> nx_packet_append_ptr, source_ptr, copy_size); /* Use case of memcpy is verified. */
+            segment_ptr -> nx_packet_append_ptr =  segment_ptr -> nx_packet_append_ptr + copy_size;
+            source_ptr =  source_ptr + copy_size;
+            data_size =   data_size - copy_size;
+        }
+
+        /* Use the route found for the payload.  */
+        segment_ptr -> nx_packet_ip_interface =      packet_ptr -> nx_packet_ip_interface;
+        segment_ptr -> nx_packet_next_hop_address =  packet_ptr -> nx_packet_next_hop_address;
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+        segment_ptr -> nx_packet_destination_cache = packet_ptr -> nx_packet_destination_cache;
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
+
+        /* Prepend the UDP header to the datagram.  */
+        segment_ptr -> nx_packet_prepend_ptr =  segment_ptr -> nx_packet_prepend_ptr - sizeof(NX_UDP_HEADER);
+        segment_ptr -> nx_packet_length =       segment_ptr -> nx_packet_length + sizeof(NX_UDP_HEADER);
+
+        /* Build the UDP header from the template.  */
+        udp_header_ptr =  (NX_UDP_HEADER *)segment_ptr -> nx_packet_prepend_ptr;
+        udp_header_ptr -> nx_udp_header_word_0 =  header_word_0;
+        udp_header_ptr -> nx_udp_header_word_1 =  (segment_ptr -> nx_packet_length << NX_SHIFT_BY_16);
+        NX_CHANGE_ULONG_ENDIAN(udp_header_ptr -> nx_udp_header_word_1);
+
+#ifndef NX_DISABLE_UDP_TX_CHECKSUM
+
+        /* Determine if we need to compute the UDP checksum.  */
+        if (!socket_ptr -> nx_udp_socket_disable_checksum)
+        {
+
+            /* Compute the checksum of the datagram.  */
+            checksum =  _nx_udp_checksum(segment_ptr, segment_ptr -> nx_packet_ip_interface -> nx_interface_ip_address, ip_address);
+
+            /* Place the checksum in the second word of the UDP header.  */
+            NX_CHANGE_ULONG_ENDIAN(udp_header_ptr -> nx_udp_header_word_1);
+            udp_header_ptr -> nx_udp_header_word_1 =  udp_header_ptr -> nx_udp_header_word_1 | checksum;
+            NX_CHANGE_ULONG_ENDIAN(udp_header_ptr -> nx_udp_header_word_1);
+        }
+#endif
+
+        /* Link the datagram to the end of the train.  */
+        segment_ptr -> nx_packet_queue_next =  NX_NULL;
+        if (tail_ptr)
+        {
+            tail_ptr -> nx_packet_queue_next =  segment_ptr;
+        }
+        else
+        {
+            head_ptr =  segment_ptr;
+        }
+        tail_ptr =  segment_ptr;
+        segment_count++;
+    }
+
+#ifndef NX_DISABLE_UDP_INFO
+    /* Increment the total UDP packets sent count.  */
+    ip_ptr -> nx_ip_udp_packets_sent +=  segment_count;
+
+    /* Increment the total UDP bytes sent.  */
+    ip_ptr -> nx_ip_udp_bytes_sent +=  packet_ptr -> nx_packet_length;
+
+    /* Increment the total UDP packets sent count for this socket.  */
+    socket_ptr -> nx_udp_socket_packets_sent +=  segment_count;
+
+    /* Increment the total UDP bytes sent for this socket.  */
+    socket_ptr -> nx_udp_socket_bytes_sent +=  packet_ptr -> nx_packet_length;
+#endif
+
+    /* The payload has been copied, release the supplied packet.  */
+    _nx_packet_release(packet_ptr);
+
+    /* Get mutex protection.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Start a transmit burst, so the driver may post the datagrams together.  */
+    NX_IP_TRANSMIT_BURST_START(ip_ptr);
+
+    /* Loop to send the datagrams to the IP component.  */
+    while (head_ptr)
+    {
+
+        /* Unlink the datagram from the train before IP takes it.  */
+        segment_ptr =  head_ptr;
+        head_ptr =     head_ptr -> nx_packet_queue_next;
+        segment_ptr -> nx_packet_queue_next =  NX_NULL;
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        NX_TRACE_IN_LINE_INSERT(NX_TRACE_INTERNAL_UDP_SEND, ip_ptr, socket_ptr, segment_ptr, header_word_0, NX_TRACE_INTERNAL_EVENTS, 0, 0)
+
+        /* Send the UDP datagram to the IP component.  */
+        _nx_ip_packet_send(ip_ptr, segment_ptr, ip_address,
+                           socket_ptr -> nx_udp_socket_type_of_service, socket_ptr -> nx_udp_socket_time_to_live, NX_IP_UDP, socket_ptr -> nx_udp_socket_fragment_enable);
+    }
+
+    /* End the transmit burst.  */
+    NX_IP_TRANSMIT_BURST_END(ip_ptr);
+
+    /* Release mutex protection.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Return a successful status.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_UDP_SEGMENTATION */
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    NX_PARAMETER_NOT_USED(packet_ptr);
+    NX_PARAMETER_NOT_USED(ip_address);
+    NX_PARAMETER_NOT_USED(port);
+    NX_PARAMETER_NOT_USED(segment_size);
+    NX_PARAMETER_NOT_USED(wait_option);
+
+    return(NX_NOT_SUPPORTED);
+#endif /* NX_ENABLE_UDP_SEGMENTATION */
+}
+
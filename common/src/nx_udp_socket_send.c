@@ -58,7 +58,10 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_ip_destination_cache_route        Find route using destination  */
+/*                                            cache                       */
 /*    _nx_ip_packet_send                    Send the UDP packet over IP   */
+/*    _nx_udp_checksum                      Compute UDP checksum          */
 /*    nx_ip_route_find                      Find a suitable outgoing      */
 /*                                            interface.                  */
 /*    tx_mutex_get                          Get protection mutex          */
@@ -82,14 +85,8 @@ TX_INTERRUPT_SAVE_AREA
 
 #ifndef NX_DISABLE_UDP_TX_CHECKSUM
 ULONG          checksum;
-ULONG          length;
-ULONG          temp;
-UCHAR         *word_ptr;
-ULONG          packet_length;
-ULONG          adjusted_packet_length;
-NX_PACKET     *current_packet;
-UCHAR         *pad_ptr;
 #endif
+UINT           status;
 NX_IP         *ip_ptr;
 NX_UDP_HEADER *udp_header_ptr;
 
@@ -125,8 +122,25 @@ NX_UDP_HEADER *udp_header_ptr;
     }
 
     /* Call IP routing service to find the best interface for transmitting this packet. */
-    if (_nx_ip_route_find(ip_ptr, ip_address, &packet_ptr -> nx_packet_ip_interface, &packet_ptr -> nx_packet_next_hop_address) != NX_SUCCESS)
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+
+    /* Get mutex protection, since the destination cache is shared by all threads
+       sending on the socket.  The mutex is held until the packet is sent, so it is
+       only taken once per packet.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    status =  _nx_ip_destination_cache_route(ip_ptr, &(socket_ptr -> nx_udp_socket_destination_cache), ip_address, packet_ptr);
+#else
+    status =  _nx_ip_route_find(ip_ptr, ip_address, &packet_ptr -> nx_packet_ip_interface, &packet_ptr -> nx_packet_next_hop_address);
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
+    if (status != NX_SUCCESS)
     {
+
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+        /* Release mutex protection.  */
+        tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
+
         return(NX_IP_ADDRESS_ERROR);
     }
 
@@ -175,119 +189,19 @@ NX_UDP_HEADER *udp_header_ptr;
     {
 
         /* Yes, we need to compute the UDP checksum.  */
+        checksum =  _nx_udp_checksum(packet_ptr, packet_ptr -> nx_packet_ip_interface -> nx_interface_ip_address, ip_address);
 
-        /* First calculate the checksum of the pseudo UDP header that includes the source IP
-           address, destination IP address, protocol word, and the UDP length.  */
-        temp =  packet_ptr -> nx_packet_ip_interface -> nx_interface_ip_address;
-        checksum =  (temp >> NX_SHIFT_BY_16);
-        checksum += (temp & NX_LOWER_16_MASK);
-        checksum += (ip_address >> NX_SHIFT_BY_16);
-        checksum += (ip_address & NX_LOWER_16_MASK);
-        checksum += (NX_IP_UDP >> NX_SHIFT_BY_16);
-        checksum += packet_ptr -> nx_packet_length;
-
-        /* Setup the length of the packet checksum.  */
-        length =  packet_ptr -> nx_packet_length;
-
-        /* Initialize the current packet to the input packet pointer.  */
-        current_packet =  packet_ptr;
-
-        /* Loop to calculate the packet's checksum.  */
-        while (length)
-        {
-            /* Calculate the current packet length.  */
-            packet_length =  (ULONG)(current_packet -> nx_packet_append_ptr - current_packet -> nx_packet_prepend_ptr);
-
-            /* Make the adjusted packet length evenly divisible by sizeof(ULONG).  */
-            adjusted_packet_length =  ((packet_length + (sizeof(ULONG) - 1)) / sizeof(ULONG)) * sizeof(ULONG);
-
-            /* Determine if we need to add padding bytes.  */
-            if (packet_length < adjusted_packet_length)
-            {
-
-                /* Calculate how many bytes we need to zero at the end of the packet.  */
-                temp =  adjusted_packet_length - packet_length;
-
-                /* Setup temporary pointer to the current packet's append pointer.  */
-                pad_ptr =  current_packet -> nx_packet_append_ptr;
-
-                /* Loop to pad current packet with 0s so we don't have to worry about a partial last word.  */
-                while (temp)
-                {
-
-                    /* Check for the end of the packet.  */
-                    if (pad_ptr >= current_packet -> nx_packet_data_end)
-                    {
-                        break;
-                    }
-
-                    /* Write a 0. */
-                    *pad_ptr++ =  0;
-
-                    /* Decrease the pad count.  */
-                    temp--;
-                }
-            }
-
-
-            /* Setup the pointer to the start of the packet.  */
-            word_ptr =  (UCHAR *)current_packet -> nx_packet_prepend_ptr;
-
-            /* Now loop through the current packet to compute the checksum on this packet.  */
-            while (adjusted_packet_length)
-            {
-
-                /* Pickup a whole ULONG.  */
-                temp =  *((ULONG *)word_ptr);
-
-                /* Endian swapping logic.  If NX_LITTLE_ENDIAN is specified, these macros will
-                   swap the endian of the long word in the message.  */
-                NX_CHANGE_ULONG_ENDIAN(temp);
-
-                /* Add upper 16-bits into checksum.  */
-                checksum =  checksum + (temp >> NX_SHIFT_BY_16);
-
-                /* Add lower 16-bits into checksum.  */
-                checksum =  checksum + (temp & NX_LOWER_16_MASK);
-
-                /* Move the word pointer and decrease the length.  */
-                word_ptr =  word_ptr + sizeof(ULONG);
-                adjusted_packet_length = adjusted_packet_length - sizeof(ULONG);
-            }
-
-            /* Adjust the checksum length.  */
-            length =  length - packet_length;
-
-            /* Determine if we are at the end of the current packet.  */
-            if ((length) && (word_ptr >= (UCHAR *)current_packet -> nx_packet_append_ptr) &&
-                (current_packet -> nx_packet_next))
-            {
-
-                /* We have crossed the packet boundary.  Move to the next packet
-                   structure.  */
-                current_packet =  current_packet -> nx_packet_next;
-
-                /* Setup the new word pointer.  */
-                word_ptr =  (UCHAR *)current_packet -> nx_packet_prepend_ptr;
-            }
-        }
-
-        /* Add in the carry bits into the checksum.  */
-        checksum = (checksum >> NX_SHIFT_BY_16) + (checksum & NX_LOWER_16_MASK);
-
-        /* Do it again in case previous operation generates an overflow.  */
-        checksum = (checksum >> NX_SHIFT_BY_16) + (checksum & NX_LOWER_16_MASK);
-
-        /* Place the packet in the second word of the UDP header.  */
+        /* Place the checksum in the second word of the UDP header.  */
         NX_CHANGE_ULONG_ENDIAN(udp_header_ptr -> nx_udp_header_word_1);
-        udp_header_ptr -> nx_udp_header_word_1 =  udp_header_ptr -> nx_udp_header_word_1 |
-            (~checksum & NX_LOWER_16_MASK);
+        udp_header_ptr -> nx_udp_header_word_1 =  udp_header_ptr -> nx_udp_header_word_1 | checksum;
         NX_CHANGE_ULONG_ENDIAN(udp_header_ptr -> nx_udp_header_word_1);
     }
 #endif
 
+#ifndef NX_ENABLE_IP_DESTINATION_CACHE
     /* Get mutex protection.  */
     tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
 
     /* Send the UDP packet to the IP component.  */
     _nx_ip_packet_send(ip_ptr, packet_ptr, ip_address,
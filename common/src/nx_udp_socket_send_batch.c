@@ -0,0 +1,295 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   User Datagram Protocol (UDP)                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_udp.h"
+#include "nx_ip.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_udp_socket_send_batch                           PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends an array of UDP packets through the supplied    */
+/*    socket, each to the IP address and port of its entry.  The route is */
+/*    looked up once for each run of entries to the same destination.     */
+/*    The route lookups and the sends of the whole batch are done under a */
+/*    single hold of the IP protection mutex, as one transmit burst.      */
+/*                                                                        */
+/*    Entries are sent in order.  If the route to an entry cannot be      */
+/*    found, that entry and the ones after it are not sent and remain     */
+/*    owned by the caller.  The number of entries sent is returned in     */
+/*    either case.                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to UDP socket         */
+/*    entry_array                           Array of packets to send      */
+/*    entry_count                           Number of entries             */
+/*    sent_count                            Pointer to destination for the*/
+/*                                            number of entries sent      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_destination_cache_route        Find route using destination  */
+/*                                            cache                       */
+/*    _nx_ip_packet_send                    Send the UDP packet over IP   */
+/*    _nx_ip_route_find                     Find a suitable outgoing      */
+/*                                            interface                   */
+/*    _nx_udp_checksum                      Compute UDP checksum          */
+/*    _nx_ip_transmit_burst_end             End transmit burst            */
+/*    tx_mutex_get                          Get protection mutex          */
+/*    tx_mutex_put                          Put protection mutex          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_udp_socket_send_batch(NX_UDP_SOCKET *socket_ptr, NX_UDP_SEND_ENTRY *entry_array,
+                                UINT entry_count, UINT *sent_count)
+{
+#ifdef NX_ENABLE_UDP_BATCH
+TX_INTERRUPT_SAVE_AREA
+
+UINT           ready_count;
+UINT           status;
+ULONG          ip_address;
+ULONG          route_address;
+NX_INTERFACE  *route_interface;
+NX_PACKET     *packet_ptr;
+ULONG          route_next_hop;
+NX_INTERFACE  *route_outgoing;
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+NX_IP_DESTINATION_CACHE
+              *route_cache;
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
+NX_IP         *ip_ptr;
+NX_UDP_HEADER *udp_header_ptr;
+#ifndef NX_DISABLE_UDP_TX_CHECKSUM
+ULONG          checksum;
+#endif
+
+
+    /* Set the sent count to zero initially.  */
+    *sent_count =  0;
+
+    /* Lockout interrupts.  */
+    TX_DISABLE
+
+    /* Determine if the socket is currently bound.  */
+    if (!socket_ptr ->  nx_udp_socket_bound_next)
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Socket is not bound, return an error message.  */
+        return(NX_NOT_BOUND);
+    }
+
+    /* Setup the pointer to the associated IP instance.  */
+    ip_ptr =  socket_ptr -> nx_udp_socket_ip_ptr;
+
+    /* If trace is enabled, insert this event into the trace buffer.  */
+    NX_TRACE_IN_LINE_INSERT(NX_TRACE_UDP_SOCKET_SEND_BATCH, socket_ptr, entry_array, entry_count, 0, NX_TRACE_UDP_EVENTS, 0, 0)
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Initialize the route of the previous entry.  */
+    status =           NX_SUCCESS;
+    route_address =    0;
+    route_interface =  NX_NULL;
+    route_outgoing =   NX_NULL;
+    route_next_hop =   0;
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+    route_cache =      NX_NULL;
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
+
+    /* Get mutex protection.  The route lookups, the UDP headers and the sends of the whole
+       batch are done under this single hold of the mutex.  */
+    tx_mutex_get(&(ip_ptr -> nx_ip_protection), TX_WAIT_FOREVER);
+
+    /* Start a transmit burst, so the driver may post the packets together.  */
+    NX_IP_TRANSMIT_BURST_START(ip_ptr);
+
+    /* Loop to build and send the UDP packets.  */
+    for (ready_count = 0; ready_count < entry_count; ready_count++)
+    {
+
+        /* Pickup the packet and its destination.  */
+        packet_ptr =  entry_array[ready_count].nx_udp_send_entry_packet;
+        ip_address =  entry_array[ready_count].nx_udp_send_entry_ip_address;
+
+        /* If the packet does not have outgoing interface defined, pick up the outgoing interface from the socket structure. */
+        if (packet_ptr -> nx_packet_ip_interface == NX_NULL)
+        {
+            packet_ptr -> nx_packet_ip_interface = socket_ptr -> nx_udp_socket_ip_interface;
+        }
+
+        /* Determine if the packet goes to the same destination as the previous one.  */
+        if ((route_outgoing) && (ip_address == route_address) &&
+            (packet_ptr -> nx_packet_ip_interface == route_interface))
+        {
+
+            /* Yes, reuse the route of the previous packet.  That packet has already been
+               sent and may be released, so the route is kept in local variables.  */
+            packet_ptr -> nx_packet_ip_interface =      route_outgoing;
+            packet_ptr -> nx_packet_next_hop_address =  route_next_hop;
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+            packet_ptr -> nx_packet_destination_cache = route_cache;
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
+        }
+        else
+        {
+
+            /* Remember the destination and the requested interface.  */
+            route_address =    ip_address;
+            route_interface =  packet_ptr -> nx_packet_ip_interface;
+
+            /* Call IP routing service to find the best interface for transmitting this packet. */
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+            status =  _nx_ip_destination_cache_route(ip_ptr, &(socket_ptr -> nx_udp_socket_destination_cache), ip_address, packet_ptr);
+#else
+            status =  _nx_ip_route_find(ip_ptr, ip_address, &packet_ptr -> nx_packet_ip_interface, &packet_ptr -> nx_packet_next_hop_address);
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
+            if (status != NX_SUCCESS)
+            {
+
+                /* Stop at this entry, the ones before it have been sent.  */
+                status =  NX_IP_ADDRESS_ERROR;
+                break;
+            }
+        }
+
+        /* Remember the route of this packet.  */
+        route_outgoing =  packet_ptr -> nx_packet_ip_interface;
+        route_next_hop =  packet_ptr -> nx_packet_next_hop_address;
+#ifdef NX_ENABLE_IP_DESTINATION_CACHE
+        route_cache =     packet_ptr -> nx_packet_destination_cache;
+#endif /* NX_ENABLE_IP_DESTINATION_CACHE */
+
+        /* Prepend the UDP header to the packet.  First, make room for the UDP header.  */
+        packet_ptr -> nx_packet_prepend_ptr =  packet_ptr -> nx_packet_prepend_ptr - sizeof(NX_UDP_HEADER);
+
+#ifndef NX_DISABLE_UDP_INFO
+        /* Increment the total UDP packets sent count.  */
+        ip_ptr -> nx_ip_udp_packets_sent++;
+
+        /* Increment the total UDP bytes sent.  */
+        ip_ptr -> nx_ip_udp_bytes_sent +=  packet_ptr -> nx_packet_length;
+
+        /* Increment the total UDP packets sent count for this socket.  */
+        socket_ptr -> nx_udp_socket_packets_sent++;
+
+        /* Increment the total UDP bytes sent for this socket.  */
+        socket_ptr -> nx_udp_socket_bytes_sent +=  packet_ptr -> nx_packet_length;
+#endif
+
+        /* Increase the packet length.  */
+        packet_ptr -> nx_packet_length =  packet_ptr -> nx_packet_length + sizeof(NX_UDP_HEADER);
+
+        /* Setup the UDP header pointer.  */
+        udp_header_ptr =  (NX_UDP_HEADER *)packet_ptr -> nx_packet_prepend_ptr;
+
+        /* Build the first 32-bit word of the UDP header.  */
+        udp_header_ptr -> nx_udp_header_word_0 =  (((ULONG)socket_ptr -> nx_udp_socket_port) << NX_SHIFT_BY_16) |
+                                                  (ULONG)entry_array[ready_count].nx_udp_send_entry_port;
+
+        /* Build the second 32-bit word of the UDP header.  */
+        udp_header_ptr -> nx_udp_header_word_1 =  (packet_ptr -> nx_packet_length << NX_SHIFT_BY_16);
+
+        /* If trace is enabled, insert this event into the trace buffer.  */
+        NX_TRACE_IN_LINE_INSERT(NX_TRACE_INTERNAL_UDP_SEND, ip_ptr, socket_ptr, packet_ptr, udp_header_ptr -> nx_udp_header_word_0, NX_TRACE_INTERNAL_EVENTS, 0, 0)
+
+        /* Endian swapping logic.  If NX_LITTLE_ENDIAN is specified, these macros will
+           swap the endian of the UDP header.  */
+        NX_CHANGE_ULONG_ENDIAN(udp_header_ptr -> nx_udp_header_word_0);
+        NX_CHANGE_ULONG_ENDIAN(udp_header_ptr -> nx_udp_header_word_1);
+
+#ifndef NX_DISABLE_UDP_TX_CHECKSUM
+
+        /* Determine if we need to compute the UDP checksum.  */
+        if (!socket_ptr -> nx_udp_socket_disable_checksum)
+        {
+
+            /* Compute the checksum of the packet.  */
+            checksum =  _nx_udp_checksum(packet_ptr, packet_ptr -> nx_packet_ip_interface -> nx_interface_ip_address, ip_address);
+
+            /* Place the checksum in the second word of the UDP header.  */
+            NX_CHANGE_ULONG_ENDIAN(udp_header_ptr -> nx_udp_header_word_1);
+            udp_header_ptr -> nx_udp_header_word_1 =  udp_header_ptr -> nx_udp_header_word_1 | checksum;
+            NX_CHANGE_ULONG_ENDIAN(udp_header_ptr -> nx_udp_header_word_1);
+        }
+#endif
+
+        /* Send the UDP packet to the IP component.  */
+        _nx_ip_packet_send(ip_ptr, packet_ptr, ip_address,
+                           socket_ptr -> nx_udp_socket_type_of_service, socket_ptr -> nx_udp_socket_time_to_live, NX_IP_UDP, socket_ptr -> nx_udp_socket_fragment_enable);
+    }
+
+    /* End the transmit burst.  */
+    NX_IP_TRANSMIT_BURST_END(ip_ptr);
+
+    /* Release mutex protection.  */
+    tx_mutex_put(&(ip_ptr -> nx_ip_protection));
+
+    /* Return the number of packets sent.  */
+    *sent_count =  ready_count;
+
+    /* Return completion status.  */
+    return(status);
+
+#else /* !NX_ENABLE_UDP_BATCH */
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    NX_PARAMETER_NOT_USED(entry_array);
+    NX_PARAMETER_NOT_USED(entry_count);
+    NX_PARAMETER_NOT_USED(sent_count);
+
+    return(NX_NOT_SUPPORTED);
+#endif /* NX_ENABLE_UDP_BATCH */
+}
+
@@ -58,6 +58,10 @@
 /*                                                                        */
 /*    _nx_packet_release                    Release data packet           */
 /*    _nx_udp_bind_cleanup                  Remove and cleanup bind req   */
+/*    _nx_udp_port_bitmap_release           Release port in bitmap        */
+/*    _nx_udp_socket_connected_link         Add to connected socket table */
+/*    _nx_udp_socket_connected_unlink       Remove from connected socket  */
+/*                                            table                       */
 /*    tx_mutex_get                          Obtain protection mutex       */
 /*    tx_mutex_put                          Release protection mutex      */
 /*    _tx_thread_system_resume              Resume suspended thread       */
@@ -136,6 +140,16 @@ NX_PACKET     *next_packet_ptr;
     /* Calculate the hash index in the UDP port array of the associated IP instance.  */
     index =  (UINT)((port + (port >> 8)) & NX_UDP_PORT_TABLE_MASK);
 
+#ifdef NX_ENABLE_UDP_FLOW_DEMUX
+    /* Determine if the socket is connected.  */
+    if (socket_ptr -> nx_udp_socket_peer_address)
+    {
+
+        /* Remove the socket from the connected socket table.  */
+        _nx_udp_socket_connected_unlink(socket_ptr);
+    }
+#endif /* NX_ENABLE_UDP_FLOW_DEMUX */
+
     /* Disable interrupts while we unlink the current socket.  */
     TX_DISABLE
 
@@ -195,6 +209,9 @@ NX_PACKET     *next_packet_ptr;
             /* Pickup the next queued packet.  */
             next_packet_ptr =  packet_ptr -> nx_packet_queue_next;
 
+            /* Decrease the queued byte count.  */
+            NX_UDP_RECEIVE_BYTES_REMOVE(socket_ptr, packet_ptr);
+
             /* Release the packet.  */
             _nx_packet_release(packet_ptr);
 
@@ -335,6 +352,16 @@ NX_PACKET     *next_packet_ptr;
         /* Put return status into the thread control block.  */
         thread_ptr -> tx_thread_suspend_status =  NX_SUCCESS;
 
+#ifdef NX_ENABLE_UDP_FLOW_DEMUX
+        /* Determine if the new socket is connected.  */
+        if (new_socket_ptr -> nx_udp_socket_peer_address)
+        {
+
+            /* Add the new socket to the connected socket table.  */
+            _nx_udp_socket_connected_link(new_socket_ptr);
+        }
+#endif /* NX_ENABLE_UDP_FLOW_DEMUX */
+
         /* Release the mutex protection.  */
         tx_mutex_put(&(ip_ptr -> nx_ip_protection));
 
@@ -347,6 +374,11 @@ NX_PACKET     *next_packet_ptr;
         /* Restore interrupts.  */
         TX_RESTORE
 
+#ifdef NX_ENABLE_EPHEMERAL_PORT_BITMAP
+        /* Mark the port as free in the ephemeral port bitmap, unless another socket is still bound to it.  */
+        _nx_udp_port_bitmap_release(ip_ptr, port);
+#endif /* NX_ENABLE_EPHEMERAL_PORT_BITMAP */
+
         /* Release the mutex protection.  */
         tx_mutex_put(&(ip_ptr -> nx_ip_protection));
 
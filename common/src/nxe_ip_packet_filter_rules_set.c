@@ -0,0 +1,146 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Internet Protocol (IP)                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+
+
+/* Bring in externs for caller checking code.  */
+
+NX_CALLER_CHECKING_EXTERNS
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_ip_packet_filter_rules_set                     PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the IP packet filter rules set   */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP control block   */
+/*    rule_array                            Pointer to array of rules     */
+/*    rule_count                            Number of rules in the array  */
+/*    default_action                        Action for packets matching no*/
+/*                                            rule                        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_ip_packet_filter_rules_set        Actual IP packet filter rules */
+/*                                            set function                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxe_ip_packet_filter_rules_set(NX_IP *ip_ptr, NX_IP_PACKET_FILTER_RULE *rule_array, UINT rule_count, UINT default_action)
+{
+#ifdef NX_ENABLE_IP_PACKET_FILTER
+
+UINT status;
+UINT i;
+
+
+    /* Check for invalid input pointers.  */
+    if ((ip_ptr == NX_NULL) || (ip_ptr -> nx_ip_id != NX_IP_ID) || ((rule_array == NX_NULL) && rule_count))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for too many rules.  */
+    if (rule_count > NX_IP_PACKET_FILTER_MAX_RULES)
+    {
+        return(NX_SIZE_ERROR);
+    }
+
+    /* Check for an invalid default action.  */
+    if ((default_action != NX_IP_PACKET_FILTER_ACCEPT) && (default_action != NX_IP_PACKET_FILTER_DROP))
+    {
+        return(NX_OPTION_ERROR);
+    }
+
+    /* Check each rule.  */
+    for (i = 0; i < rule_count; i++)
+    {
+
+        /* Check for an invalid action, or a rate limit without a rate.  */
+        if ((rule_array[i].nx_ip_packet_filter_rule_action > NX_IP_PACKET_FILTER_RATE_LIMIT) ||
+            ((rule_array[i].nx_ip_packet_filter_rule_action == NX_IP_PACKET_FILTER_RATE_LIMIT) &&
+             (rule_array[i].nx_ip_packet_filter_rule_rate == 0)))
+        {
+            return(NX_OPTION_ERROR);
+        }
+
+        /* Check for empty port ranges.  */
+        if (((rule_array[i].nx_ip_packet_filter_rule_source_port_high) &&
+             (rule_array[i].nx_ip_packet_filter_rule_source_port_low > rule_array[i].nx_ip_packet_filter_rule_source_port_high)) ||
+            ((rule_array[i].nx_ip_packet_filter_rule_destination_port_high) &&
+             (rule_array[i].nx_ip_packet_filter_rule_destination_port_low > rule_array[i].nx_ip_packet_filter_rule_destination_port_high)))
+        {
+            return(NX_INVALID_PORT);
+        }
+    }
+
+    /* Check for appropriate caller.  */
+    NX_INIT_AND_THREADS_CALLER_CHECKING
+
+    /* Call actual IP packet filter rules set function.  */
+    status =  _nx_ip_packet_filter_rules_set(ip_ptr, rule_array, rule_count, default_action);
+
+    /* Return completion status.  */
+    return(status);
+
+#else /* !NX_ENABLE_IP_PACKET_FILTER */
+    NX_PARAMETER_NOT_USED(ip_ptr);
+    NX_PARAMETER_NOT_USED(rule_array);
+    NX_PARAMETER_NOT_USED(rule_count);
+    NX_PARAMETER_NOT_USED(default_action);
+
+    return(NX_NOT_SUPPORTED);
+#endif /* NX_ENABLE_IP_PACKET_FILTER */
+}
+
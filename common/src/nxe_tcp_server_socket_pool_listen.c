@@ -0,0 +1,147 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Transmission Control Protocol (TCP)                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+#include "nx_tcp.h"
+
+
+/* Bring in externs for caller checking code.  */
+
+NX_CALLER_CHECKING_EXTERNS
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_tcp_server_socket_pool_listen                  PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the TCP server socket pool listen*/
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    port                                  TCP port number               */
+/*    socket_array                          Array of server sockets       */
+/*    socket_count                          Number of sockets in array    */
+/*    listen_queue_size                     Maximum number of connections */
+/*                                            that can be queued          */
+/*    tcp_listen_callback                   Application function to call  */
+/*                                            when the connection is      */
+/*                                            received                    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_tcp_server_socket_pool_listen     Actual server socket pool     */
+/*                                            listen function             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxe_tcp_server_socket_pool_listen(NX_IP *ip_ptr, UINT port, NX_TCP_SOCKET **socket_array, UINT socket_count,
+                                         UINT listen_queue_size, VOID (*tcp_listen_callback)(NX_TCP_SOCKET *socket_ptr, UINT port))
+{
+#ifdef NX_ENABLE_TCP_ACCEPT_POOL
+
+UINT i;
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((ip_ptr == NX_NULL) || (ip_ptr -> nx_ip_id != NX_IP_ID) || (socket_array == NX_NULL))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for an empty pool.  */
+    if (socket_count == 0)
+    {
+        return(NX_SIZE_ERROR);
+    }
+
+    /* Check each socket of the pool.  */
+    for (i = 0; i < socket_count; i++)
+    {
+        if ((socket_array[i] == NX_NULL) || (socket_array[i] -> nx_tcp_socket_id != NX_TCP_ID))
+        {
+            return(NX_PTR_ERROR);
+        }
+    }
+
+    /* Check to see if TCP is enabled.  */
+    if (!ip_ptr -> nx_ip_tcp_packet_receive)
+    {
+        return(NX_NOT_ENABLED);
+    }
+
+    /* Check for an invalid port.  */
+    if ((!port) || (((ULONG)port) > (ULONG)NX_MAX_PORT))
+    {
+        return(NX_INVALID_PORT);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_THREADS_ONLY_CALLER_CHECKING
+
+    /* Call actual TCP server socket pool listen function.  */
+    status =  _nx_tcp_server_socket_pool_listen(ip_ptr, port, socket_array, socket_count, listen_queue_size, tcp_listen_callback);
+
+    /* Return completion status.  */
+    return(status);
+
+#else /* !NX_ENABLE_TCP_ACCEPT_POOL */
+    NX_PARAMETER_NOT_USED(ip_ptr);
+    NX_PARAMETER_NOT_USED(port);
+    NX_PARAMETER_NOT_USED(socket_array);
+    NX_PARAMETER_NOT_USED(socket_count);
+    NX_PARAMETER_NOT_USED(listen_queue_size);
+    NX_PARAMETER_NOT_USED(tcp_listen_callback);
+
+    return(NX_NOT_SUPPORTED);
+#endif /* NX_ENABLE_TCP_ACCEPT_POOL */
+}
+
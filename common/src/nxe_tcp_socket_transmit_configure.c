@@ -100,6 +100,14 @@ UINT status;
         return(NX_OPTION_ERROR);
     }
 
+#ifdef NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX
+    /* Check that the transmit queue index can hold the requested queue depth.  */
+    if (max_queue_depth > NX_TCP_TRANSMIT_QUEUE_INDEX_SIZE)
+    {
+        return(NX_OPTION_ERROR);
+    }
+#endif /* NX_ENABLE_TCP_TRANSMIT_QUEUE_INDEX */
+
     /* Check for appropriate caller.  */
     NX_INIT_AND_THREADS_CALLER_CHECKING
 
@@ -0,0 +1,195 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   User Datagram Protocol (UDP)                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_ip.h"
+#include "nx_udp.h"
+#include "nx_packet.h"
+
+
+/* Bring in externs for caller checking code.  */
+
+NX_CALLER_CHECKING_EXTERNS
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_udp_socket_send_batch                          PORTABLE C      */
+/*                                                           6.0.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the UDP socket send batch        */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    socket_ptr                            Pointer to UDP socket         */
+/*    entry_array                           Array of packets to send      */
+/*    entry_count                           Number of entries             */
+/*    sent_count                            Pointer to destination for the*/
+/*                                            number of entries sent      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_udp_socket_send_batch             Actual UDP socket send batch  */
+/*                                            function                    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-18-2026     agent                    Initial Version 6.0.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxe_udp_socket_send_batch(NX_UDP_SOCKET *socket_ptr, NX_UDP_SEND_ENTRY *entry_array,
+                                 UINT entry_count, UINT *sent_count)
+{
+#ifdef NX_ENABLE_UDP_BATCH
+
+UINT       index;
+UINT       status;
+NX_PACKET *packet_ptr;
+
+
+    /* Check for invalid input pointers.  */
+    if ((socket_ptr == NX_NULL) || (socket_ptr -> nx_udp_socket_id != NX_UDP_ID) ||
+        (entry_array == NX_NULL) || (sent_count == NX_NULL))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check to see if UDP is enabled.  */
+    if (!(socket_ptr -> nx_udp_socket_ip_ptr) -> nx_ip_udp_packet_receive)
+    {
+        return(NX_NOT_ENABLED);
+    }
+
+    /* Check for an empty batch.  */
+    if (entry_count == 0)
+    {
+        return(NX_SIZE_ERROR);
+    }
+
+    /* Loop to check each entry of the batch.  */
+    for (index = 0; index < entry_count; index++)
+    {
+
+        /* Setup packet pointer.  */
+        packet_ptr =  entry_array[index].nx_udp_send_entry_packet;
+
+        /* Check for an invalid packet pointer.  */
+        if ((packet_ptr == NX_NULL) || (packet_ptr -> nx_packet_tcp_queue_next != ((NX_PACKET *)NX_PACKET_ALLOCATED)))
+        {
+            return(NX_PTR_ERROR);
+        }
+
+        /* Check for invalid IP address.  */
+        if (!entry_array[index].nx_udp_send_entry_ip_address)
+        {
+            return(NX_IP_ADDRESS_ERROR);
+        }
+
+        /* Check for an invalid port.  */
+        if (((ULONG)entry_array[index].nx_udp_send_entry_port) > (ULONG)NX_MAX_PORT)
+        {
+            return(NX_INVALID_PORT);
+        }
+
+        /* Check for an invalid packet prepend pointer.  */
+        if ((packet_ptr -> nx_packet_prepend_ptr - (sizeof(NX_IP_HEADER) + sizeof(NX_UDP_HEADER))) < packet_ptr -> nx_packet_data_start)
+        {
+
+#ifndef NX_DISABLE_UDP_INFO
+            /* Increment the total UDP invalid packet count.  */
+            (socket_ptr -> nx_udp_socket_ip_ptr) -> nx_ip_udp_invalid_packets++;
+
+            /* Increment the total UDP invalid packet count for this socket.  */
+            socket_ptr -> nx_udp_socket_invalid_packets++;
+#endif
+
+            /* Return error code.  */
+            return(NX_UNDERFLOW);
+        }
+
+        /* Check for an invalid packet append pointer.  */
+        if (packet_ptr -> nx_packet_append_ptr > packet_ptr -> nx_packet_data_end)
+        {
+
+#ifndef NX_DISABLE_UDP_INFO
+            /* Increment the total UDP invalid packet count.  */
+            (socket_ptr -> nx_udp_socket_ip_ptr) -> nx_ip_udp_invalid_packets++;
+
+            /* Increment the total UDP invalid packet count for this socket.  */
+            socket_ptr -> nx_udp_socket_invalid_packets++;
+#endif
+
+            /* Return error code.  */
+            return(NX_OVERFLOW);
+        }
+    }
+
+    /* Check for appropriate caller.  */
+    NX_THREADS_ONLY_CALLER_CHECKING
+
+    /* Call actual UDP socket send batch function.  */
+    status =  _nx_udp_socket_send_batch(socket_ptr, entry_array, entry_count, sent_count);
+
+    /* Now clear the application's pointers to the packets that were sent so they can't be
+       accidentally used again by the application.  This is only done when error checking
+       is enabled.  */
+    for (index = 0; index < *sent_count; index++)
+    {
+        entry_array[index].nx_udp_send_entry_packet =  NX_NULL;
+    }
+
+    /* Return completion status.  */
+    return(status);
+
+#else /* !NX_ENABLE_UDP_BATCH */
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    NX_PARAMETER_NOT_USED(entry_array);
+    NX_PARAMETER_NOT_USED(entry_count);
+    NX_PARAMETER_NOT_USED(sent_count);
+
+    return(NX_NOT_SUPPORTED);
+#endif /* NX_ENABLE_UDP_BATCH */
+}
+
@@ -0,0 +1,246 @@
+/* This is a small demo of the NetX packet filter rules.  This demo measures the cost of
+   checking a received packet against the installed rules as the number of rules grows.
+   Every rule is a TCP rule with a source prefix and a destination port that the test
+   packets do not match, so all rules of the packet's protocol class are compared, which is
+   the worst case.  The TCP packet is compared with every rule, while the UDP packet skips
+   them since they are listed under the TCP class only.
+
+   NetX must be built with NX_ENABLE_IP_PACKET_FILTER.  The results are printed in
+   nanoseconds per check, measured with the ThreadX timer over DEMO_ITERATIONS checks.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   "nx_ip.h"
+#include   <stdio.h>
+#include   <string.h>
+
+#ifdef NX_ENABLE_IP_PACKET_FILTER
+
+#define     DEMO_STACK_SIZE 2048
+#define     DEMO_ITERATIONS 10000000UL
+#define     PACKET_SIZE     1536
+#define     POOL_SIZE       ((sizeof(NX_PACKET) + PACKET_SIZE) * 8)
+
+
+/* Define the ThreadX and NetX object control blocks.  */
+
+TX_THREAD               thread_0;
+
+NX_PACKET_POOL          pool_0;
+NX_IP                   ip_0;
+UCHAR                   pool_buffer[POOL_SIZE];
+
+
+/* Define the packet filter rules.  */
+
+NX_IP_PACKET_FILTER_RULE    rule_array[NX_IP_PACKET_FILTER_MAX_RULES];
+
+
+/* Define the rule counts to measure.  */
+
+static const UINT       rule_counts[] = {0, 1, 4, 16, 32, 64, 128, 255};
+
+
+/* Define the counters used in the demo application...  */
+
+ULONG                   error_counter;
+
+/* Define thread prototypes.  */
+
+void thread_0_entry(ULONG thread_input);
+void _nx_ram_network_driver(struct NX_IP_DRIVER_STRUCT *driver_req);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+CHAR *pointer;
+UINT  status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *)first_unused_memory;
+
+    /* Create the main thread.  */
+    tx_thread_create(&thread_0, "thread 0", thread_0_entry, 0,
+                     pointer, DEMO_STACK_SIZE,
+                     4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create a packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", PACKET_SIZE, pool_buffer, POOL_SIZE);
+
+    /* Check for pool creation error.  */
+    if (status)
+    {
+        error_counter++;
+    }
+
+    /* Create an IP instance.  */
+    status = nx_ip_create(&ip_0, "NetX IP Instance 0", IP_ADDRESS(1, 2, 3, 4), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver,
+                          pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    /* Check for IP create errors.  */
+    if (status)
+    {
+        error_counter++;
+    }
+}
+
+
+/* Build a packet holding an IP header, in host byte order as the receive path leaves it,
+   followed by the first 16 bytes of a TCP or UDP header in network byte order.  */
+
+static NX_PACKET   *demo_packet_build(ULONG protocol)
+{
+
+NX_PACKET    *packet_ptr;
+NX_IP_HEADER *ip_header_ptr;
+UCHAR        *transport_ptr;
+UINT          i;
+
+
+    /* Allocate a packet.  */
+    if (nx_packet_allocate(&pool_0, &packet_ptr, NX_IP_PACKET - sizeof(NX_IP_HEADER), NX_NO_WAIT))
+    {
+        error_counter++;
+        return(NX_NULL);
+    }
+
+    /* Build the IP header.  */
+    ip_header_ptr =  (NX_IP_HEADER *)packet_ptr -> nx_packet_prepend_ptr;
+    ip_header_ptr -> nx_ip_header_word_0 =      NX_IP_VERSION | (sizeof(NX_IP_HEADER) + 16);
+    ip_header_ptr -> nx_ip_header_word_1 =      0;
+    ip_header_ptr -> nx_ip_header_word_2 =      (0x80UL << 24) | protocol;
+    ip_header_ptr -> nx_ip_header_source_ip =   IP_ADDRESS(1, 2, 3, 5);
+    ip_header_ptr -> nx_ip_header_destination_ip =  IP_ADDRESS(1, 2, 3, 4);
+
+    /* Build the transport header: source port 1024, destination port 80, and for TCP a SYN.  */
+    transport_ptr =  packet_ptr -> nx_packet_prepend_ptr + sizeof(NX_IP_HEADER);
+    for (i = 0; i < 16; i++)
+    {
+        transport_ptr[i] =  0;
+    }
+    transport_ptr[0] =   0x04;
+    transport_ptr[3] =   80;
+    transport_ptr[13] =  0x02;
+
+    /* Setup the packet length.  */
+    packet_ptr -> nx_packet_append_ptr =    transport_ptr + 16;
+    packet_ptr -> nx_packet_length =        sizeof(NX_IP_HEADER) + 16;
+    packet_ptr -> nx_packet_ip_interface =  &ip_0.nx_ip_interface[0];
+
+    return(packet_ptr);
+}
+
+
+/* Return the nanoseconds spent on each check of the packet against the installed rules.  */
+
+static ULONG    demo_check_time(NX_PACKET *packet_ptr)
+{
+
+ULONG i;
+ULONG start_time;
+ULONG ticks;
+
+
+    /* Wait for the start of a tick.  */
+    start_time =  tx_time_get();
+    while (tx_time_get() == start_time)
+    {
+    }
+    start_time =  tx_time_get();
+
+    /* Check the packet repeatedly.  */
+    for (i = 0; i < DEMO_ITERATIONS; i++)
+    {
+        if (_nx_ip_packet_filter_rules_check(&ip_0, packet_ptr) != NX_IP_PACKET_FILTER_ACCEPT)
+        {
+            error_counter++;
+        }
+    }
+    ticks =  tx_time_get() - start_time;
+
+    /* Convert the ticks to nanoseconds per check.  */
+    return((ULONG)(((ULONG64)ticks * (1000000000UL / NX_IP_PERIODIC_RATE)) / DEMO_ITERATIONS));
+}
+
+
+/* Define the test thread.  */
+
+void    thread_0_entry(ULONG thread_input)
+{
+
+NX_PACKET *tcp_packet;
+NX_PACKET *udp_packet;
+UINT       rule_count;
+UINT       i;
+UINT       j;
+
+    NX_PARAMETER_NOT_USED(thread_input);
+
+    /* Build the test packets.  */
+    tcp_packet =  demo_packet_build(NX_IP_TCP);
+    udp_packet =  demo_packet_build(NX_IP_UDP);
+    if ((tcp_packet == NX_NULL) || (udp_packet == NX_NULL))
+    {
+        return;
+    }
+
+    printf("rules   TCP ns   UDP ns\n");
+
+    /* Loop to measure each rule count the build supports.  */
+    for (i = 0; i < sizeof(rule_counts) / sizeof(UINT); i++)
+    {
+
+        rule_count =  rule_counts[i];
+        if (rule_count > NX_IP_PACKET_FILTER_MAX_RULES)
+        {
+            break;
+        }
+
+        /* Setup TCP rules that drop traffic from 10.x.y.0/24 to port 80.  */
+        memset(rule_array, 0, sizeof(rule_array));
+        for (j = 0; j < rule_count; j++)
+        {
+            rule_array[j].nx_ip_packet_filter_rule_source_ip =              IP_ADDRESS(10, j >> 8, j & 0xFF, 0);
+            rule_array[j].nx_ip_packet_filter_rule_source_mask =            0xFFFFFF00UL;
+            rule_array[j].nx_ip_packet_filter_rule_protocol =               NX_IP_TCP;
+            rule_array[j].nx_ip_packet_filter_rule_destination_port_low =   80;
+            rule_array[j].nx_ip_packet_filter_rule_destination_port_high =  80;
+            rule_array[j].nx_ip_packet_filter_rule_action =                 NX_IP_PACKET_FILTER_DROP;
+        }
+
+        /* Install the rules.  */
+        if (nx_ip_packet_filter_rules_set(&ip_0, rule_array, rule_count, NX_IP_PACKET_FILTER_ACCEPT))
+        {
+            error_counter++;
+            break;
+        }
+
+        printf("%5u   %6lu   %6lu\n", rule_count, demo_check_time(tcp_packet), demo_check_time(udp_packet));
+    }
+
+    /* Remove the rules and release the test packets.  */
+    nx_ip_packet_filter_rules_set(&ip_0, NX_NULL, 0, NX_IP_PACKET_FILTER_ACCEPT);
+    nx_packet_release(tcp_packet);
+    nx_packet_release(udp_packet);
+}
+
+#endif /* NX_ENABLE_IP_PACKET_FILTER */
@@ -0,0 +1,287 @@
+/* This is a small demo of the NetX batched UDP services.  This demo measures the rate of
+   small datagrams sent to the loopback address and received back on the same socket, first
+   with nx_udp_socket_send and nx_udp_socket_receive, one datagram per call, and then with
+   nx_udp_socket_send_batch and nx_udp_socket_receive_batch, DEMO_BATCH datagrams per call.
+   Each round allocates DEMO_BATCH packets holding DEMO_PAYLOAD bytes, sends them all and then
+   receives them all.
+
+   NetX must be built with NX_ENABLE_UDP_BATCH, and without NX_DISABLE_LOOPBACK_INTERFACE.
+   The results are printed in datagrams per second, measured with the ThreadX timer over
+   DEMO_ROUNDS rounds.  */
+
+#include   "tx_api.h"
+#include   "nx_api.h"
+#include   <stdio.h>
+
+#ifdef NX_ENABLE_UDP_BATCH
+
+#define     DEMO_STACK_SIZE 2048
+#define     DEMO_ROUNDS     20000UL
+#define     DEMO_BATCH      16
+#define     DEMO_PAYLOAD    32
+#define     DEMO_PORT       0x88
+#define     PACKET_SIZE     256
+#define     POOL_SIZE       ((sizeof(NX_PACKET) + PACKET_SIZE) * (DEMO_BATCH * 3))
+
+
+/* Define the ThreadX and NetX object control blocks.  */
+
+TX_THREAD               thread_0;
+
+NX_PACKET_POOL          pool_0;
+NX_IP                   ip_0;
+NX_UDP_SOCKET           socket_0;
+UCHAR                   pool_buffer[POOL_SIZE];
+
+
+/* Define the batch arrays.  */
+
+NX_UDP_SEND_ENTRY       send_array[DEMO_BATCH];
+NX_PACKET              *receive_array[DEMO_BATCH];
+
+
+/* Define the payload of the datagrams.  */
+
+UCHAR                   payload[DEMO_PAYLOAD];
+
+
+/* Define the counters used in the demo application...  */
+
+ULONG                   error_counter;
+
+/* Define thread prototypes.  */
+
+void thread_0_entry(ULONG thread_input);
+void _nx_ram_network_driver(struct NX_IP_DRIVER_STRUCT *driver_req);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+CHAR *pointer;
+UINT  status;
+
+
+    /* Setup the working pointer.  */
+    pointer =  (CHAR *)first_unused_memory;
+
+    /* Create the main thread.  */
+    tx_thread_create(&thread_0, "thread 0", thread_0_entry, 0,
+                     pointer, DEMO_STACK_SIZE,
+                     4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer =  pointer + DEMO_STACK_SIZE;
+
+    /* Initialize the NetX system.  */
+    nx_system_initialize();
+
+    /* Create a packet pool.  */
+    status =  nx_packet_pool_create(&pool_0, "NetX Main Packet Pool", PACKET_SIZE, pool_buffer, POOL_SIZE);
+
+    /* Check for pool creation error.  */
+    if (status)
+    {
+        error_counter++;
+    }
+
+    /* Create an IP instance.  */
+    status = nx_ip_create(&ip_0, "NetX IP Instance 0", IP_ADDRESS(1, 2, 3, 4), 0xFFFFFF00UL, &pool_0, _nx_ram_network_driver,
+                          pointer, 2048, 1);
+    pointer =  pointer + 2048;
+
+    /* Check for IP create errors.  */
+    if (status)
+    {
+        error_counter++;
+    }
+
+    /* Enable UDP traffic.  */
+    status =  nx_udp_enable(&ip_0);
+
+    /* Check for UDP enable errors.  */
+    if (status)
+    {
+        error_counter++;
+    }
+}
+
+
+/* Allocate the packets of one round and fill in their payload.  */
+
+static UINT demo_packets_allocate(void)
+{
+
+NX_PACKET *packet_ptr;
+UINT       i;
+
+
+    for (i = 0; i < DEMO_BATCH; i++)
+    {
+
+        /* Allocate a packet.  */
+        if (nx_packet_allocate(&pool_0, &packet_ptr, NX_UDP_PACKET, NX_WAIT_FOREVER))
+        {
+            error_counter++;
+            return(NX_FALSE);
+        }
+
+        /* Write the payload into the packet.  */
+        nx_packet_data_append(packet_ptr, payload, DEMO_PAYLOAD, &pool_0, NX_WAIT_FOREVER);
+
+        /* Setup the send entry.  */
+        send_array[i].nx_udp_send_entry_packet =      packet_ptr;
+        send_array[i].nx_udp_send_entry_ip_address =  IP_ADDRESS(127, 0, 0, 1);
+        send_array[i].nx_udp_send_entry_port =        DEMO_PORT;
+    }
+
+    return(NX_TRUE);
+}
+
+
+/* Return the datagrams per second moved with the single datagram services, or with the
+   batch services.  */
+
+static ULONG    demo_rate(UINT batch)
+{
+
+ULONG      round;
+ULONG      start_time;
+ULONG      ticks;
+NX_PACKET *packet_ptr;
+UINT       received;
+UINT       count;
+UINT       i;
+
+
+    /* Wait for the start of a tick.  */
+    start_time =  tx_time_get();
+    while (tx_time_get() == start_time)
+    {
+    }
+    start_time =  tx_time_get();
+
+    /* Loop to send and receive the rounds.  */
+    for (round = 0; round < DEMO_ROUNDS; round++)
+    {
+
+        if (!demo_packets_allocate())
+        {
+            break;
+        }
+
+        if (batch)
+        {
+
+            /* Send the round in one call.  */
+            if (nx_udp_socket_send_batch(&socket_0, send_array, DEMO_BATCH, &count))
+            {
+
+                /* Release the packets that were not sent.  */
+                for (i = count; i < DEMO_BATCH; i++)
+                {
+                    nx_packet_release(send_array[i].nx_udp_send_entry_packet);
+                }
+                error_counter++;
+                break;
+            }
+
+            /* Receive the round, as many datagrams per call as are queued.  */
+            for (received = 0; received < DEMO_BATCH; received += count)
+            {
+                if (nx_udp_socket_receive_batch(&socket_0, receive_array, DEMO_BATCH - received, &count, NX_IP_PERIODIC_RATE))
+                {
+                    error_counter++;
+                    break;
+                }
+
+                for (i = 0; i < count; i++)
+                {
+                    nx_packet_release(receive_array[i]);
+                }
+            }
+        }
+        else
+        {
+
+            /* Send the round one datagram at a time.  */
+            for (i = 0; i < DEMO_BATCH; i++)
+            {
+                if (nx_udp_socket_send(&socket_0, send_array[i].nx_udp_send_entry_packet, IP_ADDRESS(127, 0, 0, 1), DEMO_PORT))
+                {
+                    nx_packet_release(send_array[i].nx_udp_send_entry_packet);
+                    error_counter++;
+                }
+            }
+
+            /* Receive the round one datagram at a time.  */
+            for (i = 0; i < DEMO_BATCH; i++)
+            {
+                if (nx_udp_socket_receive(&socket_0, &packet_ptr, NX_IP_PERIODIC_RATE))
+                {
+                    error_counter++;
+                    break;
+                }
+
+                nx_packet_release(packet_ptr);
+            }
+        }
+    }
+    ticks =  tx_time_get() - start_time;
+
+    /* Convert the ticks to datagrams per second.  */
+    if (ticks == 0)
+    {
+        ticks =  1;
+    }
+    return((ULONG)(((ULONG64)DEMO_ROUNDS * DEMO_BATCH * NX_IP_PERIODIC_RATE) / ticks));
+}
+
+
+/* Define the test thread.  */
+
+void    thread_0_entry(ULONG thread_input)
+{
+
+ULONG single_rate;
+ULONG batch_rate;
+UINT  status;
+
+    NX_PARAMETER_NOT_USED(thread_input);
+
+    /* Create and bind the UDP socket, with room for a full round on its receive queue.  */
+    status =  nx_udp_socket_create(&ip_0, &socket_0, "Socket 0", NX_IP_NORMAL, NX_FRAGMENT_OKAY, 0x80, DEMO_BATCH);
+    if (status == NX_SUCCESS)
+    {
+        status =  nx_udp_socket_bind(&socket_0, DEMO_PORT, TX_WAIT_FOREVER);
+    }
+    if (status)
+    {
+        error_counter++;
+        return;
+    }
+
+    /* Measure both ways of moving the datagrams.  */
+    single_rate =  demo_rate(NX_FALSE);
+    batch_rate =   demo_rate(NX_TRUE);
+
+    printf("single datagram services: %lu datagrams/s\n", single_rate);
+    printf("batch services:           %lu datagrams/s\n", batch_rate);
+    printf("errors:                   %lu\n", error_counter);
+
+    /* Unbind and delete the socket.  */
+    nx_udp_socket_unbind(&socket_0);
+    nx_udp_socket_delete(&socket_0);
+}
+
+#endif /* NX_ENABLE_UDP_BATCH */